@@ -0,0 +1,165 @@
+#include <neocpp/neocpp.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace neocpp;
+
+template<typename Fn>
+double measure(Fn fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+static const char* ALPHABET = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+
+/// The previous generic conversion: byte-at-a-time big-number arithmetic
+static std::string legacyEncode(const Bytes& data) {
+    size_t zeros = 0;
+    while (zeros < data.size() && data[zeros] == 0) {
+        ++zeros;
+    }
+    std::vector<uint8_t> buffer(data.size() * 138 / 100 + 1);
+    size_t length = 0;
+    for (uint8_t byte : data) {
+        int carry = byte;
+        for (size_t i = 0; i < length || carry; ++i) {
+            carry += 256 * buffer[i];
+            buffer[i] = carry % 58;
+            carry /= 58;
+            if (i >= length) {
+                length = i + 1;
+            }
+        }
+    }
+    std::string result(zeros, '1');
+    for (size_t i = 0; i < length; ++i) {
+        result += ALPHABET[buffer[length - 1 - i]];
+    }
+    return result;
+}
+
+/// The previous decoder with a strchr lookup per character
+static Bytes legacyDecode(const std::string& encoded) {
+    size_t zeros = 0;
+    while (zeros < encoded.size() && encoded[zeros] == '1') {
+        ++zeros;
+    }
+    std::vector<uint8_t> buffer(encoded.size() * 733 / 1000 + 1);
+    size_t length = 0;
+    for (char c : encoded) {
+        const char* p = std::strchr(ALPHABET, c);
+        if (p == nullptr) {
+            return Bytes();
+        }
+        int carry = static_cast<int>(p - ALPHABET);
+        for (size_t i = 0; i < length || carry; ++i) {
+            carry += 58 * buffer[i];
+            buffer[i] = carry % 256;
+            carry /= 256;
+            if (i >= length) {
+                length = i + 1;
+            }
+        }
+    }
+    Bytes result(zeros, 0);
+    for (size_t i = 0; i < length; ++i) {
+        result.push_back(buffer[length - 1 - i]);
+    }
+    return result;
+}
+
+static std::string legacyScriptHashToAddress(const Bytes& scriptHash) {
+    Bytes data;
+    data.reserve(25);
+    data.push_back(AddressUtils::getAddressVersion());
+    data.insert(data.end(), scriptHash.begin(), scriptHash.end());
+    Bytes checksum = HashUtils::doubleSha256(data);
+    data.insert(data.end(), checksum.begin(), checksum.begin() + 4);
+    return legacyEncode(data);
+}
+
+/// Validate, then decode again, with a checksum each time
+static Bytes legacyAddressToScriptHash(const std::string& address) {
+    for (int pass = 0; pass < 2; ++pass) {
+        Bytes decoded = legacyDecode(address);
+        Bytes body(decoded.begin(), decoded.end() - 4);
+        Bytes checksum = HashUtils::doubleSha256(body);
+        if (decoded.size() != 25 || !std::equal(checksum.begin(), checksum.begin() + 4, decoded.end() - 4)) {
+            throw IllegalArgumentException("Invalid Neo address");
+        }
+        if (pass == 1) {
+            return Bytes(body.begin() + 1, body.end());
+        }
+    }
+    return Bytes();
+}
+
+static void report(const std::string& name, size_t count, double seconds) {
+    std::cout << "  " << name << std::string(name.size() < 36 ? 36 - name.size() : 1, ' ')
+              << count / seconds << " addresses/sec" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    size_t count = argc > 1 ? static_cast<size_t>(std::strtoul(argv[1], nullptr, 10)) : 200000;
+    unsigned int threads = argc > 2 ? static_cast<unsigned int>(std::strtoul(argv[2], nullptr, 10)) : 0;
+
+    try {
+        std::vector<Bytes> scriptHashes(count, Bytes(20));
+        for (size_t i = 0; i < count; ++i) {
+            for (size_t j = 0; j < 20; ++j) {
+                scriptHashes[i][j] = static_cast<uint8_t>(i * 131 + j * 17 + (i >> 8));
+            }
+        }
+        auto addresses = AddressUtils::scriptHashesToAddresses(scriptHashes, 1);
+
+        // Keep results observable so the loops are not optimized away
+        size_t checksum = 0;
+
+        std::cout << "Address conversion (" << count << " addresses)" << std::endl;
+        report("legacy scriptHashToAddress", count, measure([&]() {
+            for (const auto& scriptHash : scriptHashes) {
+                checksum += legacyScriptHashToAddress(scriptHash).size();
+            }
+        }));
+        report("scriptHashToAddress", count, measure([&]() {
+            for (const auto& scriptHash : scriptHashes) {
+                checksum += AddressUtils::scriptHashToAddress(scriptHash).size();
+            }
+        }));
+        report("scriptHashesToAddresses (batch)", count, measure([&]() {
+            checksum += AddressUtils::scriptHashesToAddresses(scriptHashes, threads).size();
+        }));
+        report("legacy addressToScriptHash", count, measure([&]() {
+            for (const auto& address : addresses) {
+                checksum += legacyAddressToScriptHash(address)[0];
+            }
+        }));
+        report("addressToScriptHash", count, measure([&]() {
+            for (const auto& address : addresses) {
+                checksum += AddressUtils::addressToScriptHash(address)[0];
+            }
+        }));
+        report("tryAddressToScriptHash", count, measure([&]() {
+            uint8_t scriptHash[20];
+            for (const auto& address : addresses) {
+                checksum += AddressUtils::tryAddressToScriptHash(address, scriptHash) ? scriptHash[0] : 0;
+            }
+        }));
+        report("addressesToScriptHashes (batch)", count, measure([&]() {
+            checksum += AddressUtils::addressesToScriptHashes(addresses, threads).size();
+        }));
+
+        std::cout << "  (checksum " << checksum << ")" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
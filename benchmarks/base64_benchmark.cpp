@@ -0,0 +1,140 @@
+#include <neocpp/neocpp.hpp>
+#include <openssl/bio.h>
+#include <openssl/buffer.h>
+#include <openssl/evp.h>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace neocpp;
+
+template<typename Fn>
+double measure(Fn fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+/// The previous encoder: an OpenSSL base64 BIO chain per call
+static std::string bioEncode(const Bytes& data) {
+    BIO* bio = BIO_new(BIO_s_mem());
+    BIO* b64 = BIO_new(BIO_f_base64());
+    BIO_set_flags(b64, BIO_FLAGS_BASE64_NO_NL);
+    bio = BIO_push(b64, bio);
+    BIO_write(bio, data.data(), static_cast<int>(data.size()));
+    BIO_flush(bio);
+    BUF_MEM* buffer = nullptr;
+    BIO_get_mem_ptr(bio, &buffer);
+    std::string result(buffer->data, buffer->length);
+    BIO_free_all(bio);
+    return result;
+}
+
+/// The previous decoder: validation pass, then a BIO chain
+static Bytes bioDecode(const std::string& encoded) {
+    BIO* bio = BIO_new_mem_buf(encoded.data(), static_cast<int>(encoded.size()));
+    BIO* b64 = BIO_new(BIO_f_base64());
+    BIO_set_flags(b64, BIO_FLAGS_BASE64_NO_NL);
+    bio = BIO_push(b64, bio);
+    Bytes result(encoded.size());
+    int length = BIO_read(bio, result.data(), static_cast<int>(encoded.size()));
+    BIO_free_all(bio);
+    result.resize(length < 0 ? 0 : length);
+    return result;
+}
+
+static void report(const std::string& name, size_t bytes, double seconds) {
+    std::cout << "    " << name << std::string(name.size() < 28 ? 28 - name.size() : 1, ' ')
+              << bytes / seconds / 1e6 << " MB/s" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    size_t totalBytes = argc > 1 ? static_cast<size_t>(std::strtoul(argv[1], nullptr, 10)) : 64 * 1024 * 1024;
+
+    try {
+        // Keep results observable so the loops are not optimized away
+        size_t checksum = 0;
+
+        std::cout << "Base64 codec (" << Base64::getImplementation() << ", " << totalBytes
+                  << " bytes per measurement, MB/s of binary data)" << std::endl;
+
+        for (size_t size : {size_t(32), size_t(250), size_t(4096), size_t(64 * 1024)}) {
+            Bytes data(size);
+            for (size_t i = 0; i < size; ++i) {
+                data[i] = static_cast<uint8_t>(i * 131 + 7);
+            }
+            std::string encoded = Base64::encode(data);
+            size_t iterations = std::max<size_t>(1, totalBytes / size);
+
+            std::cout << "  " << size << "-byte inputs" << std::endl;
+            report("OpenSSL BIO encode", iterations * size, measure([&]() {
+                for (size_t i = 0; i < iterations; ++i) {
+                    checksum += bioEncode(data).size();
+                }
+            }));
+            report("Base64::encode", iterations * size, measure([&]() {
+                for (size_t i = 0; i < iterations; ++i) {
+                    checksum += Base64::encode(data).size();
+                }
+            }));
+            std::string out(Base64::encodedLength(size), '\0');
+            report("Base64::encode (buffer)", iterations * size, measure([&]() {
+                for (size_t i = 0; i < iterations; ++i) {
+                    Base64::encode(data.data(), data.size(), out.data());
+                    checksum += static_cast<uint8_t>(out[i % out.size()]);
+                }
+            }));
+            report("OpenSSL BIO decode", iterations * size, measure([&]() {
+                for (size_t i = 0; i < iterations; ++i) {
+                    checksum += bioDecode(encoded).size();
+                }
+            }));
+            report("Base64::decode", iterations * size, measure([&]() {
+                for (size_t i = 0; i < iterations; ++i) {
+                    checksum += Base64::decode(encoded).size();
+                }
+            }));
+            Bytes decoded(Base64::maxDecodedLength(encoded.size()));
+            report("Base64::decode (buffer)", iterations * size, measure([&]() {
+                for (size_t i = 0; i < iterations; ++i) {
+                    size_t written = 0;
+                    checksum += Base64::decode(encoded, decoded.data(), written) ? decoded[i % written] : 0;
+                }
+            }));
+
+            // A JSON-RPC body carrying the payload: serialize, encode, build a json tree and dump
+            // it, versus streaming BinaryWriter output straight into the body text
+            report("request body via json", iterations * size, measure([&]() {
+                for (size_t i = 0; i < iterations; ++i) {
+                    BinaryWriter writer;
+                    writer.writeVarBytes(data);
+                    nlohmann::json request = {{"jsonrpc", "2.0"}, {"method", "sendrawtransaction"},
+                                              {"params", nlohmann::json::array({Base64::encode(writer.toArray())})},
+                                              {"id", 1}};
+                    checksum += request.dump().size();
+                }
+            }));
+            report("request body streamed", iterations * size, measure([&]() {
+                for (size_t i = 0; i < iterations; ++i) {
+                    std::string body = "{\"jsonrpc\":\"2.0\",\"method\":\"sendrawtransaction\",\"params\":[\"";
+                    Base64OutputStream stream(body);
+                    BinaryWriter writer(stream);
+                    writer.writeVarBytes(data);
+                    stream.finish();
+                    body += "\"],\"id\":1}";
+                    checksum += body.size();
+                }
+            }));
+        }
+
+        std::cout << "  (checksum " << checksum << ")" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
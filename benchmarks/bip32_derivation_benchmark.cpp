@@ -0,0 +1,58 @@
+#include <neocpp/neocpp.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+
+using namespace neocpp;
+
+template<typename Fn>
+double measure(Fn fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+int main(int argc, char* argv[]) {
+    uint32_t count = argc > 1 ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 100000;
+    unsigned int threads = std::max(1u, std::thread::hardware_concurrency());
+
+    try {
+        auto master = Bip32ECKeyPair::fromSeed(Hex::decode("000102030405060708090a0b0c0d0e0f"));
+        auto account = master->derivePath("m/44'/888'/0'/0");
+        auto xpub = Bip32ExtendedPublicKey::fromExtendedPublicKey(account->toExtendedPublicKey());
+
+        // Baseline: private derivation through the full path for every address
+        uint32_t baselineCount = std::min<uint32_t>(count, 2000);
+        double baseline = measure([&]() {
+            for (uint32_t i = 0; i < baselineCount; ++i) {
+                account->clearDerivationCache();
+                master->clearDerivationCache();
+                master->derivePath("m/44'/888'/0'/0/" + std::to_string(i))->getAddress();
+            }
+        });
+
+        double cachedPath = measure([&]() {
+            for (uint32_t i = 0; i < baselineCount; ++i) {
+                master->derivePath("m/44'/888'/0'/0/" + std::to_string(i))->getAddress();
+            }
+        });
+
+        double single = measure([&]() { xpub->deriveAddresses(0, count, 1); });
+        double parallel = measure([&]() { xpub->deriveAddresses(0, count, threads); });
+        double hashes = measure([&]() { xpub->deriveScriptHashes(0, count, threads); });
+
+        std::cout << "BIP32 derivation (" << count << " children, " << threads << " threads)" << std::endl;
+        std::cout << "  private derivePath (uncached):  " << baselineCount / baseline << " addresses/sec" << std::endl;
+        std::cout << "  private derivePath (cached):    " << baselineCount / cachedPath << " addresses/sec" << std::endl;
+        std::cout << "  xpub batch, 1 thread:           " << count / single << " addresses/sec" << std::endl;
+        std::cout << "  xpub batch, all threads:        " << count / parallel << " addresses/sec" << std::endl;
+        std::cout << "  xpub batch script hashes:       " << count / hashes << " hashes/sec" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,156 @@
+#include <neocpp/neocpp.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory_resource>
+#include <new>
+
+using namespace neocpp;
+
+// Count every heap allocation made by the process
+static std::atomic<size_t> allocationCount{0};
+static std::atomic<size_t> allocatedBytes{0};
+
+void* operator new(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    size_t align = static_cast<size_t>(alignment);
+    if (void* p = std::aligned_alloc(align, (size + align - 1) / align * align)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept {
+    std::free(p);
+}
+
+template<typename Fn>
+double measure(Fn fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+/// A Neo N3 block: header, header witness, transactions
+static Bytes buildBlock(size_t transactions) {
+    auto account = Account::create();
+    BinaryWriter writer;
+    writer.writeUInt32(0);                       // version
+    writer.writeBytes(Bytes(32, 0x01));          // previous hash
+    writer.writeBytes(Bytes(32, 0x02));          // merkle root
+    writer.writeUInt64(1700000000000ULL);        // timestamp
+    writer.writeUInt64(42);                      // nonce
+    writer.writeUInt32(123456);                  // index
+    writer.writeUInt8(0);                        // primary index
+    writer.writeBytes(Bytes(20, 0x03));          // next consensus
+    writer.writeVarInt(1);
+    Witness(Bytes(7 * 66, 0x0C), Bytes(250, 0x21)).serialize(writer);
+
+    writer.writeVarInt(transactions);
+    for (size_t i = 0; i < transactions; ++i) {
+        Transaction tx;
+        tx.setNonce(static_cast<uint32_t>(i + 1));
+        tx.setValidUntilBlock(123500);
+        tx.setScript(Bytes(120 + (i % 200), static_cast<uint8_t>(i)));
+        tx.addSigner(std::make_shared<Signer>(account->getScriptHash()));
+        tx.sign(account);
+        tx.serialize(writer);
+    }
+    return writer.toArray();
+}
+
+/// Parse a block and size every transaction
+static size_t readBlock(BinaryReader& reader) {
+    reader.skip(4 + 32 + 32 + 8 + 8 + 4 + 1 + 20);
+    reader.readVarInt();
+    auto headerWitness = Witness::deserialize(reader);
+
+    size_t checksum = headerWitness->getSize();
+    uint64_t count = reader.readVarInt();
+    for (uint64_t i = 0; i < count; ++i) {
+        auto tx = Transaction::deserialize(reader);
+        checksum += tx->getSize() + tx->getWitnesses().size();
+    }
+    return checksum;
+}
+
+int main(int argc, char* argv[]) {
+    size_t transactions = argc > 1 ? static_cast<size_t>(std::strtoul(argv[1], nullptr, 10)) : 500;
+    size_t iterations = argc > 2 ? static_cast<size_t>(std::strtoul(argv[2], nullptr, 10)) : 200;
+
+    try {
+        Bytes block = buildBlock(transactions);
+
+        // Keep results observable so the loops are not optimized away
+        size_t checksum = 0;
+
+        enum class Mode { COPY, BORROW, ARENA };
+        auto run = [&](Mode mode, size_t& allocations, size_t& bytes) {
+            size_t startCount = allocationCount.load();
+            size_t startBytes = allocatedBytes.load();
+            double seconds = measure([&]() {
+                for (size_t i = 0; i < iterations; ++i) {
+                    if (mode == Mode::COPY) {
+                        BinaryReader reader(block);
+                        checksum += readBlock(reader);
+                    } else if (mode == Mode::BORROW) {
+                        auto reader = BinaryReader::borrow(block);
+                        checksum += readBlock(reader);
+                    } else {
+                        // One upstream allocation per block, released when the arena goes
+                        std::pmr::monotonic_buffer_resource arena(block.size() * 2);
+                        auto reader = BinaryReader::borrow(block);
+                        reader.setMemoryResource(&arena);
+                        checksum += readBlock(reader);
+                    }
+                }
+            });
+            allocations = (allocationCount.load() - startCount) / iterations;
+            bytes = (allocatedBytes.load() - startBytes) / iterations;
+            return seconds;
+        };
+
+        size_t copyAllocations, copyBytes, borrowAllocations, borrowBytes, arenaAllocations, arenaBytes;
+        double copySeconds = run(Mode::COPY, copyAllocations, copyBytes);
+        double borrowSeconds = run(Mode::BORROW, borrowAllocations, borrowBytes);
+        double arenaSeconds = run(Mode::ARENA, arenaAllocations, arenaBytes);
+
+        std::cout << "Block deserialization (" << transactions << " transactions, " << block.size()
+                  << " bytes, " << iterations << " iterations, checksum " << checksum << ")" << std::endl;
+        std::cout << "  Copying reader:    " << iterations / copySeconds << " blocks/sec, "
+                  << copyAllocations << " allocations, " << copyBytes << " bytes allocated per block" << std::endl;
+        std::cout << "  Borrowing reader:  " << iterations / borrowSeconds << " blocks/sec, "
+                  << borrowAllocations << " allocations, " << borrowBytes << " bytes allocated per block" << std::endl;
+        std::cout << "  Borrowing + arena: " << iterations / arenaSeconds << " blocks/sec, "
+                  << arenaAllocations << " allocations, " << arenaBytes << " bytes allocated per block" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,106 @@
+#include <neocpp/neocpp.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace neocpp;
+
+template<typename Fn>
+double measure(Fn fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+/// The previous encoder: one stream insertion per byte
+static std::string streamEncode(const Bytes& data) {
+    std::stringstream ss;
+    ss << std::hex << std::setfill('0');
+    for (const auto& byte : data) {
+        ss << std::setw(2) << static_cast<int>(byte);
+    }
+    return ss.str();
+}
+
+/// The previous decoder: substr and stoul per byte
+static Bytes stoulDecode(const std::string& hex) {
+    Bytes result;
+    result.reserve(hex.length() / 2);
+    for (size_t i = 0; i < hex.length(); i += 2) {
+        result.push_back(static_cast<uint8_t>(std::stoul(hex.substr(i, 2), nullptr, 16)));
+    }
+    return result;
+}
+
+static void report(const std::string& name, size_t bytes, double seconds) {
+    std::cout << "    " << name << std::string(name.size() < 24 ? 24 - name.size() : 1, ' ')
+              << bytes / seconds / 1e6 << " MB/s" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    size_t totalBytes = argc > 1 ? static_cast<size_t>(std::strtoul(argv[1], nullptr, 10)) : 64 * 1024 * 1024;
+
+    try {
+        // Keep results observable so the loops are not optimized away
+        size_t checksum = 0;
+
+        std::cout << "Hex codec (" << Hex::getImplementation() << ", " << totalBytes
+                  << " bytes per measurement, MB/s of binary data)" << std::endl;
+
+        for (size_t size : {size_t(20), size_t(32), size_t(1024), size_t(64 * 1024)}) {
+            Bytes data(size);
+            for (size_t i = 0; i < size; ++i) {
+                data[i] = static_cast<uint8_t>(i * 131 + 7);
+            }
+            std::string hex = Hex::encode(data);
+            size_t iterations = std::max<size_t>(1, totalBytes / size);
+            size_t legacyIterations = std::max<size_t>(1, iterations / 16);
+
+            std::cout << "  " << size << "-byte inputs" << std::endl;
+            report("stringstream encode", legacyIterations * size, measure([&]() {
+                for (size_t i = 0; i < legacyIterations; ++i) {
+                    checksum += streamEncode(data).size();
+                }
+            }));
+            report("Hex::encode", iterations * size, measure([&]() {
+                for (size_t i = 0; i < iterations; ++i) {
+                    checksum += Hex::encode(data).size();
+                }
+            }));
+            std::string out(size * 2, '\0');
+            report("Hex::encode (buffer)", iterations * size, measure([&]() {
+                for (size_t i = 0; i < iterations; ++i) {
+                    Hex::encode(data.data(), data.size(), out.data());
+                    checksum += static_cast<uint8_t>(out[i % out.size()]);
+                }
+            }));
+            report("substr/stoul decode", legacyIterations * size, measure([&]() {
+                for (size_t i = 0; i < legacyIterations; ++i) {
+                    checksum += stoulDecode(hex).size();
+                }
+            }));
+            report("Hex::decode", iterations * size, measure([&]() {
+                for (size_t i = 0; i < iterations; ++i) {
+                    checksum += Hex::decode(hex).size();
+                }
+            }));
+            Bytes decoded(size);
+            report("Hex::decode (buffer)", iterations * size, measure([&]() {
+                for (size_t i = 0; i < iterations; ++i) {
+                    checksum += Hex::decode(hex, decoded.data(), decoded.size()) ? decoded[i % size] : 0;
+                }
+            }));
+        }
+
+        std::cout << "  (checksum " << checksum << ")" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
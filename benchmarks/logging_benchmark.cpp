@@ -0,0 +1,152 @@
+#include <neocpp/neocpp.hpp>
+#include <neocpp/logger.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace neocpp;
+
+template<typename Fn>
+double measure(Fn fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+/// Discards everything, so enabled logging can be timed without a terminal
+class NullBuffer : public std::streambuf {
+protected:
+    int_type overflow(int_type ch) override { return ch; }
+    std::streamsize xsputn(const char*, std::streamsize size) override { return size; }
+};
+
+/// The previous Logger::log: stringstream, put_time and endl under the lock
+static std::mutex legacyMutex;
+static void legacyLog(LogLevel level, const std::string& message, const char* file, int line) {
+    if (level < Logger::getLevel()) return;
+    std::lock_guard<std::mutex> lock(legacyMutex);
+    auto now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+    std::stringstream timestamp;
+    timestamp << std::put_time(std::localtime(&now), "%Y-%m-%d %H:%M:%S");
+    std::stringstream ss;
+    std::string filename(file);
+    filename = filename.substr(filename.find_last_of("/\\") + 1);
+    ss << "[" << timestamp.str() << "] [DEBUG] [" << filename << ":" << line << "] " << message;
+    std::cout << ss.str() << std::endl;
+}
+
+static void report(const std::string& name, size_t count, double seconds) {
+    std::cout << "  " << name << std::string(name.size() < 40 ? 40 - name.size() : 1, ' ')
+              << seconds * 1e9 / count << " ns/call" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    size_t count = argc > 1 ? static_cast<size_t>(std::strtoul(argv[1], nullptr, 10)) : 10000000;
+
+    try {
+        const std::runtime_error error("connection refused");
+        LogLevel originalLevel = Logger::getLevel();
+
+        // Keep results observable so the loops are not optimized away
+        size_t checksum = 0;
+
+        std::cout << "Logging (" << count << " calls, compile-time minimum level "
+                  << NEOCPP_LOG_MIN_LEVEL << ")" << std::endl;
+
+        Logger::setLevel(LogLevel::INFO);
+        report("disabled, message built first", count, measure([&]() {
+            for (size_t i = 0; i < count; ++i) {
+                Logger::debug(std::string("Block polling error: ") + error.what(), __FILE__, __LINE__);
+                checksum += i;
+            }
+        }));
+        report("disabled LOG_DEBUG", count, measure([&]() {
+            for (size_t i = 0; i < count; ++i) {
+                LOG_DEBUG(std::string("Block polling error: ") + error.what());
+                checksum += i;
+            }
+        }));
+        report("empty loop", count, measure([&]() {
+            for (size_t i = 0; i < count; ++i) {
+                checksum += i;
+            }
+        }));
+
+        // Enabled output into a discarding stream buffer
+        NullBuffer nullBuffer;
+        auto* original = std::cout.rdbuf(&nullBuffer);
+        size_t written = count / 10;
+        Logger::setLevel(LogLevel::DEBUG);
+        Logger::setColorEnabled(false);
+        double legacySeconds = measure([&]() {
+            for (size_t i = 0; i < written; ++i) {
+                legacyLog(LogLevel::DEBUG, std::string("Block polling error: ") + error.what(), __FILE__, __LINE__);
+            }
+        });
+        double currentSeconds = measure([&]() {
+            for (size_t i = 0; i < written; ++i) {
+                LOG_DEBUG(std::string("Block polling error: ") + error.what());
+            }
+        });
+
+        // Four threads logging with structured fields to a sink that stalls for 1 ms every 256
+        // records, like a disk or terminal, written directly or queued for the background
+        // writer (time seen by the logging threads)
+        std::ostream nullStream(&nullBuffer);
+        size_t sinkRecords = 0;
+        Logger::setSinks({std::make_shared<CallbackLogSink>([&](const LogRecord& record) {
+            static std::mutex sinkMutex;
+            std::lock_guard<std::mutex> lock(sinkMutex);
+            nullStream << LogSink::format(record) << '\n';
+            if (++sinkRecords % 256 == 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        })});
+        size_t burstRecords = std::min<size_t>(written, 50000);
+        auto burst = [&]() {
+            return measure([&]() {
+                std::vector<std::thread> threads;
+                for (int t = 0; t < 4; ++t) {
+                    threads.emplace_back([&]() {
+                        for (size_t i = 0; i < burstRecords / 4; ++i) {
+                            NEOCPP_LOG_FIELDS(LogLevel::INFO, "Block callback error", {"block", std::to_string(i)});
+                        }
+                    });
+                }
+                for (auto& thread : threads) {
+                    thread.join();
+                }
+            });
+        };
+        double syncSeconds = burst();
+        Logger::startAsync({65536, LogOverflowPolicy::BLOCK});
+        double asyncSeconds = burst();
+        Logger::stopAsync();
+        Logger::setSinks({});
+
+        std::cout.rdbuf(original);
+        Logger::setLevel(originalLevel);
+        Logger::setColorEnabled(true);
+        report("enabled, previous formatting", written, legacySeconds);
+        report("enabled LOG_DEBUG", written, currentSeconds);
+        report("4 threads, stalling sink, synchronous", burstRecords, syncSeconds);
+        report("4 threads, stalling sink, async", burstRecords, asyncSeconds);
+
+        std::cout << "  (checksum " << checksum << ")" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,113 @@
+#include <neocpp/neocpp.hpp>
+#include <neocpp/transaction/transaction_builder.hpp>
+#include <neocpp/contract/gas_token.hpp>
+#include "stub_rpc_server.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+
+using namespace neocpp;
+
+template<typename Fn>
+double measure(Fn fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+#ifdef HAVE_CURL
+
+int main(int argc, char* argv[]) {
+    size_t count = argc > 1 ? static_cast<size_t>(std::strtoul(argv[1], nullptr, 10)) : 100000;
+    unsigned int threads = std::max(1u, std::thread::hardware_concurrency());
+
+    try {
+        // Local stub node: every simulated transfer costs 0.0099777 GAS
+        test::StubRpcServer server([](const std::string& method, const nlohmann::json& params) -> nlohmann::json {
+            auto integer = [](const std::string& value) {
+                return nlohmann::json{{"state", "HALT"}, {"gasconsumed", "0"},
+                                      {"stack", {{{"type", "Integer"}, {"value", value}}}}};
+            };
+            if (method == "getblockcount") return 1000;
+            if (method == "invokescript") {
+                return {{"script", params[0]}, {"state", "HALT"}, {"gasconsumed", "997770"},
+                        {"stack", nlohmann::json::array()}};
+            }
+            if (method == "invokefunction") {
+                std::string name = params[1].get<std::string>();
+                if (name == "getFeePerByte") return integer("1000");
+                if (name == "getExecFeeFactor") return integer("30");
+            }
+            throw std::runtime_error("Method not stubbed: " + method);
+        });
+
+        auto client = std::make_shared<NeoRpcClient>(server.getUrl());
+        auto sender = Account::create();
+        std::vector<Nep17Transfer> transfers;
+        transfers.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            Bytes recipient(20, 0);
+            for (size_t b = 0; b < sizeof(uint32_t); ++b) {
+                recipient[b] = static_cast<uint8_t>(i >> (8 * b));
+            }
+            transfers.push_back({GasToken::SCRIPT_HASH, Hash160(recipient), static_cast<int64_t>(i + 1)});
+        }
+
+        // Baseline: one TransactionBuilder transaction per recipient
+        size_t baselineCount = std::min<size_t>(count, 200);
+        int baselineCalls = server.getCallCount();
+        double baseline = measure([&]() {
+            for (size_t i = 0; i < baselineCount; ++i) {
+                TransactionBuilder builder(client);
+                builder.callContract(transfers[i].token, "transfer", {
+                           ContractParameter::hash160(sender->getScriptHash()),
+                           ContractParameter::hash160(transfers[i].recipient),
+                           ContractParameter::integer(transfers[i].amount),
+                           ContractParameter::string("")})
+                       .addSigner(sender);
+                builder.buildAndSign();
+            }
+        });
+        baselineCalls = server.getCallCount() - baselineCalls;
+
+        Nep17PayoutPlanner planner(client, sender);
+        planner.addTransfers(transfers);
+
+        std::vector<Nep17PayoutBatch> batches;
+        int planCalls = server.getCallCount();
+        double planning = measure([&]() { batches = planner.plan(); });
+        planCalls = server.getCallCount() - planCalls;
+
+        planner.setThreads(1);
+        double signSingle = measure([&]() { planner.sign(batches); });
+        planner.setThreads(threads);
+        double signParallel = measure([&]() { planner.sign(batches); });
+
+        std::cout << "NEP-17 bulk payout (" << count << " recipients, " << threads << " threads)" << std::endl;
+        std::cout << "  one tx per recipient:           " << baselineCount / baseline << " transfers/sec, "
+                  << static_cast<double>(baselineCalls) / baselineCount << " RPC calls/transfer" << std::endl;
+        std::cout << "  planner transactions:           " << batches.size() << " ("
+                  << static_cast<double>(count) / batches.size() << " transfers/tx)" << std::endl;
+        std::cout << "  plan:                           " << count / planning << " transfers/sec, "
+                  << planCalls << " RPC calls total" << std::endl;
+        std::cout << "  sign, 1 thread:                 " << batches.size() / signSingle << " tx/sec" << std::endl;
+        std::cout << "  sign, all threads:              " << batches.size() / signParallel << " tx/sec" << std::endl;
+        std::cout << "  plan + sign:                    " << count / (planning + signParallel) << " transfers/sec" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+#else
+
+int main() {
+    std::cerr << "nep17_payout_benchmark requires libcurl" << std::endl;
+    return 1;
+}
+
+#endif
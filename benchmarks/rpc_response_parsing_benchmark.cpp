@@ -0,0 +1,197 @@
+#include <neocpp/neocpp.hpp>
+#include <neocpp/protocol/response_types_impl.hpp>
+#include <neocpp/protocol/rpc_response_reader.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+using namespace neocpp;
+
+template<typename Fn>
+double measure(Fn fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+/// Hex text of n pseudo-random bytes
+static std::string hexOf(size_t n, uint32_t seed) {
+    Bytes bytes(n);
+    for (size_t i = 0; i < n; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        bytes[i] = static_cast<uint8_t>(seed >> 16);
+    }
+    return Hex::encode(bytes);
+}
+
+/// A verbose getblock response shaped like a busy MainNet block
+static std::string blockBody(size_t transactions) {
+    nlohmann::json witness = {{"invocation", Base64::encode(Hex::decode(hexOf(66, 1)))},
+                              {"verification", Base64::encode(Hex::decode(hexOf(40, 2)))}};
+    nlohmann::json txs = nlohmann::json::array();
+    for (size_t i = 0; i < transactions; ++i) {
+        uint32_t seed = static_cast<uint32_t>(i) + 100;
+        txs.push_back({
+            {"hash", "0x" + hexOf(32, seed)},
+            {"size", 250 + i % 100},
+            {"version", 0},
+            {"nonce", seed * 7919u},
+            {"sender", "NaZjSxmRZ4ErG2QEXCQMjjJfYAxcbN9b1e"},
+            {"sysfee", std::to_string(997780 + i)},
+            {"netfee", std::to_string(124845 + i)},
+            {"validuntilblock", 2105487 + i},
+            {"signers", {{{"account", "0x" + hexOf(20, seed)}, {"scopes", "CalledByEntry"}}}},
+            {"attributes", nlohmann::json::array()},
+            {"script", Base64::encode(Hex::decode(hexOf(96, seed)))},
+            {"witnesses", {witness}}
+        });
+    }
+    nlohmann::json result = {
+        {"hash", "0x" + hexOf(32, 3)},
+        {"size", 250 * transactions},
+        {"version", 0},
+        {"previousblockhash", "0x" + hexOf(32, 4)},
+        {"merkleroot", "0x" + hexOf(32, 5)},
+        {"time", 1627896461306ULL},
+        {"nonce", "7FC63D71C7C5B4D7"},
+        {"index", 2105482},
+        {"primary", 3},
+        {"nextconsensus", "NgPkjjLTNcQad99iRYeXRUuowE4gxLAnDL"},
+        {"witnesses", {witness}},
+        {"tx", txs},
+        {"confirmations", 7},
+        {"nextblockhash", "0x" + hexOf(32, 6)}
+    };
+    return nlohmann::json{{"jsonrpc", "2.0"}, {"id", 1}, {"result", result}}.dump();
+}
+
+/// A getapplicationlog response for a batch payout emitting many Transfer events
+static std::string applicationLogBody(size_t notifications) {
+    nlohmann::json events = nlohmann::json::array();
+    for (size_t i = 0; i < notifications; ++i) {
+        uint32_t seed = static_cast<uint32_t>(i) + 1000;
+        events.push_back({
+            {"contract", "0xd2a4cff31913016155e38e474a2c06d08be276cf"},
+            {"eventname", "Transfer"},
+            {"state", {{"type", "Array"}, {"value", {
+                {{"type", "ByteString"}, {"value", Base64::encode(Hex::decode(hexOf(20, 7)))}},
+                {{"type", "ByteString"}, {"value", Base64::encode(Hex::decode(hexOf(20, seed)))}},
+                {{"type", "Integer"}, {"value", std::to_string(100000000 + i)}}
+            }}}}
+        });
+    }
+    nlohmann::json result = {
+        {"txid", "0x" + hexOf(32, 8)},
+        {"executions", {{
+            {"trigger", "Application"},
+            {"vmstate", "HALT"},
+            {"exception", nullptr},
+            {"gasconsumed", "912345670"},
+            {"stack", nlohmann::json::array()},
+            {"notifications", events}
+        }}}
+    };
+    return nlohmann::json{{"jsonrpc", "2.0"}, {"id", 1}, {"result", result}}.dump();
+}
+
+/// An invokefunction response returning an iterator page of NFT entries:
+/// Array of Struct{token id, owner, properties Map}
+static std::string invokeBody(size_t entries) {
+    nlohmann::json items = nlohmann::json::array();
+    for (size_t i = 0; i < entries; ++i) {
+        std::string id = hexOf(8, static_cast<uint32_t>(i) + 2000);
+        items.push_back({{"type", "Struct"}, {"value", {
+            {{"type", "ByteString"}, {"value", id}},
+            {{"type", "ByteString"}, {"value", hexOf(20, 9)}},
+            {{"type", "Map"}, {"value", {
+                {{"key", {{"type", "ByteString"}, {"value", "6e616d65"}}}, {"value", {{"type", "ByteString"}, {"value", id}}}},
+                {{"key", {{"type", "ByteString"}, {"value", "72616e6b"}}}, {"value", {{"type", "Integer"}, {"value", std::to_string(i)}}}}
+            }}}
+        }}});
+    }
+    nlohmann::json result = {
+        {"script", Base64::encode(Hex::decode(hexOf(64, 10)))},
+        {"state", "HALT"},
+        {"gasconsumed", "48327310"},
+        {"exception", nullptr},
+        {"notifications", nlohmann::json::array()},
+        {"stack", {{{"type", "Array"}, {"value", items}}}}
+    };
+    return nlohmann::json{{"jsonrpc", "2.0"}, {"id", 1}, {"result", result}}.dump();
+}
+
+/// The previous decoding path: a tree of the whole body, a copy of its result, then
+/// parseJson copying members out of that
+template<typename Response>
+static std::shared_ptr<Response> treeDecode(const std::string& body) {
+    nlohmann::json response = nlohmann::json::parse(body);
+    if (response.contains("error")) {
+        throw RpcException("RPC error");
+    }
+    nlohmann::json result = response["result"];
+    auto typed = std::make_shared<Response>();
+    typed->parseJson(result);
+    return typed;
+}
+
+template<typename Response, typename Check>
+static void compare(const std::string& name, const std::string& body, size_t iterations, size_t& checksum, Check check) {
+    std::cout << "  " << name << " (" << body.size() / 1024 << " KiB body)" << std::endl;
+    double tree = measure([&]() {
+        for (size_t i = 0; i < iterations; ++i) {
+            checksum += check(*treeDecode<Response>(body));
+        }
+    });
+    double streamed = measure([&]() {
+        for (size_t i = 0; i < iterations; ++i) {
+            auto typed = std::make_shared<Response>();
+            typed->parseResponse(body);
+            checksum += check(*typed);
+        }
+    });
+    double streamedRaw = measure([&]() {
+        for (size_t i = 0; i < iterations; ++i) {
+            auto typed = std::make_shared<Response>();
+            typed->parseResponse(body);
+            checksum += check(*typed) + typed->getRawJson().size();
+        }
+    });
+    auto report = [&](const std::string& label, double seconds) {
+        std::cout << "    " << label << std::string(label.size() < 34 ? 34 - label.size() : 1, ' ')
+                  << seconds / iterations * 1e3 << " ms/response, "
+                  << body.size() * iterations / seconds / 1e6 << " MB/s" << std::endl;
+    };
+    report("json tree + parseJson", tree);
+    report("parseResponse (SAX)", streamed);
+    report("parseResponse + getRawJson", streamedRaw);
+}
+
+int main(int argc, char* argv[]) {
+    size_t iterations = argc > 1 ? static_cast<size_t>(std::strtoul(argv[1], nullptr, 10)) : 20;
+
+    try {
+        // Keep results observable so the loops are not optimized away
+        size_t checksum = 0;
+
+        std::cout << "RPC response decoding (" << iterations << " iterations)" << std::endl;
+        compare<NeoGetBlockResponse>("getblock, 2000 transactions", blockBody(2000), iterations, checksum,
+            [](const NeoGetBlockResponse& block) { return block.getTransactions().size() + block.getIndex(); });
+        compare<NeoGetApplicationLogResponse>("getapplicationlog, 5000 notifications", applicationLogBody(5000),
+            iterations, checksum,
+            [](const NeoGetApplicationLogResponse& log) { return log.getExecutions().size() + log.getTxId().size(); });
+        compare<NeoInvokeResultResponse>("invokefunction, 10000-entry stack", invokeBody(10000), iterations, checksum,
+            [](const NeoInvokeResultResponse& invocation) {
+                StackItemView page = invocation.getStackViews()[0];
+                return page.size() + page.at(page.size() - 1).at(0).getBytes().size();
+            });
+
+        std::cout << "  (checksum " << checksum << ")" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
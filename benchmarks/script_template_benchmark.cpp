@@ -0,0 +1,114 @@
+#include <neocpp/neocpp.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+using namespace neocpp;
+
+template<typename Fn>
+double measure(Fn fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+int main(int argc, char* argv[]) {
+    size_t count = argc > 1 ? static_cast<size_t>(std::strtoul(argv[1], nullptr, 10)) : 1000000;
+
+    using Argument = ScriptTemplate::Argument;
+    using SlotType = ScriptTemplate::SlotType;
+
+    try {
+        Hash160 token("d2a4cff31913016155e38e474a2c06d08be276cf");
+        Hash160 nns("50ac1c37690cc2cfc594472833cf57505d5f46de");
+        Hash160 from("23ba2703c53263e8d6e522dc32203339dcd8eee9");
+        std::vector<Hash160> recipients;
+        for (size_t i = 0; i < 256; ++i) {
+            Bytes bytes(20, static_cast<uint8_t>(i));
+            recipients.emplace_back(bytes);
+        }
+
+        // Keep results observable so the loops are not optimized away
+        size_t checksum = 0;
+
+        // NEP-17 transfer(from, to, amount, data)
+        double transferBuilder = measure([&]() {
+            for (size_t i = 0; i < count; ++i) {
+                ScriptBuilder builder;
+                builder.callContract(token, "transfer", {
+                    ContractParameter::hash160(from),
+                    ContractParameter::hash160(recipients[i & 0xFF]),
+                    ContractParameter::integer(static_cast<int64_t>(i)),
+                    ContractParameter::string("")
+                });
+                checksum += builder.toArray().size();
+            }
+        });
+
+        auto transfer = ScriptTemplate::contractCall(token, "transfer", {
+            Argument::constant(ContractParameter::hash160(from)),
+            Argument::slot("to", SlotType::HASH160),
+            Argument::slot("amount", SlotType::INTEGER),
+            Argument::constant(ContractParameter::string(""))
+        });
+        size_t toSlot = transfer.getSlotIndex("to");
+        size_t amountSlot = transfer.getSlotIndex("amount");
+        double transferTemplate = measure([&]() {
+            auto values = transfer.newValues();
+            Bytes script;
+            for (size_t i = 0; i < count; ++i) {
+                values.setHash160(toSlot, recipients[i & 0xFF])
+                      .setInteger(amountSlot, static_cast<int64_t>(i));
+                transfer.instantiate(values, script);
+                checksum += script.size();
+            }
+        });
+
+        // NNS setRecord(name, type, data)
+        std::vector<std::string> names;
+        for (size_t i = 0; i < 256; ++i) {
+            names.push_back("host" + std::to_string(i) + ".example.neo");
+        }
+        double recordBuilder = measure([&]() {
+            for (size_t i = 0; i < count; ++i) {
+                ScriptBuilder builder;
+                builder.callContract(nns, "setRecord", {
+                    ContractParameter::string(names[i & 0xFF]),
+                    ContractParameter::integer(1),
+                    ContractParameter::string("10.0.0." + std::to_string(i & 0xFF))
+                });
+                checksum += builder.toArray().size();
+            }
+        });
+
+        auto setRecord = ScriptTemplate::contractCall(nns, "setRecord", {
+            Argument::slot("name", SlotType::STRING),
+            Argument::constant(ContractParameter::integer(1)),
+            Argument::slot("data", SlotType::STRING)
+        });
+        size_t nameSlot = setRecord.getSlotIndex("name");
+        size_t dataSlot = setRecord.getSlotIndex("data");
+        double recordTemplate = measure([&]() {
+            auto values = setRecord.newValues();
+            Bytes script;
+            for (size_t i = 0; i < count; ++i) {
+                values.setString(nameSlot, names[i & 0xFF])
+                      .setString(dataSlot, "10.0.0." + std::to_string(i & 0xFF));
+                setRecord.instantiate(values, script);
+                checksum += script.size();
+            }
+        });
+
+        std::cout << "Script templates (" << count << " scripts, checksum " << checksum << ")" << std::endl;
+        std::cout << "  NEP-17 transfer, ScriptBuilder:  " << count / transferBuilder << " scripts/sec" << std::endl;
+        std::cout << "  NEP-17 transfer, template:       " << count / transferTemplate << " scripts/sec" << std::endl;
+        std::cout << "  NNS setRecord, ScriptBuilder:    " << count / recordBuilder << " scripts/sec" << std::endl;
+        std::cout << "  NNS setRecord, template:         " << count / recordTemplate << " scripts/sec" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
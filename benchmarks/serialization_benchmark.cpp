@@ -0,0 +1,127 @@
+#include <neocpp/neocpp.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+using namespace neocpp;
+
+template<typename Fn>
+double measure(Fn fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+static void report(const std::string& name, size_t count, double seconds) {
+    std::cout << "  " << name << std::string(name.size() < 34 ? 34 - name.size() : 1, ' ')
+              << count / seconds / 1e6 << " M ops/sec" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    size_t count = argc > 1 ? static_cast<size_t>(std::strtoul(argv[1], nullptr, 10)) : 1000000;
+
+    try {
+        // Keep results observable so the loops are not optimized away
+        size_t checksum = 0;
+
+        std::cout << "Serialization (" << count << " iterations)" << std::endl;
+
+        // Var-ints across all four encodings
+        const uint64_t varInts[] = {0x10, 0xFC, 0xFD, 0x1234, 0xFFFF, 0x10000, 0x12345678, 0x100000000ULL};
+        BinaryWriter varIntWriter;
+        varIntWriter.reserve(count * 5);
+        report("writeVarInt", count, measure([&]() {
+            for (size_t i = 0; i < count; ++i) {
+                varIntWriter.writeVarInt(varInts[i & 7]);
+            }
+            checksum += varIntWriter.size();
+        }));
+        Bytes varIntBytes = varIntWriter.toArray();
+        report("readVarInt", count, measure([&]() {
+            auto reader = BinaryReader::borrow(varIntBytes);
+            for (size_t i = 0; i < count; ++i) {
+                checksum += reader.readVarInt();
+            }
+        }));
+
+        // Fixed-width integers
+        BinaryWriter intWriter;
+        intWriter.reserve(count * 14);
+        report("writeUInt16/32/64", count, measure([&]() {
+            for (size_t i = 0; i < count; ++i) {
+                intWriter.writeUInt16(static_cast<uint16_t>(i));
+                intWriter.writeUInt32(static_cast<uint32_t>(i));
+                intWriter.writeInt64(static_cast<int64_t>(i));
+            }
+            checksum += intWriter.size();
+        }));
+        Bytes intBytes = intWriter.toArray();
+        report("readUInt16/32/64", count, measure([&]() {
+            auto reader = BinaryReader::borrow(intBytes);
+            for (size_t i = 0; i < count; ++i) {
+                checksum += reader.readUInt16() + reader.readUInt32() + static_cast<size_t>(reader.readInt64());
+            }
+        }));
+
+        // Single-signature witness
+        auto account = Account::create();
+        Witness witness(Bytes(66, 0x0C), account->getVerificationScript());
+        report("Witness::serialize", count, measure([&]() {
+            BinaryWriter writer;
+            for (size_t i = 0; i < count; ++i) {
+                writer.clear();
+                witness.serialize(writer);
+                checksum += writer.size();
+            }
+        }));
+        Bytes witnessBytes = witness.toArray();
+        report("Witness::deserialize", count, measure([&]() {
+            for (size_t i = 0; i < count; ++i) {
+                BinaryReader reader(witnessBytes.data(), witnessBytes.size());
+                checksum += Witness::deserialize(reader)->getSize();
+            }
+        }));
+
+        // Signed NEP-17-sized transaction, serialized without the encoding cache
+        Transaction tx;
+        tx.setSystemFee(997770);
+        tx.setNetworkFee(122452);
+        tx.setValidUntilBlock(5000000);
+        tx.setScript(Bytes(96, 0x0C));
+        tx.addSigner(std::make_shared<Signer>(account->getScriptHash()));
+        tx.sign(account);
+        size_t txCount = count / 4;
+        report("Transaction::serialize", txCount, measure([&]() {
+            BinaryWriter writer;
+            for (size_t i = 0; i < txCount; ++i) {
+                writer.clear();
+                tx.serialize(writer);
+                checksum += writer.size();
+            }
+        }));
+        report("Transaction::serializeUnsigned", txCount, measure([&]() {
+            BinaryWriter writer;
+            for (size_t i = 0; i < txCount; ++i) {
+                writer.clear();
+                tx.serializeUnsigned(writer);
+                checksum += writer.size();
+            }
+        }));
+        Bytes txBytes = tx.toArray();
+        report("Transaction::deserialize", txCount, measure([&]() {
+            for (size_t i = 0; i < txCount; ++i) {
+                auto reader = BinaryReader::borrow(txBytes);
+                checksum += Transaction::deserialize(reader)->getNonce();
+            }
+        }));
+
+        std::cout << "  (checksum " << checksum << ")" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,86 @@
+#include <neocpp/neocpp.hpp>
+#include <neocpp/transaction/transaction_builder.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+using namespace neocpp;
+
+template<typename Fn>
+double measure(Fn fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+/// The previous ordering: hex-string comparison and a script hash per signer/witness pair
+static size_t legacyOrder(std::vector<SharedPtr<Signer>> signers, const std::vector<SharedPtr<Witness>>& witnesses) {
+    std::sort(signers.begin(), signers.end(),
+        [](const SharedPtr<Signer>& a, const SharedPtr<Signer>& b) {
+            if (a->getScopes() != b->getScopes()) {
+                return a->getScopes() < b->getScopes();
+            }
+            return a->getAccount().toString() < b->getAccount().toString();
+        });
+
+    std::vector<SharedPtr<Witness>> sortedWitnesses;
+    for (const auto& signer : signers) {
+        for (const auto& witness : witnesses) {
+            if (Hash160::fromScript(witness->getVerificationScript()) == signer->getAccount()) {
+                sortedWitnesses.push_back(witness);
+                break;
+            }
+        }
+    }
+    return sortedWitnesses.size();
+}
+
+int main(int argc, char* argv[]) {
+    size_t signerCount = argc > 1 ? static_cast<size_t>(std::strtoul(argv[1], nullptr, 10)) : 16;
+    size_t iterations = argc > 2 ? static_cast<size_t>(std::strtoul(argv[2], nullptr, 10)) : 2000;
+
+    try {
+        // Signers with mixed scopes, witnesses in reverse order
+        TransactionBuilder builder;
+        std::vector<SharedPtr<Account>> accounts;
+        for (size_t i = 0; i < signerCount; ++i) {
+            accounts.push_back(Account::create());
+            auto scope = i % 2 == 0 ? WitnessScope::CALLED_BY_ENTRY : WitnessScope::GLOBAL;
+            builder.addSigner(std::make_shared<Signer>(accounts.back()->getScriptHash(), scope));
+        }
+        for (auto it = accounts.rbegin(); it != accounts.rend(); ++it) {
+            builder.addWitness(Witness::fromSignature(Bytes(64, 0x01), (*it)->getKeyPair()->getPublicKey()->getEncoded()));
+        }
+        auto signers = builder.getTransaction()->getSigners();
+        auto witnesses = builder.getTransaction()->getWitnesses();
+
+        // Keep results observable so the loops are not optimized away
+        size_t checksum = 0;
+
+        double legacySeconds = measure([&]() {
+            for (size_t i = 0; i < iterations; ++i) {
+                checksum += legacyOrder(signers, witnesses);
+            }
+        });
+        double builderSeconds = measure([&]() {
+            for (size_t i = 0; i < iterations; ++i) {
+                builder.sortSignersAndWitnesses();
+                checksum += builder.getTransaction()->getWitnesses().size();
+            }
+        });
+
+        std::cout << "Signer/witness ordering (" << signerCount << " signers, " << iterations
+                  << " iterations, checksum " << checksum << ")" << std::endl;
+        std::cout << "  String compare + nested scan: " << iterations / legacySeconds << " orderings/sec" << std::endl;
+        std::cout << "  sortSignersAndWitnesses:      " << iterations / builderSeconds << " orderings/sec ("
+                  << legacySeconds / builderSeconds << "x)" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
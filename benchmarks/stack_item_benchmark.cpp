@@ -0,0 +1,84 @@
+#include <neocpp/neocpp.hpp>
+#include <neocpp/protocol/stack_item_arena.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+using namespace neocpp;
+
+template<typename Fn>
+double measure(Fn fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+/// An iterator page of NFT entries: Array of Struct{token id, owner, properties Map}
+static nlohmann::json nftPage(size_t entries) {
+    nlohmann::json items = nlohmann::json::array();
+    for (size_t i = 0; i < entries; ++i) {
+        std::string id = Hex::encode(ByteUtils::fromInt64LE(static_cast<int64_t>(i)));
+        items.push_back({{"type", "Struct"}, {"value", {
+            {{"type", "ByteString"}, {"value", id}},
+            {{"type", "ByteString"}, {"value", "d2a4cff31913016155e38e474a2c06d08be276cf"}},
+            {{"type", "Map"}, {"value", {
+                {{"key", {{"type", "ByteString"}, {"value", "6e616d65"}}}, {"value", {{"type", "ByteString"}, {"value", id}}}},
+                {{"key", {{"type", "ByteString"}, {"value", "72616e6b"}}}, {"value", {{"type", "Integer"}, {"value", std::to_string(i)}}}}
+            }}}
+        }}});
+    }
+    return {{"type", "Array"}, {"value", items}};
+}
+
+int main(int argc, char* argv[]) {
+    size_t iterations = argc > 1 ? static_cast<size_t>(std::strtoul(argv[1], nullptr, 10)) : 20;
+    const size_t entries = 10000;
+
+    try {
+        // Keep results observable so the loops are not optimized away
+        size_t checksum = 0;
+        nlohmann::json page = nftPage(entries);
+
+        std::cout << "Stack items: " << entries << "-entry NFT page (" << iterations << " iterations)" << std::endl;
+        auto report = [&](const std::string& label, double seconds) {
+            std::cout << "    " << label << std::string(label.size() < 34 ? 34 - label.size() : 1, ' ')
+                      << seconds / iterations * 1e3 << " ms/page" << std::endl;
+        };
+
+        report("StackItem::fromJson + getArray", measure([&]() {
+            for (size_t i = 0; i < iterations; ++i) {
+                StackItemPtr root = StackItem::fromJson(page);
+                for (const auto& entry : root->getArray()) {
+                    auto fields = entry->getArray();
+                    checksum += fields[0]->getByteArray().size() + fields[2]->getMap().size();
+                }
+            }
+        }));
+        report("StackItemArena::add + views", measure([&]() {
+            for (size_t i = 0; i < iterations; ++i) {
+                StackItemArena arena;
+                StackItemView root = arena.add(page);
+                for (size_t e = 0; e < root.size(); ++e) {
+                    StackItemView entry = root.at(e);
+                    checksum += entry.at(0).getBytes().size() + entry.at(2).size();
+                }
+            }
+        }));
+        StackItemArena arena;
+        report("StackItemView::toStackItem", measure([&]() {
+            for (size_t i = 0; i < iterations; ++i) {
+                arena.clear();
+                checksum += arena.add(page).toStackItem()->getArray().size();
+            }
+        }));
+
+        std::cout << "  (checksum " << checksum << ")" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
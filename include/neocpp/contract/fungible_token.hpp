@@ -1,6 +1,7 @@
 #pragma once
 
 #include "neocpp/contract/smart_contract.hpp"
+#include "neocpp/types/big_integer.hpp"
 #include <string>
 
 namespace neocpp {
@@ -30,13 +31,13 @@ public:
     [[nodiscard]] int getDecimals();
 
     /// Get total supply
-    /// @return The total supply
-    [[nodiscard]] int64_t getTotalSupply();
+    /// @return The total supply in the smallest unit, up to 256 bits
+    [[nodiscard]] BigInteger getTotalSupply();
 
     /// Get balance of an address
     /// @param address The address
-    /// @return The balance
-    [[nodiscard]] int64_t getBalanceOf(const std::string& address);
+    /// @return The balance in the smallest unit, up to 256 bits
+    [[nodiscard]] BigInteger getBalanceOf(const std::string& address);
 
     /// Transfer tokens
     /// @param from The sender account
@@ -46,7 +47,7 @@ public:
     /// @return Transaction builder
     SharedPtr<TransactionBuilder> transfer(const SharedPtr<Account>& from,
                                           const std::string& to,
-                                          int64_t amount,
+                                          const BigInteger& amount,
                                           const std::string& data = "");
 
     /// Transfer tokens with multiple recipients
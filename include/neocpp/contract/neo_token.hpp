@@ -42,8 +42,8 @@ public:
     /// @return List of candidates with votes
     std::vector<nlohmann::json> getCandidates();
 
-    /// Get committee members
-    /// @return List of committee member public keys
+    /// Get committee members. Cached by the client's ChainStateCache until the next committee epoch.
+    /// @return Hex-encoded committee member public keys
     std::vector<std::string> getCommittee();
 
     /// Get next block validators
@@ -18,11 +18,11 @@ public:
     /// Create instance
     static SharedPtr<PolicyContract> create(const SharedPtr<NeoRpcClient>& client);
 
-    /// Get fee per byte
+    /// Get fee per byte. Cached by the client's ChainStateCache until the next block.
     /// @return The fee per byte
     [[nodiscard]] int64_t getFeePerByte();
 
-    /// Get execution fee factor
+    /// Get execution fee factor. Cached by the client's ChainStateCache until the next block.
     /// @return The execution fee factor
     [[nodiscard]] int32_t getExecFeeFactor();
 
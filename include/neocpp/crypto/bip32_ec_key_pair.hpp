@@ -7,13 +7,19 @@
 
 namespace neocpp {
 
+class Hash160;
+class Bip32ExtendedPublicKey;
+
 /// BIP32 hierarchical deterministic key pair
 class Bip32ECKeyPair : public ECKeyPair {
 private:
+    struct DerivationCache;
+
     Bytes chainCode_;
     uint32_t depth_;
     uint32_t parentFingerprint_;
     uint32_t childNumber_;
+    SharedPtr<DerivationCache> derivationCache_;
 
 public:
     /// Generate master key from seed
@@ -38,6 +44,25 @@ public:
     /// @return The derived key pair
     SharedPtr<Bip32ECKeyPair> derivePath(const std::string& path);
 
+    /// Derive key from a pre-parsed path
+    /// Intermediate (parent) nodes are cached on this key, so deriving many siblings
+    /// such as m/44'/888'/0'/0/i only derives the shared prefix once.
+    /// @param indices The child indices, hardened ones with bit 31 set (see parsePath)
+    /// @return The derived key pair
+    SharedPtr<Bip32ECKeyPair> derivePath(const std::vector<uint32_t>& indices);
+
+    /// Parse a derivation path into child indices
+    /// @param path The derivation path (e.g., "m/44'/888'/0'/0/0")
+    /// @return The child indices, hardened ones with bit 31 set
+    static std::vector<uint32_t> parsePath(const std::string& path);
+
+    /// Drop all cached intermediate nodes held for derivePath
+    void clearDerivationCache();
+
+    /// Get the public-only extended key for this node
+    /// @return The extended public key
+    SharedPtr<Bip32ExtendedPublicKey> getExtendedPublicKey() const;
+
     /// Get the chain code
     /// @return The chain code
     const Bytes& getChainCode() const { return chainCode_; }
@@ -72,4 +97,90 @@ public:
                    uint32_t depth, uint32_t parentFingerprint, uint32_t childNumber);
 };
 
+/// BIP32 extended public key (xpub)
+/// Supports non-hardened child derivation without access to any private key, which is
+/// what deposit address generation on watch-only services needs.
+class Bip32ExtendedPublicKey {
+private:
+    Bytes publicKey_;
+    Bytes chainCode_;
+    uint32_t depth_;
+    uint32_t parentFingerprint_;
+    uint32_t childNumber_;
+
+public:
+    /// Constructor
+    /// @param encodedPublicKey The compressed public key (33 bytes)
+    /// @param chainCode The chain code (32 bytes)
+    Bip32ExtendedPublicKey(const Bytes& encodedPublicKey, const Bytes& chainCode,
+                           uint32_t depth, uint32_t parentFingerprint, uint32_t childNumber);
+
+    /// Import from extended public key
+    /// @param xpub The extended public key string
+    /// @return The extended public key
+    static SharedPtr<Bip32ExtendedPublicKey> fromExtendedPublicKey(const std::string& xpub);
+
+    /// Derive a non-hardened child key
+    /// @param index The child index (must be below 2^31)
+    /// @return The child extended public key
+    SharedPtr<Bip32ExtendedPublicKey> deriveChild(uint32_t index) const;
+
+    /// Derive key from a path relative to this key (e.g., "M/0/5" or "0/5")
+    /// @param path The derivation path, which must not contain hardened segments
+    /// @return The derived extended public key
+    SharedPtr<Bip32ExtendedPublicKey> derivePath(const std::string& path) const;
+
+    /// Derive the script hashes of the children [start, start + count)
+    /// The range is split across worker threads; each child costs one HMAC-SHA512,
+    /// one point multiplication and one script hash.
+    /// @param start The first child index
+    /// @param count The number of children
+    /// @param threads The number of worker threads (0 = hardware concurrency)
+    /// @return The script hashes, in index order
+    std::vector<Hash160> deriveScriptHashes(uint32_t start, uint32_t count, unsigned int threads = 0) const;
+
+    /// Derive the addresses of the children [start, start + count)
+    /// @param start The first child index
+    /// @param count The number of children
+    /// @param threads The number of worker threads (0 = hardware concurrency)
+    /// @return The addresses, in index order
+    std::vector<std::string> deriveAddresses(uint32_t start, uint32_t count, unsigned int threads = 0) const;
+
+    /// Get the public key
+    /// @return The public key
+    SharedPtr<ECPublicKey> getPublicKey() const;
+
+    /// Get the compressed public key bytes
+    /// @return The encoded public key
+    const Bytes& getEncodedPublicKey() const { return publicKey_; }
+
+    /// Get the chain code
+    /// @return The chain code
+    const Bytes& getChainCode() const { return chainCode_; }
+
+    /// Get the depth
+    /// @return The depth in derivation path
+    [[nodiscard]] uint32_t getDepth() const { return depth_; }
+
+    /// Get the parent fingerprint
+    /// @return The parent fingerprint
+    [[nodiscard]] uint32_t getParentFingerprint() const { return parentFingerprint_; }
+
+    /// Get the child number
+    /// @return The child number
+    [[nodiscard]] uint32_t getChildNumber() const { return childNumber_; }
+
+    /// Get the script hash of this key's single-signature account
+    /// @return The script hash
+    [[nodiscard]] Hash160 getScriptHash() const;
+
+    /// Get the address of this key's single-signature account
+    /// @return The Neo address
+    std::string getAddress() const;
+
+    /// Export as extended public key
+    /// @return The extended public key string
+    std::string toExtendedPublicKey() const;
+};
+
 } // namespace neocpp
@@ -3,7 +3,10 @@
 #include <string>
 #include <vector>
 #include <array>
+#include <mutex>
 #include <random>
+#include <string_view>
+#include <utility>
 #include "neocpp/types/types.hpp"
 
 namespace neocpp {
@@ -61,6 +64,15 @@ public:
     static Bytes mnemonicToSeed(const std::string& mnemonic,
                                 const std::string& passphrase = "");
 
+    /// Convert many mnemonics to seeds, running PBKDF2-SHA512 across worker threads
+    /// @param mnemonics The mnemonic phrases
+    /// @param passphrase Optional passphrase applied to every mnemonic
+    /// @param threads The number of worker threads (0 = hardware concurrency)
+    /// @return The seeds (64 bytes each), in input order
+    static std::vector<Bytes> mnemonicToSeedBatch(const std::vector<std::string>& mnemonics,
+                                                  const std::string& passphrase = "",
+                                                  unsigned int threads = 0);
+
     /// Convert mnemonic to entropy
     /// @param mnemonic The mnemonic phrase
     /// @param language The word list language
@@ -73,6 +85,12 @@ public:
     /// @return The word list
     static const std::vector<std::string>& getWordList(Language language = Language::ENGLISH);
 
+    /// Look up the position of a word in a word list
+    /// @param word The word
+    /// @param language The word list language
+    /// @return The word index (0-2047), or -1 if the word is not in the list
+    static int getWordIndex(std::string_view word, Language language = Language::ENGLISH);
+
     /// Split mnemonic into words
     /// @param mnemonic The mnemonic phrase
     /// @return The words
@@ -93,9 +111,31 @@ private:
     /// Load word list for language
     static void loadWordList(Language language);
 
+    /// Resolve the word indices of a mnemonic
+    /// @param mnemonic The mnemonic phrase
+    /// @param language The word list language
+    /// @param strict Require words separated by exactly one space
+    /// @param indices Receives the 11-bit word indices
+    /// @param unknownWord Receives the first unknown word, if any
+    /// @return False if the phrase is malformed or contains an unknown word
+    static bool lookupWords(const std::string& mnemonic, Language language, bool strict,
+                            std::vector<uint16_t>& indices, std::string* unknownWord);
+
+    /// Pack 11-bit word indices into entropy bytes and verify the trailing checksum
+    /// @param indices The word indices (a multiple of 3, at most 24)
+    /// @param entropy Receives the entropy bytes
+    /// @return True if the checksum matches
+    static bool packEntropy(const std::vector<uint16_t>& indices, Bytes& entropy);
+
     /// Word lists cache
     static std::vector<std::vector<std::string>> wordLists_;
 
+    /// Sorted (word, index) pairs per language, built with the word list
+    static std::vector<std::vector<std::pair<std::string_view, uint16_t>>> wordIndexes_;
+
+    /// Guards one-time loading of each word list
+    static std::array<std::once_flag, 9> loadFlags_;
+
     /// English word list (2048 words)
     static const std::array<const char*, 2048> ENGLISH_WORDS;
 };
@@ -13,6 +13,12 @@ public:
     /// @return The SHA256 hash (32 bytes)
     static Bytes sha256(const Bytes& data);
 
+    /// Compute SHA256 hash into a caller buffer
+    /// @param data The data to hash
+    /// @param size The data length
+    /// @param out Receives the 32-byte hash
+    static void sha256(const uint8_t* data, size_t size, uint8_t* out);
+
     /// Compute double SHA256 hash (SHA256(SHA256(data)))
     /// @param data The data to hash
     /// @return The double SHA256 hash (32 bytes)
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace neocpp {
+
+/// Log levels for the logger
+enum class LogLevel {
+    TRACE = 0,
+    DEBUG = 1,
+    INFO = 2,
+    WARN = 3,
+    ERROR = 4,
+    FATAL = 5,
+    OFF = 6
+};
+
+/// Structured key/value pairs attached to a log record
+using LogFields = std::vector<std::pair<std::string, std::string>>;
+
+/// One log call as handed to sinks
+struct LogRecord {
+    LogLevel level = LogLevel::INFO;
+    std::chrono::system_clock::time_point time;
+    std::string message;
+    LogFields fields;
+    const char* file = nullptr;  // __FILE__ of the call site, or null
+    int line = 0;
+};
+
+/// Destination for log records.
+/// In synchronous mode write() may be called from several threads at once; with
+/// Logger::startAsync() only the background writer thread calls it.
+class LogSink {
+public:
+    virtual ~LogSink() = default;
+
+    /// Write one record
+    /// @param record The record to write
+    virtual void write(const LogRecord& record) = 0;
+
+    /// Flush buffered output
+    virtual void flush() {}
+
+    /// Format a record as one line without the trailing newline:
+    /// "[time] [LEVEL] [file:line] message key=value ..."
+    /// @param record The record to format
+    /// @param color Wrap the line in the ANSI color of its level
+    /// @return The formatted line
+    static std::string format(const LogRecord& record, bool color = false);
+};
+
+/// Writes to standard output, and ERROR and above to standard error (the default sink)
+class ConsoleLogSink : public LogSink {
+public:
+    /// @param stderrOnly Send every level to standard error
+    explicit ConsoleLogSink(bool stderrOnly = false);
+
+    void write(const LogRecord& record) override;
+    void flush() override;
+
+private:
+    bool stderrOnly_;
+    std::mutex mutex_;
+};
+
+/// Appends to a file, rolling it over to path.1 ... path.N once it would exceed a size limit
+class RotatingFileLogSink : public LogSink {
+public:
+    /// @param path The log file
+    /// @param maxBytes Size at which the file is rotated
+    /// @param maxBackups Number of rotated files kept (0 truncates in place)
+    /// @throws RuntimeException if the file cannot be opened
+    explicit RotatingFileLogSink(const std::string& path, size_t maxBytes = 10 * 1024 * 1024, size_t maxBackups = 5);
+
+    void write(const LogRecord& record) override;
+    void flush() override;
+
+private:
+    void rotate();
+
+    std::string path_;
+    size_t maxBytes_;
+    size_t maxBackups_;
+    size_t size_ = 0;
+    std::ofstream out_;
+    std::mutex mutex_;
+};
+
+/// Hands every record to a user callback
+class CallbackLogSink : public LogSink {
+public:
+    using Callback = std::function<void(const LogRecord&)>;
+
+    /// @param callback Called once per record; must be thread-safe in synchronous mode
+    explicit CallbackLogSink(Callback callback);
+
+    void write(const LogRecord& record) override;
+
+private:
+    Callback callback_;
+};
+
+} // namespace neocpp
@@ -1,119 +1,103 @@
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <string>
-#include <iostream>
-#include <sstream>
-#include <chrono>
-#include <iomanip>
-#include <mutex>
+#include <vector>
+#include "neocpp/log_sink.hpp"
+
+/// Log calls below this level are compiled out by the LOG_* macros (0 = TRACE ... 6 = OFF).
+/// Set it with -DNEOCPP_LOG_MIN_LEVEL=<n> or the NEOCPP_LOG_MIN_LEVEL CMake cache variable.
+#ifndef NEOCPP_LOG_MIN_LEVEL
+#define NEOCPP_LOG_MIN_LEVEL 0
+#endif
 
 namespace neocpp {
 
-/// Log levels for the logger
-enum class LogLevel {
-    TRACE = 0,
-    DEBUG = 1,
-    INFO = 2,
-    WARN = 3,
-    ERROR = 4,
-    FATAL = 5,
-    OFF = 6
+/// What the asynchronous logger does when its queue is full
+enum class LogOverflowPolicy {
+    DROP,   ///< Discard the record and count it (see Logger::getDroppedCount)
+    BLOCK   ///< Wait until the writer thread has made room
+};
+
+/// Options for Logger::startAsync
+struct AsyncLogOptions {
+    size_t capacity = 8192;                                ///< Queued records, rounded up to a power of two
+    LogOverflowPolicy overflow = LogOverflowPolicy::DROP;  ///< Behavior when the queue is full
 };
 
-/// Simple thread-safe logger for the SDK
+/// Simple thread-safe logger for the SDK.
+/// Records go to the configured sinks (a ConsoleLogSink by default), either directly from
+/// the logging thread or, after startAsync(), through a lock-free queue drained by a
+/// background writer thread.
 class Logger {
 private:
-    static LogLevel currentLevel_;
-    static std::mutex logMutex_;
-    static bool colorEnabled_;
-
-    /// Get current timestamp string
-    static std::string getTimestamp() {
-        auto now = std::chrono::system_clock::now();
-        auto time_t = std::chrono::system_clock::to_time_t(now);
-        std::stringstream ss;
-        ss << std::put_time(std::localtime(&time_t), "%Y-%m-%d %H:%M:%S");
-        return ss.str();
-    }
-
-    /// Get color code for log level
-    static std::string getColor(LogLevel level) {
-        if (!colorEnabled_) return "";
-        switch (level) {
-            case LogLevel::TRACE: return "\033[37m";  // White
-            case LogLevel::DEBUG: return "\033[36m";  // Cyan
-            case LogLevel::INFO:  return "\033[32m";  // Green
-            case LogLevel::WARN:  return "\033[33m";  // Yellow
-            case LogLevel::ERROR: return "\033[31m";  // Red
-            case LogLevel::FATAL: return "\033[35m";  // Magenta
-            default: return "";
-        }
-    }
-
-    /// Reset color
-    static std::string resetColor() {
-        return colorEnabled_ ? "\033[0m" : "";
-    }
-
-    /// Get level string
-    static std::string getLevelString(LogLevel level) {
-        switch (level) {
-            case LogLevel::TRACE: return "TRACE";
-            case LogLevel::DEBUG: return "DEBUG";
-            case LogLevel::INFO:  return "INFO ";
-            case LogLevel::WARN:  return "WARN ";
-            case LogLevel::ERROR: return "ERROR";
-            case LogLevel::FATAL: return "FATAL";
-            default: return "UNKNOWN";
-        }
-    }
+    static std::atomic<LogLevel> currentLevel_;
+    static std::atomic<bool> colorEnabled_;
 
 public:
     /// Set the current log level
     static void setLevel(LogLevel level) {
-        currentLevel_ = level;
+        currentLevel_.store(level, std::memory_order_relaxed);
     }
 
     /// Get the current log level
     static LogLevel getLevel() {
-        return currentLevel_;
+        return currentLevel_.load(std::memory_order_relaxed);
+    }
+
+    /// Check whether a message at the given level would be written.
+    /// Lock-free, so the LOG_* macros test it before building the message.
+    static bool isEnabled(LogLevel level) {
+        return static_cast<int>(level) >= NEOCPP_LOG_MIN_LEVEL &&
+               level >= currentLevel_.load(std::memory_order_relaxed);
     }
 
     /// Enable/disable colored output
     static void setColorEnabled(bool enabled) {
-        colorEnabled_ = enabled;
+        colorEnabled_.store(enabled, std::memory_order_relaxed);
     }
 
-    /// Log a message at the specified level
-    static void log(LogLevel level, const std::string& message, const char* file = nullptr, int line = 0) {
-        if (level < currentLevel_) return;
-
-        std::lock_guard<std::mutex> lock(logMutex_);
-
-        std::stringstream ss;
-        ss << getColor(level)
-           << "[" << getTimestamp() << "] "
-           << "[" << getLevelString(level) << "] ";
-
-        if (file && line > 0) {
-            // Extract filename from path
-            std::string filename(file);
-            size_t lastSlash = filename.find_last_of("/\\");
-            if (lastSlash != std::string::npos) {
-                filename = filename.substr(lastSlash + 1);
-            }
-            ss << "[" << filename << ":" << line << "] ";
-        }
-
-        ss << message << resetColor();
-
-        if (level >= LogLevel::ERROR) {
-            std::cerr << ss.str() << std::endl;
-        } else {
-            std::cout << ss.str() << std::endl;
-        }
+    /// Check whether console output is colored
+    static bool isColorEnabled() {
+        return colorEnabled_.load(std::memory_order_relaxed);
     }
 
+    /// Replace the sinks records are written to
+    /// @param sinks The new sinks; empty restores the default console sink
+    static void setSinks(std::vector<std::shared_ptr<LogSink>> sinks);
+
+    /// Add a sink next to the current ones
+    /// @param sink The sink to add
+    static void addSink(std::shared_ptr<LogSink> sink);
+
+    /// Start writing records on a background thread
+    /// @param options Queue capacity and overflow policy
+    /// @throws IllegalArgumentException if the capacity is zero
+    /// @throws IllegalStateException if asynchronous logging is already running
+    static void startAsync(const AsyncLogOptions& options = AsyncLogOptions());
+
+    /// Write every queued record, stop the background thread and return to synchronous logging
+    static void stopAsync();
+
+    /// Check whether records are written on a background thread
+    static bool isAsync();
+
+    /// Wait until every record logged so far has been written, then flush the sinks
+    static void flush();
+
+    /// Number of records discarded because the asynchronous queue was full
+    static uint64_t getDroppedCount();
+
+    /// Log a message at the specified level
+    static void log(LogLevel level, const std::string& message, const char* file = nullptr, int line = 0);
+
+    /// Log a message with structured key/value fields
+    static void log(LogLevel level, const std::string& message, LogFields fields,
+                    const char* file = nullptr, int line = 0);
+
     /// Convenience methods
     static void trace(const std::string& msg, const char* file = nullptr, int line = 0) {
         log(LogLevel::TRACE, msg, file, line);
@@ -140,12 +124,56 @@ public:
     }
 };
 
+// Log with file and line information. The level is checked first, so the message
+// expression (e.g. a string concatenation) is only evaluated when it will be written.
+#define NEOCPP_LOG(level, msg) \
+    (neocpp::Logger::isEnabled(level) ? neocpp::Logger::log(level, (msg), __FILE__, __LINE__) : static_cast<void>(0))
+
+// Log with structured fields, e.g.
+// NEOCPP_LOG_FIELDS(neocpp::LogLevel::WARN, "Block callback error", {"block", std::to_string(index)})
+#define NEOCPP_LOG_FIELDS(level, msg, ...) \
+    (neocpp::Logger::isEnabled(level) \
+         ? neocpp::Logger::log(level, (msg), neocpp::LogFields{__VA_ARGS__}, __FILE__, __LINE__) \
+         : static_cast<void>(0))
+
+// Calls below NEOCPP_LOG_MIN_LEVEL: the message is type-checked but never evaluated
+#define NEOCPP_LOG_DISCARD(msg) static_cast<void>(sizeof(msg))
+
 // Macros for easy logging with file and line information
-#define LOG_TRACE(msg) neocpp::Logger::trace(msg, __FILE__, __LINE__)
-#define LOG_DEBUG(msg) neocpp::Logger::debug(msg, __FILE__, __LINE__)
-#define LOG_INFO(msg) neocpp::Logger::info(msg, __FILE__, __LINE__)
-#define LOG_WARN(msg) neocpp::Logger::warn(msg, __FILE__, __LINE__)
-#define LOG_ERROR(msg) neocpp::Logger::error(msg, __FILE__, __LINE__)
-#define LOG_FATAL(msg) neocpp::Logger::fatal(msg, __FILE__, __LINE__)
+#if NEOCPP_LOG_MIN_LEVEL <= 0
+#define LOG_TRACE(msg) NEOCPP_LOG(neocpp::LogLevel::TRACE, msg)
+#else
+#define LOG_TRACE(msg) NEOCPP_LOG_DISCARD(msg)
+#endif
+
+#if NEOCPP_LOG_MIN_LEVEL <= 1
+#define LOG_DEBUG(msg) NEOCPP_LOG(neocpp::LogLevel::DEBUG, msg)
+#else
+#define LOG_DEBUG(msg) NEOCPP_LOG_DISCARD(msg)
+#endif
+
+#if NEOCPP_LOG_MIN_LEVEL <= 2
+#define LOG_INFO(msg) NEOCPP_LOG(neocpp::LogLevel::INFO, msg)
+#else
+#define LOG_INFO(msg) NEOCPP_LOG_DISCARD(msg)
+#endif
+
+#if NEOCPP_LOG_MIN_LEVEL <= 3
+#define LOG_WARN(msg) NEOCPP_LOG(neocpp::LogLevel::WARN, msg)
+#else
+#define LOG_WARN(msg) NEOCPP_LOG_DISCARD(msg)
+#endif
+
+#if NEOCPP_LOG_MIN_LEVEL <= 4
+#define LOG_ERROR(msg) NEOCPP_LOG(neocpp::LogLevel::ERROR, msg)
+#else
+#define LOG_ERROR(msg) NEOCPP_LOG_DISCARD(msg)
+#endif
+
+#if NEOCPP_LOG_MIN_LEVEL <= 5
+#define LOG_FATAL(msg) NEOCPP_LOG(neocpp::LogLevel::FATAL, msg)
+#else
+#define LOG_FATAL(msg) NEOCPP_LOG_DISCARD(msg)
+#endif
 
 } // namespace neocpp
@@ -7,6 +7,7 @@
 #include "neocpp/types/types.hpp"
 #include "neocpp/types/hash160.hpp"
 #include "neocpp/types/hash256.hpp"
+#include "neocpp/types/big_integer.hpp"
 #include "neocpp/types/call_flags.hpp"
 #include "neocpp/types/contract_parameter.hpp"
 #include "neocpp/types/contract_parameter_type.hpp"
@@ -37,12 +38,15 @@
 #include "neocpp/transaction/transaction.hpp"
 #include "neocpp/transaction/signer.hpp"
 #include "neocpp/transaction/witness.hpp"
+#include "neocpp/transaction/network_fee_calculator.hpp"
+#include "neocpp/transaction/nep17_payout_planner.hpp"
 #include "neocpp/transaction/witness_scope.hpp"
 #include "neocpp/transaction/witness_rule.hpp"
 #include "neocpp/transaction/transaction_attribute.hpp"
 
 // Script
 #include "neocpp/script/script_builder.hpp"
+#include "neocpp/script/script_template.hpp"
 #include "neocpp/script/op_code.hpp"
 
 // Serialization
@@ -56,6 +60,9 @@
 #include "neocpp/protocol/http_service.hpp"
 #include "neocpp/protocol/response_types_impl.hpp"
 #include "neocpp/protocol/stack_item.hpp"
+#include "neocpp/protocol/chain_state_cache.hpp"
+#include "neocpp/protocol/rpc_response_cache.hpp"
+#include "neocpp/protocol/single_flight_group.hpp"
 
 // Utils
 #include "neocpp/utils/base58.hpp"
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "neocpp/types/types.hpp"
+#include "neocpp/types/hash160.hpp"
+
+namespace neocpp {
+
+// Forward declarations
+class NeoRpcClient;
+class BlockPolling;
+
+/// Slow-changing chain values held by ChainStateCache
+enum class ChainStateEntry : uint8_t {
+    BLOCK_COUNT = 0,
+    COMMITTEE,
+    FEE_PER_BYTE,
+    EXEC_FEE_FACTOR,
+    GAS_BALANCE
+};
+
+/// Thread-safe cache of chain state used while building transactions.
+///
+/// Values are fetched on first use and dropped when a new block arrives (see onNewBlock
+/// and subscribeTo), except the committee, which is kept until the next committee epoch.
+/// Every value also expires after a maximum age so that a cache that is not fed by a
+/// BlockPolling instance never serves data much older than one block.
+///
+/// The cache refers to its client weakly, so it never keeps the client alive; once the
+/// client is destroyed, lookups that need a round trip throw IllegalStateException.
+class ChainStateCache : public std::enable_shared_from_this<ChainStateCache> {
+public:
+    /// Hit and miss counters
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+
+        /// @return hits / (hits + misses), or 0 if nothing was looked up
+        [[nodiscard]] double getHitRate() const {
+            uint64_t total = hits + misses;
+            return total == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(total);
+        }
+    };
+
+    /// Neo N3 committee members count; the committee is refreshed every this many blocks
+    static constexpr uint32_t DEFAULT_COMMITTEE_EPOCH = 21;
+
+    /// Neo N3 target block time
+    static constexpr std::chrono::milliseconds DEFAULT_MAX_AGE{15000};
+
+    /// Constructor
+    /// @param client The RPC client used to fetch values
+    /// @param maxAge The maximum age of a cached value
+    /// @param committeeEpoch The number of blocks between committee changes
+    explicit ChainStateCache(const SharedPtr<NeoRpcClient>& client,
+                             std::chrono::milliseconds maxAge = DEFAULT_MAX_AGE,
+                             uint32_t committeeEpoch = DEFAULT_COMMITTEE_EPOCH);
+
+    /// Get the cache shared by every user of a client.
+    /// TransactionBuilder, PolicyContract and NeoToken use this instance. Caches of destroyed
+    /// clients are released on the next call.
+    /// @param client The RPC client
+    /// @return The shared cache
+    static SharedPtr<ChainStateCache> forClient(const SharedPtr<NeoRpcClient>& client);
+
+    /// Get the current block count
+    [[nodiscard]] uint32_t getBlockCount();
+
+    /// Get the committee members
+    /// @return Hex-encoded compressed public keys
+    [[nodiscard]] std::vector<std::string> getCommittee();
+
+    /// Get the policy fee per byte
+    [[nodiscard]] int64_t getFeePerByte();
+
+    /// Get the policy execution fee factor
+    [[nodiscard]] int32_t getExecFeeFactor();
+
+    /// Get the GAS balance of an account
+    /// @param account The account script hash
+    /// @return The balance in GAS fractions
+    [[nodiscard]] int64_t getGasBalance(const Hash160& account);
+
+    /// Record a new block. Drops block-scoped values and, when an epoch boundary was
+    /// crossed, the committee. Older or repeated indexes are ignored.
+    /// @param blockIndex The index of the newest block
+    void onNewBlock(uint32_t blockIndex);
+
+    /// Feed this cache from a block poller. The subscription holds a weak reference,
+    /// so the cache must be owned by a shared pointer.
+    /// @param polling The block poller
+    void subscribeTo(BlockPolling& polling);
+
+    /// Drop one kind of cached value
+    /// @param entry The entry to drop
+    void invalidate(ChainStateEntry entry);
+
+    /// Drop every cached value
+    void invalidateAll();
+
+    /// Drop one kind of cached value from the shared cache of every client (see forClient)
+    /// @param entry The entry to drop
+    static void invalidateShared(ChainStateEntry entry);
+
+    /// Get the counters of one entry
+    [[nodiscard]] Stats getStats(ChainStateEntry entry) const;
+
+    /// Get the counters summed over all entries
+    [[nodiscard]] Stats getStats() const;
+
+    /// Reset all counters
+    void resetStats();
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    template<typename T>
+    struct Slot {
+        std::optional<T> value;
+        Clock::time_point fetchedAt;
+    };
+
+    static constexpr size_t ENTRY_COUNT = 5;
+
+    std::weak_ptr<NeoRpcClient> client_;
+    std::chrono::milliseconds maxAge_;
+    uint32_t committeeEpoch_;
+
+    mutable std::mutex mutex_;
+    std::optional<uint32_t> lastBlockIndex_;
+    std::array<uint64_t, ENTRY_COUNT> generations_{};
+    Slot<uint32_t> blockCount_;
+    Slot<std::vector<std::string>> committee_;
+    Slot<int64_t> feePerByte_;
+    Slot<int32_t> execFeeFactor_;
+    std::unordered_map<Hash160, Slot<int64_t>, Hash160::Hasher> gasBalances_;
+
+    std::array<std::atomic<uint64_t>, ENTRY_COUNT> hits_{};
+    std::array<std::atomic<uint64_t>, ENTRY_COUNT> misses_{};
+
+    /// Return the cached value of a slot or fetch and store it. The slot is selected under
+    /// the lock; a value fetched across an invalidation of its entry is returned but not stored.
+    template<typename T, typename Select, typename Fetch>
+    T lookup(ChainStateEntry entry, Select select, Fetch fetch);
+
+    /// Drop an entry; caller holds mutex_
+    void invalidateLocked(ChainStateEntry entry);
+
+    /// Get the client for a round trip
+    /// @throws IllegalStateException if the client was destroyed
+    SharedPtr<NeoRpcClient> lockClient() const;
+
+    /// Read an integer returned by a native contract method
+    int64_t invokeInteger(const Hash160& contract, const std::string& method, const nlohmann::json& params);
+};
+
+} // namespace neocpp
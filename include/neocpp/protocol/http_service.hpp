@@ -63,6 +63,18 @@ public:
     /// @return The JSON response
     nlohmann::json post(const nlohmann::json& data, const std::string& endpoint = "");
 
+    /// Perform JSON-RPC POST request with an already serialized body
+    /// @param body The JSON request text
+    /// @param endpoint Optional endpoint (default empty)
+    /// @return The JSON response
+    nlohmann::json postBody(const std::string& body, const std::string& endpoint = "");
+
+    /// Perform JSON-RPC POST request and return the response text unparsed
+    /// @param body The JSON request text
+    /// @param endpoint Optional endpoint (default empty)
+    /// @return The response body
+    std::string postRaw(const std::string& body, const std::string& endpoint = "");
+
     /// Perform JSON GET request
     /// @param endpoint The endpoint
     /// @return The JSON response
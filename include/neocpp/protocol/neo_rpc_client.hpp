@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <string>
 #include <memory>
 #include <vector>
@@ -15,6 +16,8 @@ namespace neocpp {
 class Transaction;
 class Block;
 class HttpService;
+class RpcResponseCache;
+class SingleFlightGroup;
 class NeoGetVersionResponse;
 class NeoGetBlockResponse;
 class NeoGetRawTransactionResponse;
@@ -26,12 +29,15 @@ class NeoGetPeersResponse;
 class NeoGetUnclaimedGasResponse;
 class NeoGetWalletBalanceResponse;
 
-/// Neo RPC client for interacting with Neo nodes
+/// Neo RPC client for interacting with Neo nodes.
+/// Calls may be issued concurrently from multiple threads.
 class NeoRpcClient {
 private:
     std::string url_;
     SharedPtr<HttpService> httpService_;
-    int requestId_;
+    std::atomic<int> requestId_;
+    SharedPtr<RpcResponseCache> responseCache_;
+    SharedPtr<SingleFlightGroup> singleFlight_;
 
 public:
     /// Constructor
@@ -47,6 +53,25 @@ public:
     /// Set the RPC URL
     void setUrl(const std::string& url) { url_ = url; }
 
+    /// Serve blocks, block hashes, transactions and application logs that can no longer change
+    /// from a response cache. Off by default; set it before issuing calls from other threads.
+    /// @param cache The cache, possibly shared between clients of the same network, or nullptr to disable
+    void setResponseCache(const SharedPtr<RpcResponseCache>& cache) { responseCache_ = cache; }
+
+    /// Get the response cache, or nullptr if none is set
+    const SharedPtr<RpcResponseCache>& getResponseCache() const { return responseCache_; }
+
+    /// Share one request among identical concurrent calls of getBlock, getBlockCount, getBlockHash,
+    /// getRawTransaction, getApplicationLog, invokeFunction and invokeScript. Waiting callers
+    /// receive the same response object as the caller that sent the request, except invocations
+    /// that opened an iterator session, which are sent again. Off by default; set it before
+    /// issuing calls from other threads.
+    /// @param group The group, or nullptr to disable
+    void setSingleFlight(const SharedPtr<SingleFlightGroup>& group) { singleFlight_ = group; }
+
+    /// Get the single-flight group, or nullptr if none is set
+    const SharedPtr<SingleFlightGroup>& getSingleFlight() const { return singleFlight_; }
+
     // Node methods
 
     /// Get node version information
@@ -3,16 +3,39 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <mutex>
 #include <nlohmann/json.hpp>
 #include "neocpp/types/types.hpp"
 #include "neocpp/types/hash256.hpp"
 #include "neocpp/types/hash160.hpp"
+#include "neocpp/protocol/stack_item_arena.hpp"
 
 namespace neocpp {
 
-// Forward declarations
-class StackItem;
-using StackItemPtr = std::shared_ptr<StackItem>;
+/// The result object of a response, as returned by getRawJson().
+/// Responses decoded from the response text with parseResponse() keep that text and only
+/// build the JSON tree the first time it is asked for.
+class RawResultJson {
+public:
+    /// Use an already parsed result
+    void set(const nlohmann::json& json);
+
+    /// Keep a response body and parse its result on first access
+    void setBody(std::string body);
+
+    /// The result object, parsing the kept body if needed
+    const nlohmann::json& get() const;
+
+private:
+    struct Deferred {
+        std::once_flag parsed;
+        std::string body;
+        nlohmann::json result;
+    };
+
+    nlohmann::json json_;
+    std::shared_ptr<Deferred> deferred_;
+};
 
 /// Version info struct
 struct VersionInfo {
@@ -74,6 +97,12 @@ class NeoGetBlockResponse {
 public:
     void parseJson(const nlohmann::json& json);
 
+    /// Decode a whole JSON-RPC response body straight into this response, without
+    /// building a JSON tree of the body first
+    /// @param body The response text
+    /// @throws RpcException if the body is malformed, is an error response or has no result
+    void parseResponse(std::string body);
+
     const Hash256& getHash() const { return hash_; }
     [[nodiscard]] int getSize() const { return size_; }
     [[nodiscard]] int getVersion() const { return version_; }
@@ -87,9 +116,11 @@ public:
     [[nodiscard]] int getConfirmations() const { return confirmations_; }
     const Hash256& getNextBlockHash() const { return nextBlockHash_; }
     bool hasNextBlockHash() const { return hasNextBlockHash_; }
-    const nlohmann::json& getRawJson() const { return rawJson_; }
+    const nlohmann::json& getRawJson() const { return rawJson_.get(); }
 
 private:
+    class FieldReader;
+
     Hash256 hash_;
     int size_ = 0;
     int version_ = 0;
@@ -103,7 +134,7 @@ private:
     int confirmations_ = 0;
     Hash256 nextBlockHash_;
     bool hasNextBlockHash_ = false;
-    nlohmann::json rawJson_;
+    RawResultJson rawJson_;
 };
 
 /// Raw transaction response
@@ -111,6 +142,12 @@ class NeoGetRawTransactionResponse {
 public:
     void parseJson(const nlohmann::json& json);
 
+    /// Decode a whole JSON-RPC response body straight into this response, without
+    /// building a JSON tree of the body first
+    /// @param body The response text
+    /// @throws RpcException if the body is malformed, is an error response or has no result
+    void parseResponse(std::string body);
+
     const Hash256& getHash() const { return hash_; }
     [[nodiscard]] int getSize() const { return size_; }
     [[nodiscard]] int getVersion() const { return version_; }
@@ -126,9 +163,11 @@ public:
     const Hash256& getBlockHash() const { return blockHash_; }
     [[nodiscard]] int getConfirmations() const { return confirmations_; }
     [[nodiscard]] uint64_t getBlockTime() const { return blockTime_; }
-    const nlohmann::json& getRawJson() const { return rawJson_; }
+    const nlohmann::json& getRawJson() const { return rawJson_.get(); }
 
 private:
+    class FieldReader;
+
     Hash256 hash_;
     int size_ = 0;
     int version_ = 0;
@@ -144,7 +183,7 @@ private:
     Hash256 blockHash_;
     int confirmations_ = 0;
     uint64_t blockTime_ = 0;
-    nlohmann::json rawJson_;
+    RawResultJson rawJson_;
 };
 
 /// Application log response
@@ -152,14 +191,22 @@ class NeoGetApplicationLogResponse {
 public:
     void parseJson(const nlohmann::json& json);
 
+    /// Decode a whole JSON-RPC response body straight into this response, without
+    /// building a JSON tree of the body first
+    /// @param body The response text
+    /// @throws RpcException if the body is malformed, is an error response or has no result
+    void parseResponse(std::string body);
+
     const std::string& getTxId() const { return txid_; }
     const nlohmann::json& getExecutions() const { return executions_; }
-    const nlohmann::json& getRawJson() const { return rawJson_; }
+    const nlohmann::json& getRawJson() const { return rawJson_.get(); }
 
 private:
+    class FieldReader;
+
     std::string txid_;
     nlohmann::json executions_;
-    nlohmann::json rawJson_;
+    RawResultJson rawJson_;
 };
 
 /// Contract state
@@ -229,28 +276,50 @@ class NeoInvokeResultResponse {
 public:
     void parseJson(const nlohmann::json& json);
 
+    /// Decode a whole JSON-RPC response body straight into this response, without
+    /// building a JSON tree of the body first
+    /// @param body The response text
+    /// @throws RpcException if the body is malformed, is an error response or has no result
+    void parseResponse(std::string body);
+
     const std::string& getScript() const { return script_; }
     const std::string& getState() const { return state_; }
     const std::string& getGasConsumed() const { return gasConsumed_; }
     const std::string& getException() const { return exception_; }
     bool hasException() const { return hasException_; }
-    const std::vector<StackItemPtr>& getStack() const { return stack_; }
+
+    /// The result stack as StackItem objects, converted from the stack views on first call
+    const std::vector<StackItemPtr>& getStack() const;
+
+    /// The result stack as views into one flat arena, without a StackItem object per element
+    const std::vector<StackItemView>& getStackViews() const { return stackViews_; }
     const std::string& getTx() const { return tx_; }
+    const std::string& getSessionId() const { return session_; }
+    bool hasSession() const { return !session_.empty(); }
     const nlohmann::json& getNotifications() const { return notifications_; }
     const nlohmann::json& getDiagnostics() const { return diagnostics_; }
-    const nlohmann::json& getRawJson() const { return rawJson_; }
+    const nlohmann::json& getRawJson() const { return rawJson_.get(); }
 
 private:
+    class FieldReader;
+
     std::string script_;
     std::string state_;
     std::string gasConsumed_;
     std::string exception_;
     bool hasException_ = false;
-    std::vector<StackItemPtr> stack_;
+    struct ConvertedStack {
+        std::once_flag converted;
+        std::vector<StackItemPtr> items;
+    };
+    std::shared_ptr<StackItemArena> stackArena_;
+    std::vector<StackItemView> stackViews_;
+    std::shared_ptr<ConvertedStack> stack_ = std::make_shared<ConvertedStack>();
     std::string tx_;
+    std::string session_;
     nlohmann::json notifications_;
     nlohmann::json diagnostics_;
-    nlohmann::json rawJson_;
+    RawResultJson rawJson_;
 };
 
 /// Unclaimed gas response
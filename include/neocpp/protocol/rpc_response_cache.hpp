@@ -0,0 +1,124 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <nlohmann/json.hpp>
+
+namespace neocpp {
+
+/// Thread-safe, byte-bounded LRU cache of JSON-RPC response bodies for results that never change.
+///
+/// Neo N3 blocks are final once they exist (dBFT has single-block finality), so a block, its
+/// hash, a transaction and an application log read once can be served locally from then on.
+/// NeoRpcClient consults the cache for getBlock, getBlockHash, getRawTransaction and
+/// getApplicationLog once one is set with NeoRpcClient::setResponseCache, and stores only
+/// successful results that can no longer change: blocks that already have a next block,
+/// confirmed transactions and any non-verbose result. The `confirmations` of a cached verbose
+/// block or transaction are those of the first read.
+///
+/// Entries are keyed by endpoint, method and canonical parameters, so one cache can be shared
+/// by clients of different nodes or networks, and cost the size of key and body;
+/// the least recently used ones are evicted when the total would exceed the budget. With a
+/// directory, every stored entry is also written to disk, one file per entry, and entries
+/// evicted from memory or left by an earlier process are read back from there on a miss.
+class RpcResponseCache {
+public:
+    /// Lookup and eviction counters
+    struct Stats {
+        uint64_t hits = 0;          ///< Lookups served from memory or disk
+        uint64_t diskHits = 0;      ///< Lookups served from disk (included in hits)
+        uint64_t misses = 0;        ///< Lookups that found nothing
+        uint64_t insertions = 0;    ///< Entries stored
+        uint64_t evictions = 0;     ///< Entries evicted from memory
+        size_t entryCount = 0;      ///< Entries in memory
+        size_t byteCount = 0;       ///< Bytes of keys and bodies in memory
+
+        /// @return hits / (hits + misses), or 0 if nothing was looked up
+        [[nodiscard]] double getHitRate() const {
+            uint64_t total = hits + misses;
+            return total == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(total);
+        }
+    };
+
+    /// Default memory budget
+    static constexpr size_t DEFAULT_MAX_BYTES = 64 * 1024 * 1024;
+
+    /// Constructor
+    /// @param maxBytes The memory budget for keys and bodies
+    /// @param directory Directory of the on-disk store, created if missing; empty keeps the cache in memory
+    /// @throws IllegalArgumentException if the directory cannot be created
+    explicit RpcResponseCache(size_t maxBytes = DEFAULT_MAX_BYTES, const std::string& directory = "");
+
+    RpcResponseCache(const RpcResponseCache&) = delete;
+    RpcResponseCache& operator=(const RpcResponseCache&) = delete;
+
+    /// Build the cache key of a call
+    /// @param endpoint The RPC URL the call is sent to
+    /// @param method The RPC method name
+    /// @param params The parameters
+    /// @return The key
+    static std::string makeKey(const std::string& endpoint, const std::string& method, const nlohmann::json& params);
+
+    /// Look up a response body
+    /// @param key The key from makeKey
+    /// @param body Receives the body on a hit
+    /// @return true on a hit
+    bool get(const std::string& key, std::string& body);
+
+    /// Store a response body, evicting the least recently used entries to stay within budget.
+    /// Bodies larger than the whole budget are only written to disk.
+    /// @param key The key from makeKey
+    /// @param body The response body
+    void put(const std::string& key, const std::string& body);
+
+    /// Remove every entry from memory and, with removeFromDisk, from the on-disk store
+    /// @param removeFromDisk Whether to delete the files of the on-disk store as well
+    void clear(bool removeFromDisk = false);
+
+    /// Get the memory budget
+    [[nodiscard]] size_t getMaxBytes() const { return maxBytes_; }
+
+    /// Get the directory of the on-disk store, or an empty string
+    const std::string& getDirectory() const { return directory_; }
+
+    /// Get the counters and current size
+    [[nodiscard]] Stats getStats() const;
+
+    /// Reset the counters
+    void resetStats();
+
+private:
+    struct Entry {
+        std::string key;
+        std::string body;
+    };
+
+    size_t maxBytes_;
+    std::string directory_;
+
+    mutable std::mutex mutex_;
+    std::list<Entry> entries_;  // most recently used first
+    std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+    size_t byteCount_ = 0;
+
+    std::atomic<uint64_t> hits_{0};
+    std::atomic<uint64_t> diskHits_{0};
+    std::atomic<uint64_t> misses_{0};
+    std::atomic<uint64_t> insertions_{0};
+    std::atomic<uint64_t> evictions_{0};
+
+    /// Insert or refresh an entry in memory; caller holds mutex_
+    void insertLocked(const std::string& key, const std::string& body);
+
+    /// Path of the file holding an entry
+    std::string pathFor(const std::string& key) const;
+
+    bool readFromDisk(const std::string& key, std::string& body) const;
+    void writeToDisk(const std::string& key, const std::string& body) const;
+};
+
+} // namespace neocpp
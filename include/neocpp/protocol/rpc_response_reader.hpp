@@ -0,0 +1,86 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <nlohmann/json.hpp>
+
+namespace neocpp {
+
+/// Receives the parser events of one result member, so that the member can be decoded
+/// without building a JSON value of it
+class RpcEventSink {
+public:
+    virtual ~RpcEventSink() = default;
+
+    /// Called for a key of an object inside the member
+    /// @param key The key; may be moved from
+    virtual void key(std::string& key) = 0;
+
+    /// Called for a string, number, boolean or null
+    /// @param value The value; may be moved from
+    virtual void value(nlohmann::json&& value) = 0;
+
+    /// Called when an object starts, including the member itself
+    virtual void startObject() = 0;
+
+    /// Called when an array starts, including the member itself
+    virtual void startArray() = 0;
+
+    /// Called when the innermost open object or array ends
+    virtual void endStructure() = 0;
+};
+
+/// Receives the members of a JSON-RPC "result" object as they are parsed
+class RpcResultVisitor {
+public:
+    virtual ~RpcResultVisitor() = default;
+
+    /// Called for a string, number, boolean or null member
+    /// @param key The member name
+    /// @param value The member value; may be moved from
+    virtual void onValue(const std::string& key, nlohmann::json&& value) {
+        (void)key;
+        (void)value;
+    }
+
+    /// Called when an object or array member starts
+    /// @param key The member name
+    /// @return Where to build the member, or nullptr to skip it without building anything
+    virtual nlohmann::json* onStructure(const std::string& key) {
+        (void)key;
+        return nullptr;
+    }
+
+    /// Called when an object or array member starts, before onStructure
+    /// @param key The member name
+    /// @return Where to send the events of the member, or nullptr to ask onStructure
+    virtual RpcEventSink* onEvents(const std::string& key) {
+        (void)key;
+        return nullptr;
+    }
+};
+
+/// Streaming decoder for JSON-RPC responses.
+/// The body is parsed with SAX events: members of "result" go straight to a visitor, which
+/// either takes the events of a structure itself or names where to build it; other
+/// structures are skipped, so no DOM of the whole response is created and nothing is
+/// copied out of one.
+class RpcResponseReader {
+public:
+    /// Parse a response body and hand the members of its result object to a visitor.
+    /// A result that is not an object, such as the base64 payload of a non-verbose call,
+    /// is accepted and gives the visitor nothing.
+    /// @param body The JSON-RPC response text
+    /// @param visitor Receives the result members
+    /// @throws RpcException if the body is not valid JSON, carries an error object, or has
+    ///         no result
+    static void read(std::string_view body, RpcResultVisitor& visitor);
+
+    /// Hand the members of an already parsed result object to a visitor. Structures taken
+    /// by an event sink are replayed to it as events.
+    /// @param result The result object; anything else is ignored
+    /// @param visitor Receives the result members
+    static void visit(const nlohmann::json& result, RpcResultVisitor& visitor);
+};
+
+} // namespace neocpp
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "neocpp/types/types.hpp"
+
+namespace neocpp {
+
+/// Collapses identical calls that are in flight at the same time into one.
+///
+/// The first caller for a key runs the call; callers arriving with the same key before it
+/// finishes wait for it and receive the same result object, or the same exception. Once the
+/// call has finished, the next caller for the key runs it again, so nothing is cached.
+/// NeoRpcClient uses a group set with NeoRpcClient::setSingleFlight for its read-only queries,
+/// keyed by method and canonical parameters.
+class SingleFlightGroup {
+public:
+    /// Call counters
+    struct Stats {
+        uint64_t executions = 0;  ///< Calls that were run
+        uint64_t shared = 0;      ///< Calls that waited for a call already in flight
+    };
+
+    SingleFlightGroup() = default;
+    SingleFlightGroup(const SingleFlightGroup&) = delete;
+    SingleFlightGroup& operator=(const SingleFlightGroup&) = delete;
+
+    /// Run a call, or wait for the identical call already in flight
+    /// @param key Identifies the call; calls with the same key must return the same type
+    /// @param call Returns the result as SharedPtr<T>
+    /// @param shared Set to whether the result came from another caller's call
+    /// @return The result, possibly the same object other callers receive
+    template <typename T, typename Call>
+    SharedPtr<T> run(const std::string& key, Call&& call, bool* shared = nullptr) {
+        std::promise<SharedPtr<void>> promise;
+        std::shared_future<SharedPtr<void>> result;
+        bool leader = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto found = calls_.find(key);
+            if (found != calls_.end()) {
+                result = found->second;
+            } else {
+                result = promise.get_future().share();
+                calls_.emplace(key, result);
+                leader = true;
+            }
+        }
+        if (shared) {
+            *shared = !leader;
+        }
+        if (!leader) {
+            ++shared_;
+            return std::static_pointer_cast<T>(result.get());
+        }
+
+        ++executions_;
+        SharedPtr<void> value;
+        std::exception_ptr error;
+        try {
+            value = call();
+        } catch (...) {
+            error = std::current_exception();
+        }
+        // Later callers start a new call rather than join a finished one
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            calls_.erase(key);
+        }
+        if (error) {
+            promise.set_exception(error);
+            std::rethrow_exception(error);
+        }
+        promise.set_value(value);
+        return std::static_pointer_cast<T>(value);
+    }
+
+    /// Number of distinct calls in flight
+    [[nodiscard]] size_t getInFlightCount() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return calls_.size();
+    }
+
+    /// Get the counters
+    [[nodiscard]] Stats getStats() const {
+        Stats stats;
+        stats.executions = executions_;
+        stats.shared = shared_;
+        return stats;
+    }
+
+    /// Reset the counters
+    void resetStats() {
+        executions_ = 0;
+        shared_ = 0;
+    }
+
+private:
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, std::shared_future<SharedPtr<void>>> calls_;
+    std::atomic<uint64_t> executions_{0};
+    std::atomic<uint64_t> shared_{0};
+};
+
+} // namespace neocpp
@@ -7,6 +7,7 @@
 #include <map>
 #include <nlohmann/json.hpp>
 #include "neocpp/types/types.hpp"
+#include "neocpp/types/big_integer.hpp"
 #include "neocpp/exceptions.hpp"
 
 namespace neocpp {
@@ -46,10 +47,16 @@ public:
     }
 
     /// Get as integer
+    /// @throws IllegalStateException if the item is not an integer or does not fit in 64 bits
     virtual int64_t getInteger() const {
         throw IllegalStateException("Cannot convert to integer");
     }
 
+    /// Get as integer of up to 256 bits
+    virtual BigInteger getBigInteger() const {
+        return BigInteger(getInteger());
+    }
+
     /// Get as byte array
     virtual Bytes getByteArray() const {
         throw IllegalStateException("Cannot convert to byte array");
@@ -103,10 +110,11 @@ public:
 /// Integer stack item
 class IntegerStackItem : public StackItem {
 private:
-    int64_t value_;
+    BigInteger value_;
 
 public:
     explicit IntegerStackItem(int64_t value) : value_(value) {}
+    explicit IntegerStackItem(const BigInteger& value) : value_(value) {}
     [[nodiscard]] StackItemType getType() const override {
         return StackItemType::INTEGER;
     }
@@ -114,13 +122,14 @@ public:
     nlohmann::json toJson() const override {
         return nlohmann::json{
             {"type", "Integer"},
-            {"value", std::to_string(value_)}
+            {"value", value_.toString()}
         };
     }
     [[nodiscard]] bool getBoolean() const override {
-        return value_ != 0;
+        return !value_.isZero();
     }
-    [[nodiscard]] int64_t getInteger() const override { return value_; }
+    [[nodiscard]] int64_t getInteger() const override { return value_.toInt64(); }
+    [[nodiscard]] BigInteger getBigInteger() const override { return value_; }
 };
 
 /// Byte string stack item
@@ -0,0 +1,224 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "neocpp/protocol/stack_item.hpp"
+#include "neocpp/protocol/rpc_response_reader.hpp"
+#include "neocpp/types/types.hpp"
+
+namespace neocpp {
+
+class StackItemArena;
+
+/// Read-only handle to one item stored in a StackItemArena.
+/// A view is two words and cheap to copy; it stays valid as long as its arena is alive and
+/// has not been cleared. Accessors mirror StackItem, but byte strings, strings and children
+/// are returned without copying.
+class StackItemView {
+public:
+    StackItemView() = default;
+
+    /// Get the type of this stack item
+    [[nodiscard]] StackItemType getType() const;
+
+    /// Get as boolean
+    /// @throws IllegalStateException for pointers and interop interfaces
+    [[nodiscard]] bool getBoolean() const;
+
+    /// Get as integer (Integer, Boolean and Pointer items)
+    /// @throws IllegalStateException for other types, or if the value does not fit in 64 bits
+    [[nodiscard]] int64_t getInteger() const;
+
+    /// Get as integer of up to 256 bits
+    /// @throws IllegalStateException for types other than Integer, Boolean and Pointer
+    [[nodiscard]] BigInteger getBigInteger() const;
+
+    /// Get the bytes of a ByteString item, borrowed from the arena
+    /// @throws IllegalStateException for other types
+    [[nodiscard]] ByteView getBytes() const;
+
+    /// Get a ByteString item as text, or the id of an InteropInterface item, borrowed from the arena
+    /// @throws IllegalStateException for other types
+    [[nodiscard]] std::string_view getString() const;
+
+    /// Check whether this is an Array or Struct item
+    [[nodiscard]] bool isArray() const;
+
+    /// Check whether this is a Map item
+    [[nodiscard]] bool isMap() const;
+
+    /// Number of elements of an Array or Struct, or entries of a Map
+    /// @throws IllegalStateException for other types
+    [[nodiscard]] size_t size() const;
+
+    /// Get an element of an Array or Struct item
+    /// @param index The element index
+    /// @throws IllegalStateException if this is not an Array or Struct
+    /// @throws IllegalArgumentException if the index is out of bounds
+    [[nodiscard]] StackItemView at(size_t index) const;
+
+    /// Get the key of a Map entry
+    /// @param index The entry index, in the order the entries were added
+    /// @throws IllegalStateException if this is not a Map
+    /// @throws IllegalArgumentException if the index is out of bounds
+    [[nodiscard]] StackItemView keyAt(size_t index) const;
+
+    /// Get the value of a Map entry
+    /// @param index The entry index, in the order the entries were added
+    /// @throws IllegalStateException if this is not a Map
+    /// @throws IllegalArgumentException if the index is out of bounds
+    [[nodiscard]] StackItemView valueAt(size_t index) const;
+
+    /// Convert to the shared StackItem representation
+    /// @return A new StackItem tree with copies of all values
+    [[nodiscard]] StackItemPtr toStackItem() const;
+
+    /// Convert to JSON representation
+    [[nodiscard]] nlohmann::json toJson() const;
+
+private:
+    friend class StackItemArena;
+
+    StackItemView(const StackItemArena* arena, uint32_t index) : arena_(arena), index_(index) {}
+
+    StackItemView child(size_t slot, size_t count, size_t index) const;
+
+    const StackItemArena* arena_ = nullptr;
+    uint32_t index_ = 0;
+};
+
+/// Flat storage for stack items, e.g. the stack of an invocation result.
+/// Items are tagged nodes in one array; children of Arrays, Structs and Maps are runs of node
+/// indices in a second array, and the bytes of all ByteStrings share one buffer. Adding an
+/// item with thousands of elements therefore costs a few vector appends instead of one
+/// reference-counted allocation per element.
+class StackItemArena {
+public:
+    class StackReader;
+
+    StackItemArena() = default;
+
+    // Views point at the arena, so it is neither copied nor moved
+    StackItemArena(const StackItemArena&) = delete;
+    StackItemArena& operator=(const StackItemArena&) = delete;
+
+    /// Add a stack item in its RPC JSON form (as accepted by StackItem::fromJson)
+    /// @param json The stack item JSON
+    /// @return A view of the added item
+    /// @throws DeserializationException if the JSON is not a valid stack item
+    StackItemView add(const nlohmann::json& json);
+
+    /// Add a copy of a StackItem tree
+    /// @param item The item to copy
+    /// @return A view of the added item
+    StackItemView add(const StackItem& item);
+
+    /// Pre-allocate room for items and ByteString bytes
+    /// @param items Number of items (including nested ones)
+    /// @param bytes Total ByteString size
+    void reserve(size_t items, size_t bytes);
+
+    /// Remove all items; every view into the arena becomes invalid
+    void clear();
+
+    /// Number of items stored, including nested ones
+    [[nodiscard]] size_t itemCount() const { return nodes_.size(); }
+
+    /// Total size of the stored ByteStrings, interface ids and integers wider than 64 bits
+    [[nodiscard]] size_t byteCount() const { return bytes_.size(); }
+
+private:
+    friend class StackItemView;
+
+    /// One stack item. Scalars keep their value in `value`; ByteStrings, interop ids and
+    /// Integers that do not fit in 64 bits (count != 0, NeoVM encoding) keep an offset into
+    /// bytes_; Arrays and Structs keep an offset into children_ with `count` elements, and Maps
+    /// with `count` key/value pairs stored as 2 * count indices.
+    struct Node {
+        int64_t value = 0;
+        uint32_t offset = 0;
+        uint32_t count = 0;
+        StackItemType type = StackItemType::ANY;
+    };
+
+    uint32_t addNode(StackItemType type);
+    uint32_t addJson(const nlohmann::json& json);
+    uint32_t addScalar(const std::string& type, const nlohmann::json& value);
+    StackItemView view(uint32_t node) const { return StackItemView(this, node); }
+    uint32_t addItem(const StackItem& item);
+    uint32_t addChildren(uint32_t node, size_t slots);
+    void setBytes(uint32_t node, const uint8_t* data, size_t size);
+    void setInteger(uint32_t node, const BigInteger& value);
+
+    std::vector<Node> nodes_;
+    std::vector<uint32_t> children_;
+    Bytes bytes_;
+};
+
+/// Adds the items of an RPC "stack" array to an arena straight from the parser's events,
+/// without a JSON value of the stack. Items are stored as StackItemArena::add stores them;
+/// an item whose "value" structure comes before its "type" is collected as JSON and added
+/// when it ends. Events that reveal an invalid item throw DeserializationException.
+class StackItemArena::StackReader : public RpcEventSink {
+public:
+    /// Constructor
+    /// @param arena The arena receiving the items
+    explicit StackReader(StackItemArena& arena) : arena_(arena) {}
+
+    void key(std::string& key) override;
+    void value(nlohmann::json&& value) override;
+    void startObject() override;
+    void startArray() override;
+    void endStructure() override;
+
+    /// Views of the stack items, complete once the stack array has ended
+    std::vector<StackItemView>& getViews() { return views_; }
+
+private:
+    static constexpr uint32_t NONE = UINT32_MAX;
+
+    enum class Kind : uint8_t {
+        STACK,    // the stack array
+        ITEM,     // a stack item object
+        ELEMENTS, // the value array of an Array or Struct
+        ENTRIES,  // the value array of a Map
+        ENTRY,    // a key/value object of a Map
+        BUFFER,   // a structure collected as JSON
+        SKIP      // a structure nobody reads
+    };
+
+    /// One open structure. Nodes are added when their item ends, so an item collects its
+    /// fields and the run of its children here first.
+    struct Frame {
+        Kind kind = Kind::SKIP;
+        size_t start = 0;                 // STACK, ELEMENTS, ENTRIES: first slot in pending_
+        std::string key;                  // ITEM, ENTRY, BUFFER: last key
+        std::string type;                 // ITEM
+        nlohmann::json value;             // ITEM: a scalar "value"
+        nlohmann::json interface;         // ITEM: the "interface" id
+        bool collecting = false;          // ITEM: the value structure went to collected_
+        uint32_t childOffset = 0;         // ITEM: run of children in the arena
+        uint32_t childCount = 0;          // ITEM: elements, or Map entries
+        uint32_t entryKey = NONE;         // ENTRY
+        uint32_t entryValue = NONE;       // ENTRY
+        nlohmann::json* target = nullptr; // BUFFER: the structure being built
+    };
+
+    void push(Kind kind, nlohmann::json* target = nullptr);
+    void startStructure(nlohmann::json::value_t type);
+    void startItemValue(nlohmann::json::value_t type);
+    uint32_t endItem(Frame& item);
+    void endContainer(size_t slotsPerChild);
+    void deliver(uint32_t node);
+
+    StackItemArena& arena_;
+    std::vector<Frame> frames_;       // open structures, innermost last
+    std::vector<uint32_t> pending_;   // finished children of the open containers
+    nlohmann::json collected_;        // value structure of the item being collected
+    std::vector<StackItemView> views_;
+};
+
+} // namespace neocpp
@@ -5,6 +5,7 @@
 #include <memory>
 #include <map>
 #include "neocpp/types/types.hpp"
+#include "neocpp/types/big_integer.hpp"
 #include "neocpp/script/op_code.hpp"
 
 namespace neocpp {
@@ -38,6 +39,12 @@ public:
     /// @return Reference to this builder
     ScriptBuilder& pushInteger(int64_t value);
 
+    /// Push an integer of up to 256 bits onto the stack, using PUSHINT128 or PUSHINT256
+    /// when it does not fit in 64 bits
+    /// @param value The integer value
+    /// @return Reference to this builder
+    ScriptBuilder& pushInteger(const BigInteger& value);
+
     /// Push bytes onto the stack
     /// @param data The data to push
     /// @return Reference to this builder
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <array>
+#include <string>
+#include <vector>
+#include "neocpp/types/types.hpp"
+#include "neocpp/types/contract_parameter.hpp"
+#include "neocpp/script/op_code.hpp"
+#include "neocpp/neo_constants.hpp"
+
+namespace neocpp {
+
+// Forward declarations
+class Hash160;
+class Hash256;
+
+/// A script compiled once with named placeholder slots.
+///
+/// The constant parts of the script (opcodes, method names, fixed arguments, contract
+/// hashes) are encoded when the template is built. Instantiating only encodes the slot
+/// values and copies the constant parts around them into a caller-owned buffer, so a
+/// reused buffer makes instantiation allocation-free. Instantiated scripts are
+/// byte-identical to the same calls made through ScriptBuilder.
+class ScriptTemplate {
+public:
+    /// Value kinds a slot accepts
+    enum class SlotType : uint8_t {
+        BOOLEAN,
+        INTEGER,
+        HASH160,
+        HASH256,
+        PUBLIC_KEY,
+        BYTE_ARRAY,
+        STRING
+    };
+
+    /// A named placeholder
+    struct Slot {
+        std::string name;
+        SlotType type;
+    };
+
+    /// A contract call argument: a constant, a null or a named slot
+    class Argument {
+    public:
+        /// A constant argument, encoded once at compile time
+        static Argument constant(const ContractParameter& value);
+
+        /// A null argument (PUSHNULL)
+        static Argument null();
+
+        /// A placeholder filled in at instantiation
+        static Argument slot(const std::string& name, SlotType type);
+
+    private:
+        friend class ScriptTemplate;
+        enum class Kind : uint8_t { CONSTANT, NULL_VALUE, SLOT };
+
+        Kind kind_ = Kind::NULL_VALUE;
+        ContractParameter value_;
+        std::string slotName_;
+        SlotType slotType_ = SlotType::INTEGER;
+    };
+
+    /// Slot values for one instantiation. Reuse one instance per thread to avoid allocations.
+    class Values {
+    public:
+        Values& setBoolean(size_t slot, bool value);
+        Values& setInteger(size_t slot, int64_t value);
+        Values& setInteger(size_t slot, const BigInteger& value);
+        Values& setHash160(size_t slot, const Hash160& value);
+        Values& setHash256(size_t slot, const Hash256& value);
+        Values& setPublicKey(size_t slot, const Bytes& encodedPublicKey);
+        Values& setBytes(size_t slot, const Bytes& value);
+        Values& setString(size_t slot, const std::string& value);
+
+        /// Set a slot by name from a contract parameter of the slot's type
+        /// @param name The slot name
+        /// @param value The value
+        /// @return Reference to these values
+        Values& set(const std::string& name, const ContractParameter& value);
+
+    private:
+        friend class ScriptTemplate;
+
+        struct Value {
+            bool isSet = false;
+            BigInteger integer;
+            std::array<uint8_t, NeoConstants::PUBLIC_KEY_SIZE_COMPRESSED> fixed{};
+            Bytes bytes;
+        };
+
+        explicit Values(const ScriptTemplate& owner);
+        Value& at(size_t slot, SlotType type);
+
+        const ScriptTemplate* owner_;
+        std::vector<Value> values_;
+    };
+
+    ScriptTemplate() = default;
+
+    /// Compile a single contract call
+    /// @param scriptHash The contract script hash
+    /// @param method The method name
+    /// @param arguments The arguments
+    /// @return The template
+    static ScriptTemplate contractCall(const Hash160& scriptHash, const std::string& method,
+                                       const std::vector<Argument>& arguments);
+
+    /// Append an opcode
+    /// @param opcode The opcode
+    /// @return Reference to this template
+    ScriptTemplate& emit(OpCode opcode);
+
+    /// Append raw constant bytes
+    /// @param bytes The bytes
+    /// @return Reference to this template
+    ScriptTemplate& emitRaw(const Bytes& bytes);
+
+    /// Append a push of a constant parameter
+    /// @param parameter The parameter
+    /// @return Reference to this template
+    ScriptTemplate& push(const ContractParameter& parameter);
+
+    /// Append a push of a slot. A name already in use refers to the same slot and must have the same type.
+    /// @param name The slot name
+    /// @param type The slot type
+    /// @return Reference to this template
+    ScriptTemplate& pushSlot(const std::string& name, SlotType type);
+
+    /// Append a contract call to a fixed contract (see ScriptBuilder::callContract)
+    /// @param scriptHash The contract script hash
+    /// @param method The method name
+    /// @param arguments The arguments
+    /// @return Reference to this template
+    ScriptTemplate& callContract(const Hash160& scriptHash, const std::string& method,
+                                 const std::vector<Argument>& arguments);
+
+    /// Append a contract call whose contract hash is a HASH160 slot
+    /// @param scriptHashSlot The name of the contract hash slot
+    /// @param method The method name
+    /// @param arguments The arguments
+    /// @return Reference to this template
+    ScriptTemplate& callContract(const std::string& scriptHashSlot, const std::string& method,
+                                 const std::vector<Argument>& arguments);
+
+    /// Append another template; slots with the same name are merged
+    /// @param other The template to append
+    /// @return Reference to this template
+    ScriptTemplate& append(const ScriptTemplate& other);
+
+    /// Get the slots in declaration order
+    [[nodiscard]] const std::vector<Slot>& getSlots() const { return slots_; }
+
+    /// Get the index of a named slot
+    /// @param name The slot name
+    /// @return The slot index
+    /// @throws IllegalArgumentException if there is no such slot
+    [[nodiscard]] size_t getSlotIndex(const std::string& name) const;
+
+    /// Create an empty set of values for this template
+    [[nodiscard]] Values newValues() const { return Values(*this); }
+
+    /// Instantiate into a buffer, replacing its contents. The buffer's capacity is reused.
+    /// @param values The slot values
+    /// @param out The output buffer
+    /// @throws IllegalStateException if a slot has no value
+    void instantiate(const Values& values, Bytes& out) const;
+
+    /// Instantiate into a new buffer
+    /// @param values The slot values
+    /// @return The script
+    [[nodiscard]] Bytes instantiate(const Values& values) const;
+
+private:
+    /// Constant bytes code_[offset, offset + length) followed by slot `slot` (or no slot)
+    struct Segment {
+        size_t offset;
+        size_t length;
+        size_t slot;
+    };
+
+    static constexpr size_t NO_SLOT = static_cast<size_t>(-1);
+
+    Bytes code_;
+    std::vector<Segment> segments_;
+    std::vector<Slot> slots_;
+
+    void appendConstant(const uint8_t* data, size_t length);
+    void appendSlot(size_t slot);
+    size_t declareSlot(const std::string& name, SlotType type);
+    void pushArgument(const Argument& argument);
+};
+
+} // namespace neocpp
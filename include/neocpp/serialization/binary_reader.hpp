@@ -6,21 +6,34 @@
 #include <stdexcept>
 #include <istream>
 #include <memory>
+#include <memory_resource>
+#include <utility>
 #include "neocpp/types/types.hpp"
+#include "neocpp/serialization/little_endian.hpp"
 
 namespace neocpp {
 
-/// Binary reader for Neo deserialization
+/// Binary reader for Neo deserialization.
+///
+/// A reader either owns a copy of its input or borrows the caller's buffer. Constructing from
+/// Bytes or a stream copies, so the source may go away while the reader is used. The pointer
+/// constructor and borrow() do not copy: the caller must keep the buffer alive and unchanged
+/// for as long as the reader and every view read from it (readBytesView, readVarBytesView, and
+/// objects deserialized from a borrowing reader) are in use.
 class BinaryReader {
 private:
     const uint8_t* data_;
     size_t size_;
     size_t position_;
-    std::vector<uint8_t> ownedData_;  // For stream-based construction
+    std::vector<uint8_t> ownedData_;  // For Bytes and stream-based construction
+    bool borrowed_;
+    std::pmr::memory_resource* resource_ = nullptr;
 
 public:
-    /// Constructor from byte array
+    /// Constructor from byte array; copies the data
     explicit BinaryReader(const Bytes& data);
+
+    /// Constructor over a borrowed buffer; does not copy
     BinaryReader(const uint8_t* data, size_t size);
     
     /// Constructor from input stream (reads all data)
@@ -28,6 +41,39 @@ public:
 
     ~BinaryReader() = default;
 
+    /// Create a reader over a borrowed buffer without copying it
+    /// @param data The buffer; must outlive the reader and everything deserialized from it
+    /// @return The reader
+    static BinaryReader borrow(ByteView data);
+
+    /// Check whether the reader borrows its input
+    /// @return True if views read from this reader point into the caller's buffer
+    [[nodiscard]] bool isBorrowed() const { return borrowed_; }
+
+    /// Allocate the objects deserialized from this reader from a memory resource, typically a
+    /// std::pmr::monotonic_buffer_resource sized for a whole block. Transactions, signers,
+    /// witnesses, attributes and witness rules then get their object and shared-pointer control
+    /// block from the resource. Every such object must be released before the resource is.
+    /// TransactionBuilder keeps using the global heap: it creates one transaction per build,
+    /// and that transaction is handed to the caller with no arena lifetime to tie it to.
+    /// @param resource The resource, or nullptr for the global heap (the default)
+    void setMemoryResource(std::pmr::memory_resource* resource) { resource_ = resource; }
+
+    /// Get the memory resource set with setMemoryResource
+    /// @return The resource, or nullptr
+    [[nodiscard]] std::pmr::memory_resource* getMemoryResource() const { return resource_; }
+
+    /// Create an object for a deserializer, in the reader's memory resource if one is set
+    /// @param args The constructor arguments
+    /// @return The object
+    template<typename T, typename... Args>
+    SharedPtr<T> makeShared(Args&&... args) const {
+        if (resource_) {
+            return std::allocate_shared<T>(std::pmr::polymorphic_allocator<T>(resource_), std::forward<Args>(args)...);
+        }
+        return std::make_shared<T>(std::forward<Args>(args)...);
+    }
+
     /// Read a single byte
     uint8_t readByte();
 
@@ -38,6 +84,11 @@ public:
     Bytes readBytes(size_t count);
     void readBytes(uint8_t* buffer, size_t count);
 
+    /// Read bytes without copying
+    /// @param count The number of bytes
+    /// @return A view into the input, valid while the input (borrowed) or the reader (owned) lives
+    ByteView readBytesView(size_t count);
+
     /// Read integers (little-endian)
     int8_t readInt8();
     uint8_t readUInt8();
@@ -54,6 +105,10 @@ public:
     /// Read variable length bytes
     Bytes readVarBytes();
 
+    /// Read variable length bytes without copying
+    /// @return A view into the input, with the same lifetime as readBytesView
+    ByteView readVarBytesView();
+
     /// Read variable length string
     std::string readVarString();
 
@@ -104,17 +159,24 @@ public:
     void seek(size_t position);
     
 private:
+    /// Throw DeserializationException unless count more bytes are available
+    void ensureAvailable(size_t count) const;
+
     template<typename T>
     T readArithmetic() {
         static_assert(sizeof(T) <= 8, "Type too large");
-        T value = 0;
-        if (position_ + sizeof(T) > size_) {
-            throw std::runtime_error("Not enough data to read");
-        }
-        // Little-endian read
-        for (size_t i = 0; i < sizeof(T); ++i) {
-            value |= static_cast<T>(data_[position_ + i]) << (8 * i);
+        if constexpr (std::is_same<T, bool>::value) {
+            return readBool();
+        } else {
+            return readLittleEndian<T>();
         }
+    }
+
+    /// Read a little-endian integer with a single bounds check
+    template<typename T>
+    T readLittleEndian() {
+        ensureAvailable(sizeof(T));
+        T value = LittleEndian::load<T>(data_ + position_);
         position_ += sizeof(T);
         return value;
     }
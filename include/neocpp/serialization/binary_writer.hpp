@@ -5,11 +5,14 @@
 #include <cstdint>
 #include <cstring>
 #include <iostream>
+#include <type_traits>
 #include "neocpp/types/types.hpp"
+#include "neocpp/serialization/little_endian.hpp"
 
 namespace neocpp {
 
-/// Binary writer for Neo serialization
+/// Binary writer for Neo serialization.
+/// Multi-byte values are encoded whole and appended with one buffer grow or one stream write.
 class BinaryWriter {
 private:
     std::vector<uint8_t> buffer_;
@@ -118,9 +121,22 @@ private:
     template<typename T>
     void writeArithmetic(T value) {
         static_assert(sizeof(T) <= 8, "Type too large");
-        // Little-endian write
-        for (size_t i = 0; i < sizeof(T); ++i) {
-            writeByte(static_cast<uint8_t>((value >> (i * 8)) & 0xFF));
+        if constexpr (std::is_enum<T>::value) {
+            writeLittleEndian(static_cast<typename std::underlying_type<T>::type>(value));
+        } else {
+            writeLittleEndian(value);
+        }
+    }
+
+    /// Append a little-endian integer in one step
+    template<typename T>
+    void writeLittleEndian(T value) {
+        uint8_t bytes[sizeof(T)];
+        LittleEndian::store(bytes, value);
+        if (stream_) {
+            stream_->write(reinterpret_cast<const char*>(bytes), sizeof(T));
+        } else {
+            buffer_.insert(buffer_.end(), bytes, bytes + sizeof(T));
         }
     }
 };
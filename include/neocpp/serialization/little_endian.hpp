@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace neocpp {
+
+/// Little-endian load and store of fixed-width integers.
+/// On little-endian hosts these compile to a single unaligned move; big-endian hosts byte-swap.
+class LittleEndian {
+public:
+    /// Encode an integer
+    /// @param out Destination of sizeof(T) bytes
+    /// @param value The value
+    template<typename T>
+    static void store(uint8_t* out, T value) {
+        static_assert(std::is_integral<T>::value && !std::is_same<T, bool>::value, "T must be an integer type");
+        using U = typename std::make_unsigned<T>::type;
+        U raw = toHost(static_cast<U>(value));
+        std::memcpy(out, &raw, sizeof(U));
+    }
+
+    /// Decode an integer
+    /// @param in Source of sizeof(T) bytes
+    /// @return The value
+    template<typename T>
+    static T load(const uint8_t* in) {
+        static_assert(std::is_integral<T>::value && !std::is_same<T, bool>::value, "T must be an integer type");
+        using U = typename std::make_unsigned<T>::type;
+        U raw;
+        std::memcpy(&raw, in, sizeof(U));
+        return static_cast<T>(toHost(raw));
+    }
+
+private:
+    /// Convert between little-endian and host order (an involution)
+    template<typename U>
+    static U toHost(U value) {
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        if constexpr (sizeof(U) == 1) {
+            return value;
+        } else if constexpr (sizeof(U) == 2) {
+            return static_cast<U>(__builtin_bswap16(value));
+        } else if constexpr (sizeof(U) == 4) {
+            return static_cast<U>(__builtin_bswap32(value));
+        } else {
+            return static_cast<U>(__builtin_bswap64(value));
+        }
+#else
+        return value;
+#endif
+    }
+};
+
+} // namespace neocpp
@@ -15,13 +15,34 @@ class Transaction;
 class Account;
 class Witness;
 
-/// Context for collecting signatures for multi-sig transactions
+/// A signature waiting to be added to a ContractParametersContext
+struct PendingSignature {
+    Hash160 scriptHash;
+    Bytes publicKey;
+    Bytes signature;
+};
+
+/// Context for collecting signatures for multi-sig transactions.
+/// Signatures are verified against the transaction hash when they are added and kept per public key,
+/// so partial contexts from several parties can be merged and the invocation script lists the
+/// signatures in the order of the public keys in the verification script.
 class ContractParametersContext {
+public:
+    /// Version byte of the binary format
+    static constexpr uint8_t BINARY_FORMAT_VERSION = 0x00;
+
 private:
+    /// Signatures collected for one script hash
+    struct Item {
+        Bytes verificationScript;
+        int signingThreshold = 1;
+        std::vector<Bytes> publicKeys;       // In script order; empty for non-standard scripts
+        std::map<Bytes, Bytes> signatures;   // Public key -> signature
+    };
+
     SharedPtr<Transaction> transaction_;
-    std::map<Hash160, std::vector<Bytes>> signatures_;
-    std::map<Hash160, Bytes> verificationScripts_;
-    mutable std::map<Hash160, std::pair<int, int>> scriptInfo_; // m,n values for multi-sig
+    std::map<Hash160, Item> items_;
+    unsigned int threads_ = 0;
 
 public:
     /// Constructor
@@ -34,22 +55,47 @@ public:
     /// Get the transaction
     SharedPtr<Transaction> getTransaction() const { return transaction_; }
 
+    /// Set the number of threads used to verify batches of signatures
+    /// @param threads The thread count (0 = hardware concurrency)
+    void setThreads(unsigned int threads) { threads_ = threads; }
+
+    /// Set the verification script of a signer, e.g. a multi-sig account's script
+    /// @param script The verification script
+    /// @throws IllegalArgumentException if the script does not belong to a signer
+    void setVerificationScript(const Bytes& script);
+
     /// Add signature
     /// @param account The signing account
     /// @param signature The signature
+    /// @throws IllegalArgumentException if the signature does not verify
     void addSignature(const SharedPtr<Account>& account, const Bytes& signature);
 
     /// Add signature
     /// @param scriptHash The script hash
     /// @param publicKey The public key
     /// @param signature The signature
-    void addSignature(const Hash160& scriptHash, const Bytes& publicKey, const Bytes& signature);
+    /// @return False if the public key had already signed
+    /// @throws IllegalArgumentException if the key is not part of the script or the signature does not verify
+    bool addSignature(const Hash160& scriptHash, const Bytes& publicKey, const Bytes& signature);
+
+    /// Add many signatures. All are verified, across threads, before any is added.
+    /// @param signatures The signatures
+    /// @return The number of signatures added (already present keys are skipped)
+    /// @throws IllegalArgumentException if any key is not part of its script or any signature does not verify
+    size_t addSignatures(const std::vector<PendingSignature>& signatures);
 
-    /// Sign with account
+    /// Sign with account, for the account itself and every multi-sig script containing its key
     /// @param account The account to sign with
     /// @return True if signature was added
     bool sign(const SharedPtr<Account>& account);
 
+    /// Merge the verification scripts and signatures of another context for the same transaction.
+    /// The other context's signatures are verified again.
+    /// @param other The other context
+    /// @return The number of signatures added
+    /// @throws IllegalArgumentException if the contexts are for different transactions
+    size_t merge(const ContractParametersContext& other);
+
     /// Check if all signatures are collected
     /// @return True if complete
     bool isComplete() const;
@@ -72,14 +118,44 @@ public:
     /// @return JSON representation
     nlohmann::json toJson() const;
 
-    /// Import from JSON
+    /// Import from JSON, verifying every signature
     /// @param json The JSON data
     /// @return The context
+    /// @throws DeserializationException if a verification script is not a signer's or does not match its hash
     static SharedPtr<ContractParametersContext> fromJson(const nlohmann::json& json);
 
+    /// Export to the compact binary format: version, signed transaction, then per script hash
+    /// the verification script and (public key, signature) pairs
+    /// @return The encoded context
+    [[nodiscard]] Bytes toArray() const;
+
+    /// Import from the compact binary format, verifying every signature
+    /// @param data The encoded context
+    /// @return The context
+    /// @throws DeserializationException if the data is malformed, or a verification script is not a
+    ///         signer's or does not match its hash
+    static SharedPtr<ContractParametersContext> fromArray(const Bytes& data);
+
 private:
-    /// Parse verification script
-    void parseVerificationScript(const Hash160& scriptHash, const Bytes& script);
+    /// Store a verification script and parse its threshold and public keys
+    void setVerificationScript(const Hash160& scriptHash, const Bytes& script);
+
+    /// Set an item's verification script, threshold and public keys
+    static void parseVerificationScript(Item& item, const Bytes& script);
+
+    /// Store a verification script read from an export
+    /// @throws DeserializationException if the script hash is not a signer or the script does not hash to it
+    void loadVerificationScript(const Hash160& scriptHash, const Bytes& script);
+
+    /// Verify signatures, then set the given verification scripts and add the signatures
+    /// @param signatures The signatures
+    /// @param scripts Verification scripts to set with them, by script hash; signatures are checked against these
+    size_t addSignatures(const std::vector<PendingSignature>& signatures, const std::map<Hash160, Item>& scripts);
+
+    /// Check a signature's public key against its script and verify it against the transaction hash
+    /// @param scripts Verification scripts not yet set, checked before the stored ones
+    void verifySignature(const PendingSignature& pending, const Bytes& hash,
+                         const std::map<Hash160, Item>& scripts = {}) const;
 
     /// Get required signature count
     [[nodiscard]] int getRequiredSignatures(const Hash160& scriptHash) const;
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "neocpp/types/types.hpp"
+#include "neocpp/types/hash160.hpp"
+#include "neocpp/neo_constants.hpp"
+#include "neocpp/script/script_template.hpp"
+
+namespace neocpp {
+
+// Forward declarations
+class Transaction;
+class NeoRpcClient;
+class Account;
+
+/// One row of a bulk NEP-17 payout
+struct Nep17Transfer {
+    Hash160 token;
+    Hash160 recipient;
+    int64_t amount;
+};
+
+/// A payout transaction and the range of transfers it carries
+struct Nep17PayoutBatch {
+    SharedPtr<Transaction> transaction;
+    size_t firstTransfer;
+    size_t transferCount;
+};
+
+/// Packs many NEP-17 transfers from one sender into as few transactions as possible.
+///
+/// Transfers are kept in the order they were added and packed greedily: a transaction is
+/// closed when the next transfer would take its signed size over the size limit or its
+/// system fee over the system-fee budget. Packing uses a fee template per token: one
+/// simulated transfer of the token's largest amount to a recipient without a balance, the
+/// costliest case for a plain account. Each packed transaction is then simulated as a whole
+/// and charged the larger of that result and the sum of its templates, so recipients that
+/// are contracts are priced too. The network fee is priced locally with NetworkFeeCalculator,
+/// so planning N transfers costs one RPC call per token and per transaction rather than per
+/// transfer. Every transfer is followed by ASSERT, so a transaction faults rather than
+/// half-paying when one transfer returns false.
+class Nep17PayoutPlanner {
+public:
+    /// Neo N3 MaxBlockSystemFee (1500 GAS); a transaction above it can never be included
+    static constexpr int64_t DEFAULT_MAX_SYSTEM_FEE = 150000000000;
+
+    /// Same default validity window as TransactionBuilder
+    static constexpr uint32_t DEFAULT_VALID_UNTIL_BLOCK_INCREMENT = 100;
+
+    /// Constructor
+    /// @param client The RPC client used to simulate transfers and read chain state
+    /// @param sender The paying account; must hold a private key
+    Nep17PayoutPlanner(const SharedPtr<NeoRpcClient>& client, const SharedPtr<Account>& sender);
+
+    /// Add a transfer
+    /// @param token The NEP-17 contract hash
+    /// @param recipient The recipient script hash
+    /// @param amount The amount in token fractions
+    /// @return Reference to this planner
+    Nep17PayoutPlanner& addTransfer(const Hash160& token, const Hash160& recipient, int64_t amount);
+
+    /// Add a transfer
+    /// @param token The NEP-17 contract hash
+    /// @param recipient The recipient address
+    /// @param amount The amount in token fractions
+    /// @return Reference to this planner
+    Nep17PayoutPlanner& addTransfer(const Hash160& token, const std::string& recipient, int64_t amount);
+
+    /// Add transfers
+    /// @param transfers The transfers
+    /// @return Reference to this planner
+    Nep17PayoutPlanner& addTransfers(const std::vector<Nep17Transfer>& transfers);
+
+    /// Set the system-fee budget of each transaction
+    /// @param fee The budget in GAS fractions
+    /// @return Reference to this planner
+    Nep17PayoutPlanner& setMaxSystemFee(int64_t fee);
+
+    /// Set the signed size limit of each transaction
+    /// @param size The limit in bytes, at most NeoConstants::MAX_TRANSACTION_SIZE
+    /// @return Reference to this planner
+    Nep17PayoutPlanner& setMaxTransactionSize(size_t size);
+
+    /// Set the valid-until-block of every transaction relative to the current block count
+    /// @param blocks The number of blocks
+    /// @return Reference to this planner
+    Nep17PayoutPlanner& setValidUntilBlockIncrement(uint32_t blocks);
+
+    /// Set the nonce of the first transaction; the following transactions count up from it.
+    /// By default the first nonce is random.
+    /// @param nonce The first nonce
+    /// @return Reference to this planner
+    Nep17PayoutPlanner& setFirstNonce(uint32_t nonce);
+
+    /// Set the number of threads used to build scripts and sign
+    /// @param threads The thread count (0 = hardware concurrency)
+    /// @return Reference to this planner
+    Nep17PayoutPlanner& setThreads(unsigned int threads);
+
+    [[nodiscard]] const std::vector<Nep17Transfer>& getTransfers() const { return transfers_; }
+    [[nodiscard]] int64_t getMaxSystemFee() const { return maxSystemFee_; }
+    [[nodiscard]] size_t getMaxTransactionSize() const { return maxTransactionSize_; }
+
+    /// Get the system fee template of a token, simulating it on first use: the token's largest
+    /// added amount sent to a recipient that has no balance yet
+    /// @param token The NEP-17 contract hash
+    /// @return The fee template in GAS fractions
+    /// @throws IllegalArgumentException if no transfer of the token was added
+    /// @throws IllegalStateException if the simulated transfer does not halt
+    int64_t getTransferFee(const Hash160& token);
+
+    /// Pack the transfers into unsigned transactions with nonces, valid-until-blocks and fees set
+    /// @return The batches, in transfer order
+    /// @throws IllegalStateException if no transfers were added
+    /// @throws TransactionException if a single transfer exceeds the size limit or fee budget,
+    ///         or a simulated transaction exceeds the fee budget
+    /// @throws IllegalStateException if a simulated transaction does not halt
+    std::vector<Nep17PayoutBatch> plan();
+
+    /// Sign planned transactions with the sender, in parallel
+    /// @param batches The batches returned by plan()
+    void sign(const std::vector<Nep17PayoutBatch>& batches) const;
+
+    /// Plan and sign
+    /// @return The signed batches
+    std::vector<Nep17PayoutBatch> build();
+
+private:
+    SharedPtr<NeoRpcClient> client_;
+    SharedPtr<Account> sender_;
+    std::vector<Nep17Transfer> transfers_;
+    std::map<Hash160, int64_t> transferFees_;
+
+    int64_t maxSystemFee_ = DEFAULT_MAX_SYSTEM_FEE;
+    size_t maxTransactionSize_ = NeoConstants::MAX_TRANSACTION_SIZE;
+    uint32_t validUntilBlockIncrement_ = DEFAULT_VALID_UNTIL_BLOCK_INCREMENT;
+    bool hasFirstNonce_ = false;
+    uint32_t firstNonce_ = 0;
+    unsigned int threads_ = 0;
+
+    /// transfer(sender, to, amount, null) followed by ASSERT, with the token, recipient and amount as slots
+    ScriptTemplate transferTemplate_;
+    size_t tokenSlot_;
+    size_t recipientSlot_;
+    size_t amountSlot_;
+
+    /// Simulate a script signed by the sender
+    /// @param script The script
+    /// @param what Names the script in error messages
+    /// @return The GAS consumed
+    /// @throws IllegalStateException if the script does not halt
+    int64_t simulate(const Bytes& script, const std::string& what) const;
+
+    /// Script of one transfer, written into a reused buffer
+    void buildTransferScript(const Nep17Transfer& transfer, ScriptTemplate::Values& values, Bytes& out) const;
+};
+
+} // namespace neocpp
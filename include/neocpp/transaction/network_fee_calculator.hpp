@@ -0,0 +1,130 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "neocpp/types/types.hpp"
+
+namespace neocpp {
+
+// Forward declarations
+class Transaction;
+class NeoRpcClient;
+
+/// Local network fee engine for standard verification scripts.
+///
+/// Mirrors the node's `calculatenetworkfee` for single-signature and multi-signature
+/// accounts: the fee is the serialized size of the signed transaction times the policy's
+/// fee per byte, plus the verification execution cost times the execution fee factor.
+/// Scripts that are not standard accounts, and attributes that carry a fee, cannot be priced locally.
+class NetworkFeeCalculator {
+public:
+    /// Neo N3 default policy fee per byte (GAS fractions)
+    static constexpr int64_t DEFAULT_FEE_PER_BYTE = 1000;
+
+    /// Neo N3 default execution fee factor
+    static constexpr int32_t DEFAULT_EXEC_FEE_FACTOR = 30;
+
+    /// Base price of System.Crypto.CheckSig (charged once per public key for multi-sig)
+    static constexpr int64_t CHECK_SIG_PRICE = 1 << 15;
+
+    /// Base price of a data push
+    static constexpr int64_t PUSHDATA_PRICE = 1 << 3;
+
+    /// Base price of an integer constant push (PUSH0-PUSH16, PUSHINT8-PUSHINT64)
+    static constexpr int64_t PUSH_INTEGER_PRICE = 1;
+
+    /// Base price of the SYSCALL opcode itself
+    static constexpr int64_t SYSCALL_PRICE = 0;
+
+    /// Constructor
+    /// @param feePerByte The policy fee per byte
+    /// @param execFeeFactor The policy execution fee factor
+    explicit NetworkFeeCalculator(int64_t feePerByte = DEFAULT_FEE_PER_BYTE,
+                                  int32_t execFeeFactor = DEFAULT_EXEC_FEE_FACTOR);
+
+    /// Get a calculator using the policy values of the network behind a client.
+    /// The values come from the client's shared ChainStateCache.
+    /// @param client The RPC client
+    /// @param refresh Whether to re-fetch the policy values
+    /// @return The calculator
+    static SharedPtr<NetworkFeeCalculator> fromClient(const SharedPtr<NeoRpcClient>& client, bool refresh = false);
+
+    /// Drop all cached policy values
+    static void clearCache();
+
+    [[nodiscard]] int64_t getFeePerByte() const { return feePerByte_; }
+    [[nodiscard]] int32_t getExecFeeFactor() const { return execFeeFactor_; }
+
+    /// Check whether a script is a standard single-signature verification script
+    /// @param script The verification script
+    /// @return True if single-sig
+    static bool isSignatureContract(const Bytes& script);
+
+    /// Check whether a script is a standard single-signature verification script
+    /// @param script The verification script
+    /// @param publicKey Receives the encoded public key
+    /// @return True if single-sig
+    static bool isSignatureContract(const Bytes& script, Bytes& publicKey);
+
+    /// Check whether a script is a standard multi-signature verification script.
+    /// The keys are only counted, not copied.
+    /// @param script The verification script
+    /// @param signingThreshold Receives the number of required signatures
+    /// @param publicKeyCount Receives the number of public keys
+    /// @return True if multi-sig
+    static bool isMultiSigContract(const Bytes& script, int& signingThreshold, int& publicKeyCount);
+
+    /// Check whether a script is a standard multi-signature verification script
+    /// @param script The verification script
+    /// @param signingThreshold Receives the number of required signatures
+    /// @param publicKeys Receives the encoded public keys in script order
+    /// @return True if multi-sig
+    static bool isMultiSigContract(const Bytes& script, int& signingThreshold, std::vector<Bytes>& publicKeys);
+
+    /// Check whether a verification script can be priced locally
+    /// @param script The verification script
+    /// @return True if the script is a standard single-sig or multi-sig script
+    static bool canPrice(const Bytes& script);
+
+    /// Check whether the attributes of a transaction can be priced locally. HighPriority is free;
+    /// any other attribute may carry a policy attribute fee (Conflicts is charged once per signer)
+    /// that only the node knows, so such transactions are priced with `calculatenetworkfee`.
+    /// @param transaction The transaction
+    /// @return True if every attribute is HighPriority
+    static bool canPriceAttributes(const Transaction& transaction);
+
+    /// Verification execution cost of a single-signature account, before the fee factor
+    static int64_t signatureContractCost();
+
+    /// Verification execution cost of an m-of-n multi-signature account, before the fee factor
+    /// @param signingThreshold The number of required signatures (m)
+    /// @param publicKeyCount The number of public keys (n)
+    static int64_t multiSignatureContractCost(int signingThreshold, int publicKeyCount);
+
+    /// Size of the invocation script that will satisfy a verification script
+    /// @param script A standard verification script
+    /// @return The invocation script size in bytes
+    static size_t invocationScriptSize(const Bytes& script);
+
+    /// Network fee of a single witness: its serialized size plus its execution cost
+    /// @param verificationScript A standard verification script
+    /// @return The witness fee in GAS fractions
+    /// @throws IllegalArgumentException if the script is not a standard account script
+    [[nodiscard]] int64_t calculateWitnessFee(const Bytes& verificationScript) const;
+
+    /// Network fee of a transaction once signed by the given verification scripts.
+    /// Existing witnesses on the transaction are ignored.
+    /// @param transaction The unsigned transaction
+    /// @param verificationScripts One standard verification script per witness, in witness order
+    /// @return The network fee in GAS fractions
+    /// @throws IllegalArgumentException if a script is not a standard account script, or an
+    ///         attribute cannot be priced locally (see canPriceAttributes)
+    [[nodiscard]] int64_t calculate(const Transaction& transaction, const std::vector<Bytes>& verificationScripts) const;
+
+private:
+    int64_t feePerByte_;
+    int32_t execFeeFactor_;
+};
+
+} // namespace neocpp
@@ -2,6 +2,7 @@
 
 #include <vector>
 #include <memory>
+#include <string>
 #include "neocpp/types/types.hpp"
 #include "neocpp/types/hash256.hpp"
 #include "neocpp/serialization/neo_serializable.hpp"
@@ -29,8 +30,25 @@ private:
     Bytes script_;
     std::vector<SharedPtr<Witness>> witnesses_;
 
+    // Set when deserialized from a borrowing BinaryReader: the script stays a view into the
+    // caller's buffer until setScript(). getScript() copies it out once and publishes the copy
+    // atomically, so concurrent getScript() calls on a shared transaction are safe.
+    ByteView scriptView_;
+    bool scriptBorrowed_;
+    mutable SharedPtr<const Bytes> ownedScript_;
+
+    // Serialization cache, filled on first use and reset by every mutator.
+    // The witness-free encoding (hash data) survives adding or clearing witnesses.
+    // It is not synchronized: getHash(), getBytes(), getSize() and toBase64() must not run
+    // concurrently on one transaction until the values they need are cached.
     mutable Hash256 hash_;
     mutable bool hashCalculated_;
+    mutable Bytes unsignedBytes_;
+    mutable bool unsignedCached_;
+    mutable Bytes bytes_;
+    mutable bool bytesCached_;
+    mutable std::string base64_;
+    mutable bool base64Cached_;
 
 public:
     /// Constructor
@@ -46,19 +64,23 @@ public:
     [[nodiscard]] int64_t getNetworkFee() const { return networkFee_; }
     [[nodiscard]] uint32_t getValidUntilBlock() const { return validUntilBlock_; }
     const std::vector<SharedPtr<Signer>>& getSigners() const { return signers_; }
-    void clearSigners() { signers_.clear(); }
+    void clearSigners() { signers_.clear(); invalidateCache(); }
     const std::vector<SharedPtr<TransactionAttribute>>& getAttributes() const { return attributes_; }
-    const Bytes& getScript() const { return script_; }
+    /// Get the script; a borrowed script is copied out once, on the first call from any thread
+    const Bytes& getScript() const { return scriptBorrowed_ ? getOwnedScript() : script_; }
+
+    /// Get the script without copying a borrowed script
+    [[nodiscard]] ByteView getScriptView() const { return scriptBorrowed_ ? scriptView_ : ByteView(script_); }
     const std::vector<SharedPtr<Witness>>& getWitnesses() const { return witnesses_; }
-    void clearWitnesses() { witnesses_.clear(); }
+    void clearWitnesses() { witnesses_.clear(); invalidateWitnessCache(); }
 
     // Setters
-    void setVersion(uint8_t version) { version_ = version; hashCalculated_ = false; }
-    void setNonce(uint32_t nonce) { nonce_ = nonce; hashCalculated_ = false; }
-    void setSystemFee(int64_t fee) { systemFee_ = fee; hashCalculated_ = false; }
-    void setNetworkFee(int64_t fee) { networkFee_ = fee; hashCalculated_ = false; }
-    void setValidUntilBlock(uint32_t block) { validUntilBlock_ = block; hashCalculated_ = false; }
-    void setScript(const Bytes& script) { script_ = script; hashCalculated_ = false; }
+    void setVersion(uint8_t version) { version_ = version; invalidateCache(); }
+    void setNonce(uint32_t nonce) { nonce_ = nonce; invalidateCache(); }
+    void setSystemFee(int64_t fee) { systemFee_ = fee; invalidateCache(); }
+    void setNetworkFee(int64_t fee) { networkFee_ = fee; invalidateCache(); }
+    void setValidUntilBlock(uint32_t block) { validUntilBlock_ = block; invalidateCache(); }
+    void setScript(const Bytes& script) { script_ = script; scriptBorrowed_ = false; ownedScript_.reset(); invalidateCache(); }
 
     /// Add a signer
     void addSigner(const SharedPtr<Signer>& signer);
@@ -86,8 +108,21 @@ public:
     Hash256 calculateHash() const;
 
     /// Get the data to be signed for witnesses
-    /// @return The signing data
-    [[nodiscard]] Bytes getHashData() const;
+    /// @return The signing data (the witness-free encoding), serialized once and cached
+    [[nodiscard]] const Bytes& getHashData() const;
+
+    /// Get the serialized transaction, including witnesses
+    /// @return The encoding, serialized once and cached
+    [[nodiscard]] const Bytes& getBytes() const;
+
+    /// Get the serialized transaction as Base64, as sent to sendrawtransaction
+    /// @return The Base64 encoding, cached
+    [[nodiscard]] const std::string& toBase64() const;
+
+    /// Drop the cached encodings and hash.
+    /// Every mutator of Transaction calls this; call it yourself after changing a signer,
+    /// attribute or witness in place through its shared pointer.
+    void invalidateCache();
 
     /// Verify the transaction
     /// @return True if valid
@@ -100,12 +135,31 @@ public:
     // NeoSerializable interface
     [[nodiscard]] size_t getSize() const override;
     void serialize(BinaryWriter& writer) const override;
+
+    /// Deserialize a transaction. With a borrowing reader the script and witness scripts stay
+    /// views into the reader's buffer, which must then outlive the transaction.
+    /// @param reader The reader
+    /// @return The transaction
     static SharedPtr<Transaction> deserialize(BinaryReader& reader);
 
+    /// Convert the transaction to a byte array; a copy of getBytes()
+    /// @return The serialized bytes
+    [[nodiscard]] Bytes toArray() const;
+
     /// Serialize unsigned transaction (without witnesses)
     void serializeUnsigned(BinaryWriter& writer) const;
 
+    /// Get the size of the unsigned transaction (without the witness count and witnesses)
+    /// @return The size in bytes
+    [[nodiscard]] size_t getUnsignedSize() const;
+
 private:
+    /// Get the copy of a borrowed script, made by the first caller; safe to call concurrently
+    const Bytes& getOwnedScript() const;
+
+    /// Drop the encodings that include witnesses, keeping the hash and hash data
+    void invalidateWitnessCache();
+
     /// Generate a random nonce for the transaction
     static uint32_t generateNonce();
 };
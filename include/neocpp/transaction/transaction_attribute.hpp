@@ -76,6 +76,12 @@ private:
     Bytes result_;
 
 public:
+    /// Largest result a node accepts
+    static constexpr size_t MAX_RESULT_SIZE = 0xFFFF;
+
+    /// Response code of a successful request; any other code must come with an empty result
+    static constexpr uint8_t CODE_SUCCESS = 0x00;
+
     OracleResponseAttribute(uint64_t id, uint8_t code, const Bytes& result)
         : id_(id), code_(code), result_(result) {}
     [[nodiscard]] TransactionAttributeType getType() const override {
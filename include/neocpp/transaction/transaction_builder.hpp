@@ -92,7 +92,8 @@ public:
     /// @return Reference to this builder
     TransactionBuilder& setNetworkFee(int64_t fee);
 
-    /// Calculate and set the network fee automatically
+    /// Calculate and set the network fee automatically, including the additional network fee.
+    /// Standard single-sig and multi-sig signing accounts are priced locally; see NetworkFeeCalculator.
     /// @return Reference to this builder
     TransactionBuilder& calculateNetworkFee();
 
@@ -174,7 +175,8 @@ public:
     /// @return Reference to this builder
     TransactionBuilder& extendScript(const Bytes& script);
 
-    /// Build and get unsigned transaction
+    /// Build and get unsigned transaction.
+    /// The valid-until-block, committee, system fee, network fee and balance lookups are issued concurrently.
     /// @return The unsigned transaction
     SharedPtr<Transaction> getUnsignedTransaction();
 
@@ -271,16 +273,18 @@ private:
     bool signersContainMultiSigWithCommitteeMember(const std::vector<Hash160>& committee);
 
     /// Get system fee for script
-    [[nodiscard]] int64_t getSystemFeeForScript();
+    /// @param transaction The transaction whose script and signers are simulated
+    [[nodiscard]] int64_t getSystemFeeForScript(const Transaction& transaction);
 
-    /// Calculate network fee using RPC
-    int64_t calcNetworkFee();
+    /// Calculate network fee, locally for standard accounts and via RPC otherwise
+    /// @param transaction The transaction to price
+    int64_t calcNetworkFee(const Transaction& transaction);
 
     /// Get sender's GAS balance
     [[nodiscard]] int64_t getSenderGasBalance();
 
-    /// Check if sender can cover fees
-    bool canSendCoverFees(int64_t fees);
+    /// Get the current block count from the RPC client
+    [[nodiscard]] uint32_t getCurrentBlockCount();
 
     /// Create fake verification script for fee calculation
     Bytes createFakeVerificationScript(const SharedPtr<Account>& account);
@@ -10,11 +10,32 @@ namespace neocpp {
 class BinaryWriter;
 class BinaryReader;
 
-/// Represents a transaction witness
+/// Represents a transaction witness.
+///
+/// A witness deserialized from a borrowing BinaryReader keeps views into the reader's buffer
+/// instead of copying its scripts; the buffer must outlive the witness. Sizing, serializing and
+/// comparing use the views directly. getInvocationScript/getVerificationScript copy the scripts
+/// out on first call and publish the copy atomically, so concurrent getters are safe.
 class Witness : public NeoSerializable {
 private:
+    /// Owned copies of borrowed scripts
+    struct OwnedScripts {
+        Bytes invocation;
+        Bytes verification;
+    };
+
     Bytes invocationScript_;
     Bytes verificationScript_;
+    ByteView invocationView_;
+    ByteView verificationView_;
+    bool borrowed_ = false;
+    mutable SharedPtr<const OwnedScripts> ownedScripts_;
+
+    /// Get the copies of borrowed scripts, made by the first caller; safe to call concurrently
+    const OwnedScripts& getOwnedScripts() const;
+
+    /// Take ownership of borrowed scripts before a setter changes one of them
+    void materialize();
 
 public:
     /// Constructor
@@ -28,13 +49,22 @@ public:
     /// Destructor
     ~Witness() = default;
 
-    // Getters
-    const Bytes& getInvocationScript() const { return invocationScript_; }
-    const Bytes& getVerificationScript() const { return verificationScript_; }
+    // Getters; a borrowed script is copied out once, on the first call from any thread
+    const Bytes& getInvocationScript() const { return borrowed_ ? getOwnedScripts().invocation : invocationScript_; }
+    const Bytes& getVerificationScript() const { return borrowed_ ? getOwnedScripts().verification : verificationScript_; }
+
+    /// Get the invocation script without copying a borrowed script
+    [[nodiscard]] ByteView getInvocationScriptView() const { return borrowed_ ? invocationView_ : ByteView(invocationScript_); }
+
+    /// Get the verification script without copying a borrowed script
+    [[nodiscard]] ByteView getVerificationScriptView() const { return borrowed_ ? verificationView_ : ByteView(verificationScript_); }
+
+    /// Check whether the script views still refer to a deserialization buffer; true until a setter is called
+    [[nodiscard]] bool isBorrowed() const { return borrowed_; }
 
     // Setters
-    void setInvocationScript(const Bytes& script) { invocationScript_ = script; }
-    void setVerificationScript(const Bytes& script) { verificationScript_ = script; }
+    void setInvocationScript(const Bytes& script) { materialize(); invocationScript_ = script; }
+    void setVerificationScript(const Bytes& script) { materialize(); verificationScript_ = script; }
 
     /// Get the script hash of this witness
     /// @return The script hash
@@ -58,6 +88,10 @@ public:
     // NeoSerializable interface
     [[nodiscard]] size_t getSize() const override;
     void serialize(BinaryWriter& writer) const override;
+
+    /// Deserialize a witness; keeps views when the reader borrows its buffer
+    /// @param reader The reader
+    /// @return The witness
     static SharedPtr<Witness> deserialize(BinaryReader& reader);
 
     // Comparison operators
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include "neocpp/types/types.hpp"
+
+namespace neocpp {
+
+/// Signed integer of up to 256 bits, the range of NeoVM integers (-2^255 to 2^255 - 1).
+/// The value is held inline as four 64-bit two's complement limbs, so it never allocates;
+/// values that fit in 64 bits take plain int64_t paths for parsing, formatting and encoding.
+/// Arithmetic that leaves the 256-bit range throws IllegalArgumentException.
+class BigInteger {
+public:
+    /// Size of the largest NeoVM integer in bytes
+    static constexpr size_t MAX_SIZE = 32;
+
+    /// Zero
+    constexpr BigInteger() : limbs_{0, 0, 0, 0} {}
+
+    /// From a 64-bit value; implicit so int64_t arguments keep working
+    constexpr BigInteger(int64_t value)  // NOLINT(google-explicit-constructor)
+        : limbs_{static_cast<uint64_t>(value), value < 0 ? ~0ULL : 0, value < 0 ? ~0ULL : 0, value < 0 ? ~0ULL : 0} {}
+
+    /// From an unsigned 64-bit value
+    static BigInteger fromUnsigned(uint64_t value);
+
+    /// Parse a decimal string with an optional leading '-'
+    /// @param text The decimal text
+    /// @return The value
+    /// @throws IllegalArgumentException if the text is not a decimal integer or exceeds 256 bits
+    static BigInteger parse(std::string_view text);
+
+    /// Decode NeoVM's little-endian two's complement encoding (empty is zero)
+    /// @param bytes Up to 32 bytes
+    /// @return The value
+    /// @throws IllegalArgumentException if there are more than 32 bytes
+    static BigInteger fromBytes(ByteView bytes);
+
+    /// 10 raised to a power, e.g. the factor for a token's decimals
+    /// @param exponent 0 to 76
+    /// @throws IllegalArgumentException if the result exceeds 256 bits
+    static BigInteger pow10(unsigned exponent);
+
+    /// Decimal text, with a leading '-' for negative values
+    [[nodiscard]] std::string toString() const;
+
+    /// NeoVM's shortest little-endian two's complement encoding (empty for zero)
+    [[nodiscard]] Bytes toBytes() const;
+
+    /// Write the value sign-extended to a fixed width
+    /// @param out Receives width bytes, little-endian
+    /// @param width At least getByteLength() and at most 32
+    void writeBytes(uint8_t* out, size_t width) const;
+
+    /// Length of toBytes()
+    [[nodiscard]] size_t getByteLength() const;
+
+    /// Check whether the value fits in an int64_t
+    [[nodiscard]] bool fitsInt64() const {
+        uint64_t extension = static_cast<int64_t>(limbs_[0]) < 0 ? ~0ULL : 0;
+        return limbs_[1] == extension && limbs_[2] == extension && limbs_[3] == extension;
+    }
+
+    /// Convert to int64_t
+    /// @throws IllegalStateException if the value does not fit
+    [[nodiscard]] int64_t toInt64() const;
+
+    /// -1, 0 or 1
+    [[nodiscard]] int sign() const;
+
+    [[nodiscard]] bool isZero() const {
+        return (limbs_[0] | limbs_[1] | limbs_[2] | limbs_[3]) == 0;
+    }
+
+    [[nodiscard]] bool isNegative() const {
+        return static_cast<int64_t>(limbs_[3]) < 0;
+    }
+
+    BigInteger operator-() const;
+    BigInteger operator+(const BigInteger& other) const;
+    BigInteger operator-(const BigInteger& other) const;
+    BigInteger operator*(const BigInteger& other) const;
+    BigInteger& operator+=(const BigInteger& other) { return *this = *this + other; }
+    BigInteger& operator-=(const BigInteger& other) { return *this = *this - other; }
+    BigInteger& operator*=(const BigInteger& other) { return *this = *this * other; }
+
+    friend bool operator==(const BigInteger& a, const BigInteger& b) {
+        return a.limbs_[0] == b.limbs_[0] && a.limbs_[1] == b.limbs_[1] &&
+               a.limbs_[2] == b.limbs_[2] && a.limbs_[3] == b.limbs_[3];
+    }
+    friend bool operator!=(const BigInteger& a, const BigInteger& b) { return !(a == b); }
+    friend bool operator<(const BigInteger& a, const BigInteger& b);
+    friend bool operator>(const BigInteger& a, const BigInteger& b) { return b < a; }
+    friend bool operator<=(const BigInteger& a, const BigInteger& b) { return !(b < a); }
+    friend bool operator>=(const BigInteger& a, const BigInteger& b) { return !(a < b); }
+
+private:
+    uint64_t limbs_[4];  // two's complement, least significant limb first
+};
+
+} // namespace neocpp
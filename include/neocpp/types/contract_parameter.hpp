@@ -6,6 +6,7 @@
 #include <variant>
 #include <nlohmann/json.hpp>
 #include "neocpp/types/types.hpp"
+#include "neocpp/types/big_integer.hpp"
 #include "neocpp/types/contract_parameter_type.hpp"
 #include "neocpp/types/hash160.hpp"
 #include "neocpp/types/hash256.hpp"
@@ -21,7 +22,7 @@ public:
     using ValueType = std::variant<
         std::monostate,           // Any or Void
         bool,                     // Boolean
-        int64_t,                  // Integer
+        BigInteger,               // Integer
         Bytes,                    // ByteArray
         std::string,              // String
         Hash160,                  // Hash160
@@ -48,6 +49,9 @@ public:
     /// Constructor for integer
     explicit ContractParameter(int64_t value);
 
+    /// Constructor for integer of up to 256 bits
+    explicit ContractParameter(const BigInteger& value);
+
     /// Constructor for byte array
     explicit ContractParameter(const Bytes& value);
 
@@ -86,7 +90,9 @@ public:
 
     // Value getters with type checking
     [[nodiscard]] bool getBoolean() const;
+    /// @throws IllegalStateException if the integer does not fit in 64 bits
     [[nodiscard]] int64_t getInteger() const;
+    [[nodiscard]] BigInteger getBigInteger() const;
     [[nodiscard]] Bytes getByteArray() const;
     std::string getString() const;
     [[nodiscard]] Hash160 getHash160() const;
@@ -119,6 +125,7 @@ public:
     static ContractParameter any();
     static ContractParameter boolean(bool value);
     static ContractParameter integer(int64_t value);
+    static ContractParameter integer(const BigInteger& value);
     static ContractParameter byteArray(const Bytes& value);
     static ContractParameter string(const std::string& value);
     static ContractParameter hash160(const Hash160& value);
@@ -65,6 +65,9 @@ public:
     /// @return The script hash as a byte array in little-endian order
     [[nodiscard]] Bytes toLittleEndianArray() const;
 
+    /// @return The hash bytes in big-endian order, without copying
+    [[nodiscard]] const std::array<uint8_t, NeoConstants::HASH160_SIZE>& getBytes() const { return hash_; }
+
     /// @return The address corresponding to this script hash
     [[nodiscard]] std::string toAddress() const;
 
@@ -68,6 +68,9 @@ public:
     /// @return The hash as a byte array in little-endian order
     [[nodiscard]] Bytes toLittleEndianArray() const;
 
+    /// @return The hash bytes in big-endian order, without copying
+    [[nodiscard]] const std::array<uint8_t, NeoConstants::HASH256_SIZE>& getBytes() const { return hash_; }
+
     // NeoSerializable interface
     [[nodiscard]] size_t getSize() const override;
     void serialize(BinaryWriter& writer) const override;
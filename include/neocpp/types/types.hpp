@@ -1,7 +1,9 @@
 #pragma once
 
 #include <vector>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <string>
 #include <memory>
 
@@ -59,6 +61,34 @@ public:
     static int64_t toInt64BE(const Bytes& bytes);
 };
 
+/// Non-owning, read-only view of contiguous bytes (std::span<const uint8_t> before C++20).
+/// A view is only valid while the buffer it points into is alive and unmodified.
+class ByteView {
+public:
+    constexpr ByteView() = default;
+    constexpr ByteView(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+    ByteView(const Bytes& bytes) : data_(bytes.data()), size_(bytes.size()) {}
+
+    [[nodiscard]] constexpr const uint8_t* data() const { return data_; }
+    [[nodiscard]] constexpr size_t size() const { return size_; }
+    [[nodiscard]] constexpr bool empty() const { return size_ == 0; }
+    [[nodiscard]] constexpr const uint8_t* begin() const { return data_; }
+    [[nodiscard]] constexpr const uint8_t* end() const { return data_ + size_; }
+    constexpr uint8_t operator[](size_t index) const { return data_[index]; }
+
+    /// Copy the viewed bytes into an owned array
+    [[nodiscard]] Bytes toBytes() const { return Bytes(begin(), end()); }
+
+    bool operator==(const ByteView& other) const {
+        return size_ == other.size_ && (size_ == 0 || std::memcmp(data_, other.data_, size_) == 0);
+    }
+    bool operator!=(const ByteView& other) const { return !(*this == other); }
+
+private:
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+};
+
 // Forward declarations for commonly used types
 class Hash160;
 class Hash256;
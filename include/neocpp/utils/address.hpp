@@ -1,6 +1,8 @@
 #pragma once
 
 #include <string>
+#include <string_view>
+#include <vector>
 #include "neocpp/types/types.hpp"
 
 namespace neocpp {
@@ -23,6 +25,27 @@ public:
     /// @return True if valid, false otherwise
     static bool isValidAddress(const std::string& address);
 
+    /// Validate an address and decode its script hash in one pass
+    /// @param address The Neo address
+    /// @param scriptHash Receives the 20-byte script hash in big-endian order
+    /// @return False if the address is not valid
+    static bool tryAddressToScriptHash(std::string_view address, uint8_t* scriptHash);
+
+    /// Convert many script hashes to addresses across worker threads
+    /// @param scriptHashes The script hashes in big-endian order
+    /// @param threads The number of worker threads (0 = hardware concurrency)
+    /// @return The addresses, in input order
+    static std::vector<std::string> scriptHashesToAddresses(const std::vector<Bytes>& scriptHashes,
+                                                            unsigned int threads = 0);
+
+    /// Convert many addresses to script hashes across worker threads
+    /// @param addresses The Neo addresses
+    /// @param threads The number of worker threads (0 = hardware concurrency)
+    /// @return The script hashes in big-endian order, in input order
+    /// @throws IllegalArgumentException if any address is invalid
+    static std::vector<Bytes> addressesToScriptHashes(const std::vector<std::string>& addresses,
+                                                      unsigned int threads = 0);
+
     /// Get the address version byte
     /// @return The version byte for Neo N3 addresses
     static uint8_t getAddressVersion();
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include "neocpp/types/types.hpp"
 
@@ -9,6 +10,15 @@ namespace neocpp {
 /// Base58 encoding and decoding utilities
 class Base58 {
 public:
+    /// Size of a fixed-width payload: a 21-byte body (Neo address version and script hash) plus checksum
+    static constexpr size_t FIXED_PAYLOAD_SIZE = 25;
+
+    /// Size of the body of a fixed-width Base58Check payload
+    static constexpr size_t FIXED_DATA_SIZE = 21;
+
+    /// Longest Base58 encoding of a fixed-width payload
+    static constexpr size_t FIXED_MAX_LENGTH = 35;
+
     /// Encode bytes to Base58 string
     /// @param data The data to encode
     /// @return The Base58 encoded string
@@ -29,6 +39,30 @@ public:
     /// @return The decoded bytes
     static Bytes decodeCheck(const std::string& encoded);
 
+    /// Encode a 25-byte payload using constant-size limb arithmetic. Same output as encode().
+    /// @param payload The FIXED_PAYLOAD_SIZE bytes to encode
+    /// @param out Receives up to FIXED_MAX_LENGTH characters (not null-terminated)
+    /// @return The number of characters written
+    static size_t encodeFixed(const uint8_t* payload, char* out);
+
+    /// Decode a string that encodes exactly 25 bytes, as decode() would
+    /// @param encoded The Base58 string
+    /// @param payload Receives FIXED_PAYLOAD_SIZE bytes
+    /// @return False if the string has invalid characters or does not decode to 25 bytes
+    static bool decodeFixed(std::string_view encoded, uint8_t* payload);
+
+    /// Base58Check-encode a 21-byte body
+    /// @param data The FIXED_DATA_SIZE bytes to encode
+    /// @param out Receives up to FIXED_MAX_LENGTH characters (not null-terminated)
+    /// @return The number of characters written
+    static size_t encodeCheckFixed(const uint8_t* data, char* out);
+
+    /// Decode a Base58Check string with a 21-byte body and verify its checksum in one pass
+    /// @param encoded The Base58Check string
+    /// @param data Receives FIXED_DATA_SIZE bytes
+    /// @return False if the string is not a valid Base58Check encoding of 21 bytes
+    static bool decodeCheckFixed(std::string_view encoded, uint8_t* data);
+
 private:
     static const char* ALPHABET;
     static const int BASE;
@@ -1,6 +1,11 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <streambuf>
 #include <string>
+#include <string_view>
 #include "neocpp/types/types.hpp"
 
 namespace neocpp {
@@ -13,15 +18,96 @@ public:
     /// @return The Base64 encoded string
     static std::string encode(const Bytes& data);
 
+    /// Encode bytes to Base64 string
+    /// @param data The data to encode
+    /// @param size Number of bytes
+    /// @return The Base64 encoded string
+    static std::string encode(const uint8_t* data, size_t size);
+
+    /// Encode bytes into a caller-provided buffer (padded, no terminator)
+    /// @param data The data to encode
+    /// @param size Number of bytes
+    /// @param out Destination with room for encodedLength(size) characters
+    static void encode(const uint8_t* data, size_t size, char* out);
+
     /// Decode Base64 string to bytes
     /// @param encoded The Base64 encoded string
     /// @return The decoded bytes
     static Bytes decode(const std::string& encoded);
 
+    /// Decode into a caller-provided buffer without allocating
+    /// @param encoded The Base64 encoded string (standard or URL-safe alphabet)
+    /// @param out Destination with room for maxDecodedLength(encoded.size()) bytes
+    /// @param written Receives the number of bytes decoded
+    /// @return False if the input is not valid Base64
+    static bool decode(std::string_view encoded, uint8_t* out, size_t& written);
+
     /// Check if a string is valid Base64
     /// @param str The string to check
     /// @return True if valid Base64, false otherwise
     static bool isValid(const std::string& str);
+
+    /// Number of characters produced for size input bytes
+    static constexpr size_t encodedLength(size_t size) {
+        return (size + 2) / 3 * 4;
+    }
+
+    /// Upper bound on the decoded size of a string of the given length
+    static constexpr size_t maxDecodedLength(size_t length) {
+        return length / 4 * 3;
+    }
+
+    /// Name of the encode/decode implementation selected for this CPU ("avx2", "ssse3" or "scalar")
+    static const char* getImplementation();
+};
+
+/// Incremental Base64 encoder appending to a string.
+/// Input may arrive in pieces of any size; up to two bytes are carried between updates.
+class Base64Encoder {
+public:
+    /// @param out The string the encoded text is appended to
+    explicit Base64Encoder(std::string& out);
+
+    /// Encode more input
+    /// @param data The data to encode
+    /// @param size Number of bytes
+    void update(const uint8_t* data, size_t size);
+
+    /// Encode the carried bytes with padding; further updates start a new Base64 value
+    void finish();
+
+private:
+    std::string& out_;
+    uint8_t pending_[3];
+    size_t pendingSize_ = 0;
+};
+
+/// Output stream that Base64-encodes everything written to it, so a BinaryWriter
+/// can serialize straight into a text buffer such as an HTTP request body.
+/// Call finish() once the last byte has been written.
+class Base64OutputStream : public std::ostream {
+public:
+    /// @param out The string the encoded text is appended to
+    explicit Base64OutputStream(std::string& out);
+
+    /// Flush the trailing group with padding
+    void finish();
+
+private:
+    class Buffer : public std::streambuf {
+    public:
+        explicit Buffer(std::string& out) : encoder_(out) {}
+        void finish() { encoder_.finish(); }
+
+    protected:
+        int_type overflow(int_type ch) override;
+        std::streamsize xsputn(const char* data, std::streamsize size) override;
+
+    private:
+        Base64Encoder encoder_;
+    };
+
+    Buffer buffer_;
 };
 
 } // namespace neocpp
@@ -1,11 +1,14 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include "neocpp/types/types.hpp"
 
 namespace neocpp {
 
-/// Hexadecimal encoding and decoding utilities
+/// Hexadecimal encoding and decoding utilities.
+/// Encoding and decoding are table-driven; inputs of 16 bytes or more take an SSE2 or AVX2 path
+/// on x86-64, chosen once at runtime from the CPU's features.
 class Hex {
 public:
     /// Encode bytes to hexadecimal string
@@ -14,11 +17,32 @@ public:
     /// @return The hex encoded string (without 0x prefix)
     static std::string encode(const Bytes& data, bool uppercase = false);
 
+    /// Encode bytes to hexadecimal string
+    /// @param data The data to encode
+    /// @param size The number of bytes
+    /// @param uppercase Whether to use uppercase letters
+    /// @return The hex encoded string (without 0x prefix)
+    static std::string encode(const uint8_t* data, size_t size, bool uppercase = false);
+
+    /// Encode bytes into a caller buffer
+    /// @param data The data to encode
+    /// @param size The number of bytes
+    /// @param out Receives 2 * size characters (not null-terminated)
+    /// @param uppercase Whether to use uppercase letters
+    static void encode(const uint8_t* data, size_t size, char* out, bool uppercase = false);
+
     /// Decode hexadecimal string to bytes
     /// @param hex The hex string (with or without 0x prefix)
-    /// @return The decoded bytes
+    /// @return The decoded bytes, or empty if the string is not valid hex
     static Bytes decode(const std::string& hex);
 
+    /// Decode hexadecimal string into a caller buffer, validating every character
+    /// @param hex The hex string (with or without 0x prefix)
+    /// @param out Receives the decoded bytes
+    /// @param size The expected number of bytes
+    /// @return False if the string is not valid hex or does not decode to exactly size bytes
+    static bool decode(std::string_view hex, uint8_t* out, size_t size);
+
     /// Check if a string is valid hexadecimal
     /// @param str The string to check
     /// @return True if valid hex, false otherwise
@@ -33,6 +57,9 @@ public:
     /// @param hex The hex string
     /// @return The hex string without 0x prefix
     static std::string withoutPrefix(const std::string& hex);
+
+    /// Name of the encode/decode implementation selected for this CPU ("avx2", "sse2" or "scalar")
+    static const char* getImplementation();
 };
 
 } // namespace neocpp
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace neocpp {
+
+/// Fork-join helpers used by the SDK's batch APIs
+class Parallel {
+public:
+    /// Resolve a requested worker count
+    /// @param requested The requested number of threads (0 = hardware concurrency)
+    /// @param work The number of work items
+    /// @return The number of workers to start (at least 1, at most work)
+    static unsigned int workerCount(unsigned int requested, size_t work) {
+        unsigned int threads = requested;
+        if (threads == 0) {
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        if (work < threads) {
+            threads = static_cast<unsigned int>(std::max<size_t>(work, 1));
+        }
+        return threads;
+    }
+
+    /// Split [0, count) into contiguous chunks and run fn(begin, end) on each chunk concurrently.
+    /// The calling thread processes the first chunk. If any chunk throws, the first exception
+    /// is rethrown once all workers have finished.
+    /// @param count The number of work items
+    /// @param threads The number of worker threads (0 = hardware concurrency)
+    /// @param fn The chunk function
+    template<typename Fn>
+    static void forChunks(size_t count, unsigned int threads, Fn fn) {
+        if (count == 0) {
+            return;
+        }
+
+        threads = workerCount(threads, count);
+        if (threads == 1) {
+            fn(size_t(0), count);
+            return;
+        }
+
+        std::vector<std::exception_ptr> errors(threads);
+        auto worker = [&](unsigned int w) {
+            size_t begin = count * w / threads;
+            size_t end = count * (w + 1) / threads;
+            try {
+                fn(begin, end);
+            } catch (...) {
+                errors[w] = std::current_exception();
+            }
+        };
+
+        std::vector<std::thread> pool;
+        pool.reserve(threads - 1);
+        for (unsigned int w = 1; w < threads; ++w) {
+            pool.emplace_back(worker, w);
+        }
+        worker(0);
+        for (auto& thread : pool) {
+            thread.join();
+        }
+
+        for (const auto& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
+private:
+    Parallel() = delete;
+};
+
+} // namespace neocpp
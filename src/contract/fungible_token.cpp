@@ -1,6 +1,7 @@
 #include "neocpp/contract/fungible_token.hpp"
 #include "neocpp/protocol/neo_rpc_client.hpp"
 #include "neocpp/types/contract_parameter.hpp"
+#include "neocpp/protocol/stack_item.hpp"
 #include "neocpp/wallet/account.hpp"
 #include "neocpp/transaction/transaction_builder.hpp"
 #include "neocpp/utils/address.hpp"
@@ -28,12 +29,12 @@ int FungibleToken::getDecimals() {
     return decimals_;
 }
 
-int64_t FungibleToken::getTotalSupply() {
+BigInteger FungibleToken::getTotalSupply() {
     auto result = invokeFunction("totalSupply");
-    return result["stack"][0]["value"].get<int64_t>();
+    return StackItem::fromJson(result["stack"][0])->getBigInteger();
 }
 
-int64_t FungibleToken::getBalanceOf(const std::string& address) {
+BigInteger FungibleToken::getBalanceOf(const std::string& address) {
     Bytes hashBytes = AddressUtils::addressToScriptHash(address);
     Hash160 scriptHash = Hash160(hashBytes);
     std::vector<ContractParameter> params = {
@@ -41,12 +42,12 @@ int64_t FungibleToken::getBalanceOf(const std::string& address) {
     };
     
     auto result = invokeFunction("balanceOf", params);
-    return result["stack"][0]["value"].get<int64_t>();
+    return StackItem::fromJson(result["stack"][0])->getBigInteger();
 }
 
 SharedPtr<TransactionBuilder> FungibleToken::transfer(const SharedPtr<Account>& from, 
                                                       const std::string& to, 
-                                                      int64_t amount,
+                                                      const BigInteger& amount,
                                                       const std::string& data) {
     Bytes toHashBytes = AddressUtils::addressToScriptHash(to);
     Hash160 toHash = Hash160(toHashBytes);
@@ -90,16 +90,11 @@ NefFile NefFile::fromBase64(const std::string& base64) {
 }
 
 size_t NefFile::getSize() const {
-    size_t size = 0;
-    size += 4; // magic length
-    size += compiler_.length() + 1; // varstring
-    size += version_.length() + 1; // varstring
-    size += 1 + script_.size(); // varbytes (assuming < 253 bytes)
-    if (script_.size() >= 253) {
-        size += 2; // Additional bytes for larger sizes
-    }
-    size += 4; // checksum
-    return size;
+    return magic_.size() +
+           BinaryWriter::getVarSize(compiler_) +
+           BinaryWriter::getVarSize(version_) +
+           BinaryWriter::getVarSize(script_.size()) + script_.size() +
+           checksum_.size();
 }
 
 void NefFile::serialize(BinaryWriter& writer) const {
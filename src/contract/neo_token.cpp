@@ -1,5 +1,6 @@
 #include "neocpp/contract/neo_token.hpp"
 #include "neocpp/protocol/neo_rpc_client.hpp"
+#include "neocpp/protocol/chain_state_cache.hpp"
 #include "neocpp/types/contract_parameter.hpp"
 #include "neocpp/transaction/transaction_builder.hpp"
 #include "neocpp/wallet/account.hpp"
@@ -37,12 +38,7 @@ nlohmann::json NeoToken::getAccountState(const std::string& address) {
 }
 
 std::vector<std::string> NeoToken::getCommittee() {
-    auto result = invokeFunction("getCommittee");
-    std::vector<std::string> committee;
-    for (const auto& item : result["stack"][0]["value"]) {
-        committee.push_back(item["value"].get<std::string>());
-    }
-    return committee;
+    return ChainStateCache::forClient(client_)->getCommittee();
 }
 
 std::vector<nlohmann::json> NeoToken::getCandidates() {
@@ -1,11 +1,22 @@
 #include "neocpp/contract/policy_contract.hpp"
 #include "neocpp/protocol/neo_rpc_client.hpp"
+#include "neocpp/protocol/chain_state_cache.hpp"
 #include "neocpp/types/contract_parameter.hpp"
 #include "neocpp/transaction/transaction_builder.hpp"
 #include "neocpp/exceptions.hpp"
 
 namespace neocpp {
 
+namespace {
+
+// Neo nodes return Integer stack item values as decimal strings
+int64_t stackInteger(const nlohmann::json& result) {
+    const auto& value = result["stack"][0]["value"];
+    return value.is_string() ? std::stoll(value.get<std::string>()) : value.get<int64_t>();
+}
+
+} // namespace
+
 const Hash160 PolicyContract::SCRIPT_HASH = Hash160("0xcc5e4edd9f5f8dba8bb65734541df7a1c081c67b");
 const std::string PolicyContract::NAME = "PolicyContract";
 
@@ -18,33 +29,31 @@ SharedPtr<PolicyContract> PolicyContract::create(const SharedPtr<NeoRpcClient>&
 }
 
 int64_t PolicyContract::getFeePerByte() {
-    auto result = invokeFunction("getFeePerByte");
-    return result["stack"][0]["value"].get<int64_t>();
+    return ChainStateCache::forClient(client_)->getFeePerByte();
 }
 
 int32_t PolicyContract::getExecFeeFactor() {
-    auto result = invokeFunction("getExecFeeFactor");
-    return result["stack"][0]["value"].get<int32_t>();
+    return ChainStateCache::forClient(client_)->getExecFeeFactor();
 }
 
 int64_t PolicyContract::getStoragePrice() {
     auto result = invokeFunction("getStoragePrice");
-    return result["stack"][0]["value"].get<int64_t>();
+    return stackInteger(result);
 }
 
 uint32_t PolicyContract::getMaxTransactionsPerBlock() {
     auto result = invokeFunction("getMaxTransactionsPerBlock");
-    return result["stack"][0]["value"].get<uint32_t>();
+    return static_cast<uint32_t>(stackInteger(result));
 }
 
 uint32_t PolicyContract::getMaxBlockSize() {
     auto result = invokeFunction("getMaxBlockSize");
-    return result["stack"][0]["value"].get<uint32_t>();
+    return static_cast<uint32_t>(stackInteger(result));
 }
 
 int64_t PolicyContract::getMaxBlockSystemFee() {
     auto result = invokeFunction("getMaxBlockSystemFee");
-    return result["stack"][0]["value"].get<int64_t>();
+    return stackInteger(result);
 }
 
 bool PolicyContract::isBlocked(const Hash160& account) {
@@ -2,11 +2,19 @@
 #include "neocpp/crypto/bip32_ec_key_pair.hpp"
 #include "neocpp/crypto/bip39.hpp"
 #include "neocpp/crypto/hash.hpp"
+#include "neocpp/types/hash160.hpp"
+#include "neocpp/script/script_builder.hpp"
 #include "neocpp/utils/base58.hpp"
+#include "neocpp/utils/parallel.hpp"
 #include "neocpp/exceptions.hpp"
 #include <openssl/hmac.h>
 #include <openssl/bn.h>
 #include <openssl/ec.h>
+#include <openssl/obj_mac.h>
+#include <openssl/crypto.h>
+#include <algorithm>
+#include <map>
+#include <mutex>
 #include <sstream>
 #include <cstring>
 
@@ -20,6 +28,183 @@ static const uint32_t HARDENED_BIT = 0x80000000;
 static const uint32_t MAINNET_PRIVATE = 0x0488ADE4;
 static const uint32_t MAINNET_PUBLIC = 0x0488B21E;
 
+// Upper bound on cached intermediate nodes per root key
+static const size_t MAX_CACHED_PARENTS = 64;
+
+namespace {
+
+/// Per-thread curve group, BN context and order, reused across derivations
+struct CurveContext {
+    EC_GROUP* group = nullptr;
+    BN_CTX* ctx = nullptr;
+    BIGNUM* order = nullptr;
+
+    CurveContext()
+        : group(EC_GROUP_new_by_curve_name(NID_X9_62_prime256v1)),
+          ctx(BN_CTX_new()),
+          order(BN_new()) {
+        if (!group || !ctx || !order || EC_GROUP_get_order(group, order, ctx) != 1) {
+            release();
+            throw CryptoException("Failed to initialize secp256r1 context");
+        }
+    }
+
+    ~CurveContext() { release(); }
+
+    CurveContext(const CurveContext&) = delete;
+    CurveContext& operator=(const CurveContext&) = delete;
+
+    void release() {
+        BN_free(order);
+        BN_CTX_free(ctx);
+        EC_GROUP_free(group);
+        order = nullptr;
+        ctx = nullptr;
+        group = nullptr;
+    }
+};
+
+CurveContext& curveContext() {
+    thread_local CurveContext context;
+    return context;
+}
+
+void appendUInt32BE(Bytes& out, uint32_t value) {
+    out.push_back((value >> 24) & 0xFF);
+    out.push_back((value >> 16) & 0xFF);
+    out.push_back((value >> 8) & 0xFF);
+    out.push_back(value & 0xFF);
+}
+
+uint32_t readUInt32BE(const Bytes& data, size_t offset) {
+    return (static_cast<uint32_t>(data[offset]) << 24) | (static_cast<uint32_t>(data[offset + 1]) << 16) |
+           (static_cast<uint32_t>(data[offset + 2]) << 8) | static_cast<uint32_t>(data[offset + 3]);
+}
+
+uint32_t fingerprintOf(const Bytes& encodedPublicKey) {
+    Bytes hash = HashUtils::sha256ThenRipemd160(encodedPublicKey);
+    return readUInt32BE(hash, 0);
+}
+
+Bytes serializeExtendedKey(uint32_t version, uint32_t depth, uint32_t parentFingerprint,
+                           uint32_t childNumber, const Bytes& chainCode, const Bytes& keyData) {
+    Bytes data;
+    data.reserve(78);
+    appendUInt32BE(data, version);
+    data.push_back(depth);
+    appendUInt32BE(data, parentFingerprint);
+    appendUInt32BE(data, childNumber);
+    data.insert(data.end(), chainCode.begin(), chainCode.end());
+    data.insert(data.end(), keyData.begin(), keyData.end());
+    return data;
+}
+
+/// CKDpub: child = parse256(IL) * G + parent, chain code = IR
+/// The parent point is decoded once so sibling derivations only pay for a fixed-base
+/// multiplication and a point addition. Instances are bound to the creating thread.
+class PublicChildDeriver {
+public:
+    PublicChildDeriver(const Bytes& parentPublicKey, const Bytes& chainCode)
+        : curve_(curveContext()), parentPublicKey_(parentPublicKey), chainCode_(chainCode),
+          parent_(EC_POINT_new(curve_.group)), child_(EC_POINT_new(curve_.group)), tweak_(BN_new()) {
+        if (!parent_ || !child_ || !tweak_ ||
+            EC_POINT_oct2point(curve_.group, parent_, parentPublicKey_.data(),
+                               parentPublicKey_.size(), curve_.ctx) != 1) {
+            release();
+            throw CryptoException("Invalid BIP32 parent public key");
+        }
+    }
+
+    ~PublicChildDeriver() { release(); }
+
+    PublicChildDeriver(const PublicChildDeriver&) = delete;
+    PublicChildDeriver& operator=(const PublicChildDeriver&) = delete;
+
+    Bytes derive(uint32_t index, uint8_t* childChainCode) {
+        uint8_t data[37];
+        std::memcpy(data, parentPublicKey_.data(), 33);
+        data[33] = (index >> 24) & 0xFF;
+        data[34] = (index >> 16) & 0xFF;
+        data[35] = (index >> 8) & 0xFF;
+        data[36] = index & 0xFF;
+
+        uint8_t hmacResult[64];
+        unsigned int len = 64;
+        HMAC(EVP_sha512(), chainCode_.data(), chainCode_.size(), data, sizeof(data), hmacResult, &len);
+
+        Bytes encoded(33);
+        bool ok = BN_bin2bn(hmacResult, 32, tweak_) != nullptr &&
+                  BN_cmp(tweak_, curve_.order) < 0 &&
+                  EC_POINT_mul(curve_.group, child_, tweak_, nullptr, nullptr, curve_.ctx) == 1 &&
+                  EC_POINT_add(curve_.group, child_, child_, parent_, curve_.ctx) == 1 &&
+                  !EC_POINT_is_at_infinity(curve_.group, child_) &&
+                  EC_POINT_point2oct(curve_.group, child_, POINT_CONVERSION_COMPRESSED,
+                                     encoded.data(), encoded.size(), curve_.ctx) == 33;
+
+        if (!ok) {
+            throw CryptoException("Invalid BIP32 child key at index " + std::to_string(index));
+        }
+
+        std::memcpy(childChainCode, hmacResult + 32, 32);
+        OPENSSL_cleanse(hmacResult, sizeof(hmacResult));
+        return encoded;
+    }
+
+private:
+    void release() {
+        BN_free(tweak_);
+        EC_POINT_free(child_);
+        EC_POINT_free(parent_);
+        tweak_ = nullptr;
+        child_ = nullptr;
+        parent_ = nullptr;
+    }
+
+    CurveContext& curve_;
+    const Bytes& parentPublicKey_;
+    const Bytes& chainCode_;
+    EC_POINT* parent_;
+    EC_POINT* child_;
+    BIGNUM* tweak_;
+};
+
+Hash160 scriptHashForPublicKey(const Bytes& encodedPublicKey) {
+    // The single-signature verification script is <push key> SYSCALL <CheckSig hash>.
+    // Build it once and patch the key in place instead of re-hashing the syscall name.
+    static const Bytes TEMPLATE = ScriptBuilder::buildVerificationScript(Bytes(33, 0));
+    static const size_t KEY_OFFSET = TEMPLATE.size() - 5 - 33;
+
+    Bytes script = TEMPLATE;
+    std::copy(encodedPublicKey.begin(), encodedPublicKey.end(), script.begin() + KEY_OFFSET);
+    return Hash160::fromScript(script);
+}
+
+/// Run fn(deriver, index) for every index in [start, start + count) across worker threads
+template<typename T, typename Fn>
+std::vector<T> deriveRange(const Bytes& publicKey, const Bytes& chainCode,
+                           uint32_t start, uint32_t count, unsigned int threads, Fn fn) {
+    if (static_cast<uint64_t>(start) + count > HARDENED_BIT) {
+        throw IllegalArgumentException("Child index range exceeds non-hardened indices");
+    }
+
+    std::vector<T> results(count);
+    Parallel::forChunks(count, threads, [&](size_t begin, size_t end) {
+        PublicChildDeriver deriver(publicKey, chainCode);
+        for (size_t i = begin; i < end; ++i) {
+            results[i] = fn(deriver, start + static_cast<uint32_t>(i));
+        }
+    });
+    return results;
+}
+
+} // namespace
+
+/// Intermediate nodes keyed by their index path relative to the owning key
+struct Bip32ECKeyPair::DerivationCache {
+    std::mutex mutex;
+    std::map<std::vector<uint32_t>, SharedPtr<Bip32ECKeyPair>> nodes;
+};
+
 Bip32ECKeyPair::Bip32ECKeyPair(const SharedPtr<ECPrivateKey>& privateKey,
                                const Bytes& chainCode,
                                uint32_t depth,
@@ -29,7 +214,8 @@ Bip32ECKeyPair::Bip32ECKeyPair(const SharedPtr<ECPrivateKey>& privateKey,
       chainCode_(chainCode),
       depth_(depth),
       parentFingerprint_(parentFingerprint),
-      childNumber_(childNumber) {
+      childNumber_(childNumber),
+      derivationCache_(std::make_shared<DerivationCache>()) {
 } // namespace neocpp
 SharedPtr<Bip32ECKeyPair> Bip32ECKeyPair::fromSeed(const Bytes& seed) {
     if (seed.size() < 16 || seed.size() > 64) {
@@ -95,38 +281,29 @@ SharedPtr<Bip32ECKeyPair> Bip32ECKeyPair::deriveChild(uint32_t index, bool harde
     Bytes childChainCode(hmacResult.begin() + 32, hmacResult.end());
 
     // Add parent private key to child key (modulo curve order)
-    BIGNUM* parentKey = BN_new();
-    BIGNUM* childKey = BN_new();
-    BIGNUM* curveOrder = BN_new();
-    BN_CTX* ctx = BN_CTX_new();
-
-    // Get curve order
-    EC_GROUP* group = EC_GROUP_new_by_curve_name(NID_X9_62_prime256v1);
-    EC_GROUP_get_order(group, curveOrder, ctx);
+    CurveContext& curve = curveContext();
+    BIGNUM* parentKey = BN_secure_new();
+    BIGNUM* childKey = BN_secure_new();
 
     // Convert keys to BIGNUMs
-    BN_bin2bn(getPrivateKey()->getBytes().data(), 32, parentKey);
+    Bytes parentKeyBytes = getPrivateKey()->getBytes();
+    BN_bin2bn(parentKeyBytes.data(), 32, parentKey);
     BN_bin2bn(childPrivateKeyBytes.data(), 32, childKey);
+    OPENSSL_cleanse(parentKeyBytes.data(), parentKeyBytes.size());
 
     // Add and mod
-    BN_mod_add(childKey, parentKey, childKey, curveOrder, ctx);
+    BN_mod_add(childKey, parentKey, childKey, curve.order, curve.ctx);
 
     // Convert back to bytes
     Bytes finalKey(32);
     BN_bn2binpad(childKey, finalKey.data(), 32);
 
     // Cleanup
-    BN_free(parentKey);
-    BN_free(childKey);
-    BN_free(curveOrder);
-    BN_CTX_free(ctx);
-    EC_GROUP_free(group);
+    BN_clear_free(parentKey);
+    BN_clear_free(childKey);
 
     // Calculate parent fingerprint (first 4 bytes of parent public key hash)
-    Bytes parentPubKey = getPublicKey()->getEncoded();
-    Bytes parentHash = HashUtils::sha256ThenRipemd160(parentPubKey);
-    uint32_t fingerprint = (parentHash[0] << 24) | (parentHash[1] << 16) |
-                          (parentHash[2] << 8) | parentHash[3];
+    uint32_t fingerprint = fingerprintOf(getPublicKey()->getEncoded());
 
     // Create child key
     auto childPrivateKey = std::make_shared<ECPrivateKey>(finalKey);
@@ -134,15 +311,49 @@ SharedPtr<Bip32ECKeyPair> Bip32ECKeyPair::deriveChild(uint32_t index, bool harde
                                            depth_ + 1, fingerprint, index);
 } // namespace neocpp
 SharedPtr<Bip32ECKeyPair> Bip32ECKeyPair::derivePath(const std::string& path) {
+    return derivePath(parsePath(path));
+} // namespace neocpp
+SharedPtr<Bip32ECKeyPair> Bip32ECKeyPair::derivePath(const std::vector<uint32_t>& indices) {
+    if (indices.empty()) {
+        return SharedPtr<Bip32ECKeyPair>(new Bip32ECKeyPair(*this));
+    }
+
+    std::vector<uint32_t> parentPath(indices.begin(), indices.end() - 1);
+    SharedPtr<Bip32ECKeyPair> parent;
+    {
+        std::lock_guard<std::mutex> lock(derivationCache_->mutex);
+        auto it = derivationCache_->nodes.find(parentPath);
+        if (it != derivationCache_->nodes.end()) {
+            parent = it->second;
+        }
+    }
+
+    if (!parent) {
+        // Start with a copy of this key
+        parent = SharedPtr<Bip32ECKeyPair>(new Bip32ECKeyPair(*this));
+        for (uint32_t index : parentPath) {
+            parent = parent->deriveChild(index & ~HARDENED_BIT, (index & HARDENED_BIT) != 0);
+        }
+
+        std::lock_guard<std::mutex> lock(derivationCache_->mutex);
+        if (derivationCache_->nodes.size() >= MAX_CACHED_PARENTS) {
+            derivationCache_->nodes.clear();
+        }
+        derivationCache_->nodes.emplace(parentPath, parent);
+    }
+
+    uint32_t last = indices.back();
+    return parent->deriveChild(last & ~HARDENED_BIT, (last & HARDENED_BIT) != 0);
+} // namespace neocpp
+std::vector<uint32_t> Bip32ECKeyPair::parsePath(const std::string& path) {
     // Parse BIP32 path like "m/44'/888'/0'/0/0"
     if (path.empty() || path[0] != 'm') {
         throw IllegalArgumentException("Path must start with 'm'");
     }
 
+    std::vector<uint32_t> indices;
     std::istringstream iss(path.substr(1));
     std::string segment;
-    // Start with a copy of this key
-    SharedPtr<Bip32ECKeyPair> current(new Bip32ECKeyPair(*this));
 
     while (std::getline(iss, segment, '/')) {
         if (segment.empty()) continue;
@@ -153,82 +364,48 @@ SharedPtr<Bip32ECKeyPair> Bip32ECKeyPair::derivePath(const std::string& path) {
             segment.pop_back();
         }
 
-        uint32_t index = std::stoul(segment);
-        current = current->deriveChild(index, hardened);
+        bool digits = std::all_of(segment.begin(), segment.end(),
+                                  [](unsigned char c) { return c >= '0' && c <= '9'; });
+        if (segment.empty() || !digits) {
+            throw IllegalArgumentException("Invalid path segment in " + path);
+        }
+
+        unsigned long index = 0;
+        try {
+            index = std::stoul(segment);
+        } catch (const std::exception&) {
+            throw IllegalArgumentException("Invalid path segment in " + path);
+        }
+        if (index >= HARDENED_BIT) {
+            throw IllegalArgumentException("Path index out of range in " + path);
+        }
+
+        indices.push_back(static_cast<uint32_t>(index) | (hardened ? HARDENED_BIT : 0));
     }
 
-    return current;
+    return indices;
+} // namespace neocpp
+void Bip32ECKeyPair::clearDerivationCache() {
+    std::lock_guard<std::mutex> lock(derivationCache_->mutex);
+    derivationCache_->nodes.clear();
+} // namespace neocpp
+SharedPtr<Bip32ExtendedPublicKey> Bip32ECKeyPair::getExtendedPublicKey() const {
+    return std::make_shared<Bip32ExtendedPublicKey>(getPublicKey()->getEncoded(), chainCode_,
+                                                    depth_, parentFingerprint_, childNumber_);
 } // namespace neocpp
 std::string Bip32ECKeyPair::toExtendedPrivateKey() const {
-    Bytes data;
-    data.reserve(78);
-
-    // Version (4 bytes)
-    data.push_back((MAINNET_PRIVATE >> 24) & 0xFF);
-    data.push_back((MAINNET_PRIVATE >> 16) & 0xFF);
-    data.push_back((MAINNET_PRIVATE >> 8) & 0xFF);
-    data.push_back(MAINNET_PRIVATE & 0xFF);
-
-    // Depth (1 byte)
-    data.push_back(depth_);
-
-    // Parent fingerprint (4 bytes)
-    data.push_back((parentFingerprint_ >> 24) & 0xFF);
-    data.push_back((parentFingerprint_ >> 16) & 0xFF);
-    data.push_back((parentFingerprint_ >> 8) & 0xFF);
-    data.push_back(parentFingerprint_ & 0xFF);
-
-    // Child number (4 bytes)
-    data.push_back((childNumber_ >> 24) & 0xFF);
-    data.push_back((childNumber_ >> 16) & 0xFF);
-    data.push_back((childNumber_ >> 8) & 0xFF);
-    data.push_back(childNumber_ & 0xFF);
-
-    // Chain code (32 bytes)
-    data.insert(data.end(), chainCode_.begin(), chainCode_.end());
-
     // Private key (33 bytes: 0x00 prefix + 32 byte key)
-    data.push_back(0x00);
+    Bytes keyData;
+    keyData.reserve(33);
+    keyData.push_back(0x00);
     Bytes privKey = getPrivateKey()->getBytes();
-    data.insert(data.end(), privKey.begin(), privKey.end());
+    keyData.insert(keyData.end(), privKey.begin(), privKey.end());
 
-    // Base58Check encode
-    return Base58::encode(data);
+    return Base58::encode(serializeExtendedKey(MAINNET_PRIVATE, depth_, parentFingerprint_,
+                                               childNumber_, chainCode_, keyData));
 } // namespace neocpp
 std::string Bip32ECKeyPair::toExtendedPublicKey() const {
-    Bytes data;
-    data.reserve(78);
-
-    // Version (4 bytes)
-    data.push_back((MAINNET_PUBLIC >> 24) & 0xFF);
-    data.push_back((MAINNET_PUBLIC >> 16) & 0xFF);
-    data.push_back((MAINNET_PUBLIC >> 8) & 0xFF);
-    data.push_back(MAINNET_PUBLIC & 0xFF);
-
-    // Depth (1 byte)
-    data.push_back(depth_);
-
-    // Parent fingerprint (4 bytes)
-    data.push_back((parentFingerprint_ >> 24) & 0xFF);
-    data.push_back((parentFingerprint_ >> 16) & 0xFF);
-    data.push_back((parentFingerprint_ >> 8) & 0xFF);
-    data.push_back(parentFingerprint_ & 0xFF);
-
-    // Child number (4 bytes)
-    data.push_back((childNumber_ >> 24) & 0xFF);
-    data.push_back((childNumber_ >> 16) & 0xFF);
-    data.push_back((childNumber_ >> 8) & 0xFF);
-    data.push_back(childNumber_ & 0xFF);
-
-    // Chain code (32 bytes)
-    data.insert(data.end(), chainCode_.begin(), chainCode_.end());
-
-    // Public key (33 bytes: compressed)
-    Bytes pubKey = getPublicKey()->getEncoded();
-    data.insert(data.end(), pubKey.begin(), pubKey.end());
-
-    // Base58Check encode
-    return Base58::encode(data);
+    return getExtendedPublicKey()->toExtendedPublicKey();
 } // namespace neocpp
 SharedPtr<Bip32ECKeyPair> Bip32ECKeyPair::fromExtendedPrivateKey(const std::string& xprv) {
     Bytes data = Base58::decode(xprv);
@@ -259,4 +436,101 @@ SharedPtr<Bip32ECKeyPair> Bip32ECKeyPair::fromExtendedPrivateKey(const std::stri
     return std::make_shared<Bip32ECKeyPair>(privateKey, chainCode, depth,
                                            parentFingerprint, childNumber);
 } // namespace neocpp
+// Bip32ExtendedPublicKey implementation
+
+Bip32ExtendedPublicKey::Bip32ExtendedPublicKey(const Bytes& encodedPublicKey,
+                                               const Bytes& chainCode,
+                                               uint32_t depth,
+                                               uint32_t parentFingerprint,
+                                               uint32_t childNumber)
+    : publicKey_(encodedPublicKey),
+      chainCode_(chainCode),
+      depth_(depth),
+      parentFingerprint_(parentFingerprint),
+      childNumber_(childNumber) {
+    if (publicKey_.size() != NeoConstants::PUBLIC_KEY_SIZE_COMPRESSED) {
+        throw IllegalArgumentException("Extended public key requires a compressed public key");
+    }
+    if (chainCode_.size() != 32) {
+        throw IllegalArgumentException("Chain code must be 32 bytes");
+    }
+} // namespace neocpp
+SharedPtr<Bip32ExtendedPublicKey> Bip32ExtendedPublicKey::fromExtendedPublicKey(const std::string& xpub) {
+    Bytes data = Base58::decode(xpub);
+
+    if (data.size() != 78) {
+        throw IllegalArgumentException("Invalid extended public key length");
+    }
+
+    if (readUInt32BE(data, 0) != MAINNET_PUBLIC) {
+        throw IllegalArgumentException("Invalid extended public key version");
+    }
+
+    uint32_t depth = data[4];
+    uint32_t parentFingerprint = readUInt32BE(data, 5);
+    uint32_t childNumber = readUInt32BE(data, 9);
+    Bytes chainCode(data.begin() + 13, data.begin() + 45);
+    Bytes publicKey(data.begin() + 45, data.end());
+
+    // Throws if the encoding is not a point on the curve
+    ECPoint point(publicKey);
+
+    return std::make_shared<Bip32ExtendedPublicKey>(publicKey, chainCode, depth,
+                                                    parentFingerprint, childNumber);
+} // namespace neocpp
+SharedPtr<Bip32ExtendedPublicKey> Bip32ExtendedPublicKey::deriveChild(uint32_t index) const {
+    if (index & HARDENED_BIT) {
+        throw IllegalArgumentException("Cannot derive a hardened child from an extended public key");
+    }
+
+    Bytes childChainCode(32);
+    PublicChildDeriver deriver(publicKey_, chainCode_);
+    Bytes childKey = deriver.derive(index, childChainCode.data());
+    return std::make_shared<Bip32ExtendedPublicKey>(childKey, childChainCode, depth_ + 1,
+                                                    fingerprintOf(publicKey_), index);
+} // namespace neocpp
+SharedPtr<Bip32ExtendedPublicKey> Bip32ExtendedPublicKey::derivePath(const std::string& path) const {
+    std::string relative = path;
+    if (!relative.empty() && (relative[0] == 'M' || relative[0] == 'm')) {
+        relative[0] = 'm';
+    } else {
+        relative = "m/" + relative;
+    }
+
+    auto current = std::make_shared<Bip32ExtendedPublicKey>(*this);
+    for (uint32_t index : Bip32ECKeyPair::parsePath(relative)) {
+        current = current->deriveChild(index);
+    }
+    return current;
+} // namespace neocpp
+std::vector<Hash160> Bip32ExtendedPublicKey::deriveScriptHashes(uint32_t start, uint32_t count,
+                                                                unsigned int threads) const {
+    return deriveRange<Hash160>(publicKey_, chainCode_, start, count, threads,
+                                [](PublicChildDeriver& deriver, uint32_t index) {
+        uint8_t childChainCode[32];
+        return scriptHashForPublicKey(deriver.derive(index, childChainCode));
+    });
+} // namespace neocpp
+std::vector<std::string> Bip32ExtendedPublicKey::deriveAddresses(uint32_t start, uint32_t count,
+                                                                 unsigned int threads) const {
+    return deriveRange<std::string>(publicKey_, chainCode_, start, count, threads,
+                                    [](PublicChildDeriver& deriver, uint32_t index) {
+        uint8_t childChainCode[32];
+        return scriptHashForPublicKey(deriver.derive(index, childChainCode)).toAddress();
+    });
+} // namespace neocpp
+SharedPtr<ECPublicKey> Bip32ExtendedPublicKey::getPublicKey() const {
+    return std::make_shared<ECPublicKey>(publicKey_);
+} // namespace neocpp
+Hash160 Bip32ExtendedPublicKey::getScriptHash() const {
+    return scriptHashForPublicKey(publicKey_);
+} // namespace neocpp
+std::string Bip32ExtendedPublicKey::getAddress() const {
+    return getScriptHash().toAddress();
+} // namespace neocpp
+std::string Bip32ExtendedPublicKey::toExtendedPublicKey() const {
+    // Public key (33 bytes: compressed)
+    return Base58::encode(serializeExtendedKey(MAINNET_PUBLIC, depth_, parentFingerprint_,
+                                               childNumber_, chainCode_, publicKey_));
+} // namespace neocpp
 } // namespace neocpp
@@ -3,17 +3,21 @@
 #include "neocpp/crypto/hash.hpp"
 #include "neocpp/exceptions.hpp"
 #include "neocpp/logger.hpp"
+#include "neocpp/utils/parallel.hpp"
 #include <openssl/evp.h>
 #include <openssl/sha.h>
 #include <openssl/rand.h>
 #include <sstream>
 #include <algorithm>
+#include <cctype>
 #include <cstring>
 
 namespace neocpp {
 
 // Initialize static members
 std::vector<std::vector<std::string>> Bip39::wordLists_(9);
+std::vector<std::vector<std::pair<std::string_view, uint16_t>>> Bip39::wordIndexes_(9);
+std::array<std::once_flag, 9> Bip39::loadFlags_;
 
 // English word list (first 100 words shown, full list would be 2048 words)
 const std::array<const char*, 2048> Bip39::ENGLISH_WORDS = {
@@ -49,59 +53,43 @@ std::string Bip39::generateMnemonic(const Bytes& entropy, Language language) {
         throw IllegalArgumentException("Invalid entropy length");
     }
 
-    // Calculate checksum
-    Bytes hash = HashUtils::sha256(entropy);
-    uint8_t checksumBits = entropyBits / 32;
-    uint8_t checksum = hash[0] >> (8 - checksumBits);
-
-    // Combine entropy and checksum
-    std::vector<bool> bits;
-    for (uint8_t byte : entropy) {
-        for (int i = 7; i >= 0; --i) {
-            bits.push_back((byte >> i) & 1);
-        }
-    }
-    for (int i = checksumBits - 1; i >= 0; --i) {
-        bits.push_back((checksum >> i) & 1);
-    }
+    // Append the checksum byte; only its top (entropyBits / 32) bits are consumed
+    Bytes data(entropy);
+    data.push_back(HashUtils::sha256(entropy)[0]);
 
-    // Convert to word indices
+    // Read 11-bit word indices straight from the packed bytes
     const auto& wordList = getWordList(language);
+    size_t wordCount = (entropyBits + entropyBits / 32) / 11;
     std::vector<std::string> words;
-
-    for (size_t i = 0; i < bits.size(); i += 11) {
-        uint16_t index = 0;
-        for (size_t j = 0; j < 11 && i + j < bits.size(); ++j) {
-            index = (index << 1) | (bits[i + j] ? 1 : 0);
-        }
-        if (index < wordList.size()) {
-            words.push_back(wordList[index]);
+    words.reserve(wordCount);
+
+    uint32_t accumulator = 0;
+    int accumulatedBits = 0;
+    size_t next = 0;
+    for (size_t w = 0; w < wordCount; ++w) {
+        while (accumulatedBits < 11) {
+            accumulator = (accumulator << 8) | data[next++];
+            accumulatedBits += 8;
         }
+        accumulatedBits -= 11;
+        words.push_back(wordList[(accumulator >> accumulatedBits) & 0x7FF]);
     }
 
     return joinWords(words);
 } // namespace neocpp
 bool Bip39::validateMnemonic(const std::string& mnemonic, Language language) {
     try {
-        std::vector<std::string> words = splitMnemonic(mnemonic);
-        if (words.size() < 12 || words.size() > 24 || words.size() % 3 != 0) {
+        // Strict spacing keeps this equivalent to re-generating the phrase and comparing
+        std::vector<uint16_t> indices;
+        if (!lookupWords(mnemonic, language, true, indices, nullptr)) {
             return false;
         }
-
-        const auto& wordList = getWordList(language);
-
-        // Check all words exist in word list
-        for (const auto& word : words) {
-            if (std::find(wordList.begin(), wordList.end(), word) == wordList.end()) {
-                return false;
-            }
+        if (indices.size() < 12 || indices.size() > 24 || indices.size() % 3 != 0) {
+            return false;
         }
 
-        // Verify checksum
-        Bytes entropy = mnemonicToEntropy(mnemonic, language);
-        std::string regenerated = generateMnemonic(entropy, language);
-
-        return regenerated == mnemonic;
+        Bytes entropy;
+        return packEntropy(indices, entropy);
     } catch (const std::exception& e) {
         LOG_DEBUG(std::string("Mnemonic validation failed: ") + e.what());
         return false;
@@ -126,48 +114,30 @@ Bytes Bip39::mnemonicToSeed(const std::string& mnemonic, const std::string& pass
 
     return seed;
 } // namespace neocpp
-Bytes Bip39::mnemonicToEntropy(const std::string& mnemonic, Language language) {
-    std::vector<std::string> words = splitMnemonic(mnemonic);
-    const auto& wordList = getWordList(language);
-
-    // Convert words to bits
-    std::vector<bool> bits;
-    for (const auto& word : words) {
-        auto it = std::find(wordList.begin(), wordList.end(), word);
-        if (it == wordList.end()) {
-            throw IllegalArgumentException("Word not in word list: " + word);
-        }
-
-        uint16_t index = std::distance(wordList.begin(), it);
-        for (int i = 10; i >= 0; --i) {
-            bits.push_back((index >> i) & 1);
-        }
-    }
-
-    // Separate entropy from checksum
-    size_t entropyBits = (bits.size() * 32) / 33;
-    size_t checksumBits = bits.size() - entropyBits;
-
-    // Extract entropy
-    Bytes entropy;
-    for (size_t i = 0; i < entropyBits; i += 8) {
-        uint8_t byte = 0;
-        for (size_t j = 0; j < 8 && i + j < entropyBits; ++j) {
-            byte = (byte << 1) | (bits[i + j] ? 1 : 0);
+std::vector<Bytes> Bip39::mnemonicToSeedBatch(const std::vector<std::string>& mnemonics,
+                                              const std::string& passphrase,
+                                              unsigned int threads) {
+    std::vector<Bytes> seeds(mnemonics.size());
+    Parallel::forChunks(mnemonics.size(), threads, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            seeds[i] = mnemonicToSeed(mnemonics[i], passphrase);
         }
-        entropy.push_back(byte);
+    });
+    return seeds;
+} // namespace neocpp
+Bytes Bip39::mnemonicToEntropy(const std::string& mnemonic, Language language) {
+    std::vector<uint16_t> indices;
+    std::string unknownWord;
+    if (!lookupWords(mnemonic, language, false, indices, &unknownWord)) {
+        throw IllegalArgumentException("Word not in word list: " + unknownWord);
     }
 
-    // Verify checksum
-    Bytes hash = HashUtils::sha256(entropy);
-    uint8_t expectedChecksum = hash[0] >> (8 - checksumBits);
-
-    uint8_t actualChecksum = 0;
-    for (size_t i = entropyBits; i < bits.size(); ++i) {
-        actualChecksum = (actualChecksum << 1) | (bits[i] ? 1 : 0);
+    if (indices.empty() || indices.size() > 24 || indices.size() % 3 != 0) {
+        throw IllegalArgumentException("Invalid mnemonic length");
     }
 
-    if (expectedChecksum != actualChecksum) {
+    Bytes entropy;
+    if (!packEntropy(indices, entropy)) {
         throw IllegalArgumentException("Invalid mnemonic checksum");
     }
 
@@ -176,13 +146,24 @@ Bytes Bip39::mnemonicToEntropy(const std::string& mnemonic, Language language) {
 const std::vector<std::string>& Bip39::getWordList(Language language) {
     size_t langIndex = static_cast<size_t>(language);
 
-    // Load word list if not cached
-    if (wordLists_[langIndex].empty()) {
-        loadWordList(language);
-    }
+    // Load word list and its lookup table once per language
+    std::call_once(loadFlags_[langIndex], loadWordList, language);
 
     return wordLists_[langIndex];
 } // namespace neocpp
+int Bip39::getWordIndex(std::string_view word, Language language) {
+    getWordList(language);
+    const auto& index = wordIndexes_[static_cast<size_t>(language)];
+
+    auto it = std::lower_bound(index.begin(), index.end(), word,
+                               [](const std::pair<std::string_view, uint16_t>& entry, std::string_view value) {
+                                   return entry.first < value;
+                               });
+    if (it == index.end() || it->first != word) {
+        return -1;
+    }
+    return it->second;
+} // namespace neocpp
 std::vector<std::string> Bip39::splitMnemonic(const std::string& mnemonic) {
     std::vector<std::string> words;
     std::stringstream ss(mnemonic);
@@ -202,6 +183,71 @@ std::string Bip39::joinWords(const std::vector<std::string>& words) {
     }
     return result;
 } // namespace neocpp
+bool Bip39::lookupWords(const std::string& mnemonic, Language language, bool strict,
+                        std::vector<uint16_t>& indices, std::string* unknownWord) {
+    indices.clear();
+    indices.reserve(24);
+
+    std::string_view rest(mnemonic);
+    while (!rest.empty()) {
+        std::string_view word;
+        if (strict) {
+            size_t space = rest.find(' ');
+            word = rest.substr(0, space);
+            if (word.empty() || (space != std::string_view::npos && space + 1 == rest.size())) {
+                return false;
+            }
+            rest = space == std::string_view::npos ? std::string_view() : rest.substr(space + 1);
+        } else {
+            size_t start = 0;
+            while (start < rest.size() && std::isspace(static_cast<unsigned char>(rest[start]))) ++start;
+            size_t end = start;
+            while (end < rest.size() && !std::isspace(static_cast<unsigned char>(rest[end]))) ++end;
+            word = rest.substr(start, end - start);
+            rest = rest.substr(end);
+            if (word.empty()) {
+                break;
+            }
+        }
+
+        int index = getWordIndex(word, language);
+        if (index < 0) {
+            if (unknownWord) {
+                *unknownWord = std::string(word);
+            }
+            return false;
+        }
+        indices.push_back(static_cast<uint16_t>(index));
+    }
+
+    return true;
+} // namespace neocpp
+bool Bip39::packEntropy(const std::vector<uint16_t>& indices, Bytes& entropy) {
+    // 11 bits per word: 32 entropy bits plus 1 checksum bit per 3 words
+    size_t checksumBits = indices.size() / 3;
+    size_t entropyBytes = checksumBits * 4;
+
+    uint8_t packed[33] = {0};
+    uint32_t accumulator = 0;
+    int accumulatedBits = 0;
+    size_t out = 0;
+    for (uint16_t index : indices) {
+        accumulator = (accumulator << 11) | (index & 0x7FF);
+        accumulatedBits += 11;
+        while (accumulatedBits >= 8) {
+            accumulatedBits -= 8;
+            packed[out++] = static_cast<uint8_t>(accumulator >> accumulatedBits);
+        }
+    }
+    if (accumulatedBits > 0) {
+        packed[out] = static_cast<uint8_t>(accumulator << (8 - accumulatedBits));
+    }
+
+    entropy.assign(packed, packed + entropyBytes);
+
+    uint8_t actualChecksum = packed[entropyBytes] >> (8 - checksumBits);
+    return actualChecksum == calculateChecksum(entropy);
+} // namespace neocpp
 Bytes Bip39::generateEntropy(Strength strength) {
     size_t entropyBytes = static_cast<size_t>(strength) / 8;
     Bytes entropy(entropyBytes);
@@ -238,5 +284,15 @@ void Bip39::loadWordList(Language language) {
         // Other languages would be loaded from files
         throw UnsupportedOperationException("Language not yet supported");
     }
+
+    // Build the sorted lookup table; views stay valid since the list is never modified again
+    const auto& words = wordLists_[langIndex];
+    auto& index = wordIndexes_[langIndex];
+    index.clear();
+    index.reserve(words.size());
+    for (size_t i = 0; i < words.size(); ++i) {
+        index.emplace_back(words[i], static_cast<uint16_t>(i));
+    }
+    std::sort(index.begin(), index.end());
 } // namespace neocpp
 } // namespace neocpp
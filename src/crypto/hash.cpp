@@ -20,6 +20,25 @@ Bytes HashUtils::sha256(const Bytes& data) {
     EVP_MD_CTX_free(ctx);
     return result;
 } // namespace neocpp
+void HashUtils::sha256(const uint8_t* data, size_t size, uint8_t* out) {
+    // Reuse one context per thread; the per-call context allocation dominates short inputs
+    struct Context {
+        EVP_MD_CTX* ctx = EVP_MD_CTX_new();
+        ~Context() { EVP_MD_CTX_free(ctx); }
+    };
+    thread_local Context context;
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+    // Fetch the implementation once instead of on every init
+    static EVP_MD* const md = EVP_MD_fetch(nullptr, "SHA256", nullptr);
+#else
+    static const EVP_MD* const md = EVP_sha256();
+#endif
+
+    unsigned int len = SHA256_DIGEST_LENGTH;
+    EVP_DigestInit_ex(context.ctx, md, nullptr);
+    EVP_DigestUpdate(context.ctx, data, size);
+    EVP_DigestFinal_ex(context.ctx, out, &len);
+} // namespace neocpp
 Bytes HashUtils::doubleSha256(const Bytes& data) {
     return sha256(sha256(data));
 } // namespace neocpp
@@ -0,0 +1,169 @@
+#include "neocpp/log_sink.hpp"
+#include "neocpp/logger.hpp"
+#include "neocpp/exceptions.hpp"
+#include <cstdio>
+#include <ctime>
+#include <iostream>
+
+namespace neocpp {
+
+namespace {
+
+/// Get color code for log level
+const char* getColor(LogLevel level) {
+    switch (level) {
+        case LogLevel::TRACE: return "\033[37m";  // White
+        case LogLevel::DEBUG: return "\033[36m";  // Cyan
+        case LogLevel::INFO:  return "\033[32m";  // Green
+        case LogLevel::WARN:  return "\033[33m";  // Yellow
+        case LogLevel::ERROR: return "\033[31m";  // Red
+        case LogLevel::FATAL: return "\033[35m";  // Magenta
+        default: return "";
+    }
+}
+
+/// Get level string
+const char* getLevelString(LogLevel level) {
+    switch (level) {
+        case LogLevel::TRACE: return "TRACE";
+        case LogLevel::DEBUG: return "DEBUG";
+        case LogLevel::INFO:  return "INFO ";
+        case LogLevel::WARN:  return "WARN ";
+        case LogLevel::ERROR: return "ERROR";
+        case LogLevel::FATAL: return "FATAL";
+        default: return "UNKNOWN";
+    }
+}
+
+/// Field values with spaces, quotes or '=' are quoted so lines stay machine-readable
+void appendFieldValue(std::string& text, const std::string& value) {
+    if (!value.empty() && value.find_first_of(" \"=") == std::string::npos) {
+        text += value;
+        return;
+    }
+    text += '"';
+    for (char c : value) {
+        if (c == '"' || c == '\\') {
+            text += '\\';
+        }
+        text += c;
+    }
+    text += '"';
+}
+
+} // namespace
+
+std::string LogSink::format(const LogRecord& record, bool color) {
+    // The timestamp text only changes once a second; each thread keeps its own copy
+    thread_local std::time_t cachedSecond = -1;
+    thread_local char timestamp[32];
+    std::time_t second = std::chrono::system_clock::to_time_t(record.time);
+    if (second != cachedSecond) {
+        std::tm local{};
+#ifdef _WIN32
+        localtime_s(&local, &second);
+#else
+        localtime_r(&second, &local);
+#endif
+        std::strftime(timestamp, sizeof(timestamp), "%Y-%m-%d %H:%M:%S", &local);
+        cachedSecond = second;
+    }
+
+    std::string text;
+    text.reserve(record.message.size() + 64);
+    if (color) {
+        text += getColor(record.level);
+    }
+    text += '[';
+    text += timestamp;
+    text += "] [";
+    text += getLevelString(record.level);
+    text += "] ";
+
+    if (record.file && record.line > 0) {
+        // Extract filename from path
+        const char* filename = record.file;
+        for (const char* p = record.file; *p; ++p) {
+            if (*p == '/' || *p == '\\') {
+                filename = p + 1;
+            }
+        }
+        text += '[';
+        text += filename;
+        text += ':';
+        text += std::to_string(record.line);
+        text += "] ";
+    }
+
+    text += record.message;
+    for (const auto& field : record.fields) {
+        text += ' ';
+        text += field.first;
+        text += '=';
+        appendFieldValue(text, field.second);
+    }
+    if (color) {
+        text += "\033[0m";
+    }
+    return text;
+} // namespace neocpp
+ConsoleLogSink::ConsoleLogSink(bool stderrOnly) : stderrOnly_(stderrOnly) {
+} // namespace neocpp
+void ConsoleLogSink::write(const LogRecord& record) {
+    // Format before taking the lock
+    std::string text = format(record, Logger::isColorEnabled());
+    text += '\n';
+
+    // Errors go to the unbuffered stderr; other output is left to stdout's buffering
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::ostream& out = stderrOnly_ || record.level >= LogLevel::ERROR ? std::cerr : std::cout;
+    out.write(text.data(), static_cast<std::streamsize>(text.size()));
+} // namespace neocpp
+void ConsoleLogSink::flush() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::cout.flush();
+    std::cerr.flush();
+} // namespace neocpp
+RotatingFileLogSink::RotatingFileLogSink(const std::string& path, size_t maxBytes, size_t maxBackups)
+    : path_(path), maxBytes_(maxBytes), maxBackups_(maxBackups) {
+    out_.open(path_, std::ios::binary | std::ios::app);
+    if (!out_) {
+        throw RuntimeException("Cannot open log file: " + path_);
+    }
+    out_.seekp(0, std::ios::end);
+    size_ = static_cast<size_t>(out_.tellp());
+} // namespace neocpp
+void RotatingFileLogSink::write(const LogRecord& record) {
+    std::string text = format(record);
+    text += '\n';
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (size_ > 0 && size_ + text.size() > maxBytes_) {
+        rotate();
+    }
+    out_.write(text.data(), static_cast<std::streamsize>(text.size()));
+    size_ += text.size();
+} // namespace neocpp
+void RotatingFileLogSink::flush() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    out_.flush();
+} // namespace neocpp
+void RotatingFileLogSink::rotate() {
+    out_.close();
+    if (maxBackups_ > 0) {
+        // path.N-1 -> path.N, ..., path -> path.1; the oldest is overwritten
+        std::remove((path_ + "." + std::to_string(maxBackups_)).c_str());
+        for (size_t i = maxBackups_ - 1; i >= 1; --i) {
+            std::rename((path_ + "." + std::to_string(i)).c_str(), (path_ + "." + std::to_string(i + 1)).c_str());
+        }
+        std::rename(path_.c_str(), (path_ + ".1").c_str());
+    }
+    out_.open(path_, std::ios::binary | std::ios::trunc);
+    size_ = 0;
+} // namespace neocpp
+CallbackLogSink::CallbackLogSink(Callback callback) : callback_(std::move(callback)) {
+} // namespace neocpp
+void CallbackLogSink::write(const LogRecord& record) {
+    callback_(record);
+} // namespace neocpp
+} // namespace neocpp
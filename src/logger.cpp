@@ -1,11 +1,322 @@
-
 #include "neocpp/logger.hpp"
+#include "neocpp/exceptions.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 namespace neocpp {
 
 // Initialize static members
-LogLevel Logger::currentLevel_ = LogLevel::INFO;
-std::mutex Logger::logMutex_;
-bool Logger::colorEnabled_ = true;
+std::atomic<LogLevel> Logger::currentLevel_{LogLevel::INFO};
+std::atomic<bool> Logger::colorEnabled_{true};
+
+namespace {
+
+using SinkList = std::vector<std::shared_ptr<LogSink>>;
+
+std::shared_ptr<const SinkList> makeSinks(SinkList sinks) {
+    if (sinks.empty()) {
+        sinks.push_back(std::make_shared<ConsoleLogSink>());
+    }
+    return std::make_shared<const SinkList>(std::move(sinks));
+}
+
+// Sinks are replaced as a whole and read with atomic shared_ptr loads, so logging threads
+// never lock to find them; sinkUpdateMutex only orders concurrent setSinks/addSink calls.
+std::shared_ptr<const SinkList> sinks = makeSinks({});
+std::mutex sinkUpdateMutex;
+std::atomic<uint64_t> droppedRecords{0};
+
+void writeToSinks(const LogRecord& record) {
+    auto current = std::atomic_load(&sinks);
+    if (!current) {
+        return;  // logged during static initialization, before the sinks exist
+    }
+    for (const auto& sink : *current) {
+        try {
+            sink->write(record);
+        } catch (...) {
+            // A failing sink must not take the logging thread down
+        }
+    }
+}
+
+void flushSinks() {
+    auto current = std::atomic_load(&sinks);
+    if (!current) {
+        return;
+    }
+    for (const auto& sink : *current) {
+        try {
+            sink->flush();
+        } catch (...) {
+        }
+    }
+}
+
+/// Bounded lock-free queue after Vyukov: producers claim a slot with a CAS on head_, and
+/// each slot's sequence number tells whether it is free, filled, or still being written.
+/// There is exactly one consumer, the writer thread.
+class RecordQueue {
+public:
+    explicit RecordQueue(size_t capacity) {
+        size_t size = 1;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        slots_ = std::make_unique<Slot[]>(size);
+        mask_ = size - 1;
+        for (size_t i = 0; i < size; ++i) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /// Move record into the queue; leaves it untouched and returns false if full
+    bool tryPush(LogRecord& record) {
+        size_t position = head_.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = slots_[position & mask_];
+            size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            auto difference = static_cast<std::ptrdiff_t>(sequence - position);
+            if (difference == 0) {
+                if (head_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    slot.record = std::move(record);
+                    slot.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (difference < 0) {
+                return false;
+            } else {
+                position = head_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool tryPop(LogRecord& record) {
+        Slot& slot = slots_[tail_ & mask_];
+        if (slot.sequence.load(std::memory_order_acquire) != tail_ + 1) {
+            return false;
+        }
+        record = std::move(slot.record);
+        slot.sequence.store(tail_ + mask_ + 1, std::memory_order_release);
+        ++tail_;
+        return true;
+    }
+
+    bool empty() const {
+        return slots_[tail_ & mask_].sequence.load(std::memory_order_acquire) != tail_ + 1;
+    }
+
+private:
+    struct Slot {
+        std::atomic<size_t> sequence{0};
+        LogRecord record;
+    };
+
+    std::unique_ptr<Slot[]> slots_;
+    size_t mask_ = 0;
+    alignas(64) std::atomic<size_t> head_{0};
+    alignas(64) size_t tail_ = 0;
+};
+
+/// Background thread draining the queue into the sinks
+class AsyncWriter {
+public:
+    explicit AsyncWriter(const AsyncLogOptions& options)
+        : queue_(options.capacity), overflow_(options.overflow),
+          reportedDrops_(droppedRecords.load(std::memory_order_relaxed)), thread_([this]() { run(); }) {
+    }
+
+    void push(LogRecord& record) {
+        while (!queue_.tryPush(record)) {
+            if (overflow_ == LogOverflowPolicy::DROP) {
+                droppedRecords.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            wake();
+            std::this_thread::yield();
+        }
+        pushed_.fetch_add(1, std::memory_order_release);
+        wake();
+    }
+
+    /// Wait until everything pushed so far has reached the sinks
+    void waitUntilWritten() {
+        uint64_t target = pushed_.load(std::memory_order_acquire);
+        while (written_.load(std::memory_order_acquire) < target) {
+            wake();
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+
+    /// Drain the queue and join; no producer may push any more
+    void stop() {
+        stopping_.store(true, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex_);
+            wakeCondition_.notify_one();
+        }
+        thread_.join();
+    }
+
+private:
+    // Producers only signal when the writer is about to sleep. The fences pair the
+    // producer's "push, then read sleeping_" with the writer's "set sleeping_, then
+    // check the queue", so one of the two always sees the other.
+    void wake() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleeping_.load(std::memory_order_relaxed)) {
+            std::lock_guard<std::mutex> lock(wakeMutex_);
+            wakeCondition_.notify_one();
+        }
+    }
+
+    void run() {
+        LogRecord record;
+        for (;;) {
+            bool wrote = false;
+            while (queue_.tryPop(record)) {
+                writeToSinks(record);
+                written_.fetch_add(1, std::memory_order_release);
+                wrote = true;
+            }
 
+            uint64_t drops = droppedRecords.load(std::memory_order_relaxed);
+            if (drops != reportedDrops_) {
+                LogRecord notice;
+                notice.level = LogLevel::WARN;
+                notice.time = std::chrono::system_clock::now();
+                notice.message = "Log queue full, records dropped";
+                notice.fields = {{"dropped", std::to_string(drops - reportedDrops_)}};
+                writeToSinks(notice);
+                reportedDrops_ = drops;
+            }
+
+            if (wrote) {
+                continue;
+            }
+            if (stopping_.load(std::memory_order_acquire)) {
+                if (queue_.empty()) {
+                    break;
+                }
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(wakeMutex_);
+            sleeping_.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (queue_.empty() && !stopping_.load(std::memory_order_acquire)) {
+                wakeCondition_.wait_for(lock, std::chrono::milliseconds(100));
+            }
+            sleeping_.store(false, std::memory_order_relaxed);
+        }
+        flushSinks();
+    }
+
+    RecordQueue queue_;
+    LogOverflowPolicy overflow_;
+    uint64_t reportedDrops_;  // writer thread only
+    std::atomic<uint64_t> pushed_{0};
+    std::atomic<uint64_t> written_{0};
+    std::atomic<bool> stopping_{false};
+    std::atomic<bool> sleeping_{false};
+    std::mutex wakeMutex_;
+    std::condition_variable wakeCondition_;
+    std::thread thread_;  // last, so it starts after everything above is constructed
+};
+
+// asyncWriter is swapped under asyncMutex. Producers announce themselves in asyncUsers
+// before loading it, so stopAsync can wait for in-flight pushes before draining.
+std::mutex asyncMutex;
+std::atomic<AsyncWriter*> asyncWriter{nullptr};
+std::atomic<int> asyncUsers{0};
+
+bool enqueue(LogRecord& record) {
+    asyncUsers.fetch_add(1, std::memory_order_seq_cst);
+    AsyncWriter* writer = asyncWriter.load(std::memory_order_seq_cst);
+    if (writer) {
+        writer->push(record);
+    }
+    asyncUsers.fetch_sub(1, std::memory_order_release);
+    return writer != nullptr;
+}
+
+// Drains and stops a writer still running at exit; declared after the sinks so it is
+// destroyed before them
+struct AsyncShutdown {
+    ~AsyncShutdown() {
+        Logger::stopAsync();
+    }
+} asyncShutdown;
+
+} // namespace
+
+void Logger::setSinks(std::vector<std::shared_ptr<LogSink>> newSinks) {
+    std::lock_guard<std::mutex> lock(sinkUpdateMutex);
+    std::atomic_store(&sinks, makeSinks(std::move(newSinks)));
+} // namespace neocpp
+void Logger::addSink(std::shared_ptr<LogSink> sink) {
+    if (!sink) {
+        throw IllegalArgumentException("Log sink cannot be null");
+    }
+    std::lock_guard<std::mutex> lock(sinkUpdateMutex);
+    SinkList updated = *std::atomic_load(&sinks);
+    updated.push_back(std::move(sink));
+    std::atomic_store(&sinks, makeSinks(std::move(updated)));
+} // namespace neocpp
+void Logger::startAsync(const AsyncLogOptions& options) {
+    if (options.capacity == 0) {
+        throw IllegalArgumentException("Async log queue capacity must be positive");
+    }
+    std::lock_guard<std::mutex> lock(asyncMutex);
+    if (asyncWriter.load()) {
+        throw IllegalStateException("Asynchronous logging is already running");
+    }
+    asyncWriter.store(new AsyncWriter(options));
+} // namespace neocpp
+void Logger::stopAsync() {
+    std::lock_guard<std::mutex> lock(asyncMutex);
+    std::unique_ptr<AsyncWriter> writer(asyncWriter.exchange(nullptr, std::memory_order_seq_cst));
+    if (!writer) {
+        return;
+    }
+    while (asyncUsers.load(std::memory_order_acquire) != 0) {
+        std::this_thread::yield();
+    }
+    writer->stop();
+} // namespace neocpp
+bool Logger::isAsync() {
+    return asyncWriter.load() != nullptr;
+} // namespace neocpp
+void Logger::flush() {
+    {
+        std::lock_guard<std::mutex> lock(asyncMutex);
+        if (AsyncWriter* writer = asyncWriter.load()) {
+            writer->waitUntilWritten();
+        }
+    }
+    flushSinks();
+} // namespace neocpp
+uint64_t Logger::getDroppedCount() {
+    return droppedRecords.load(std::memory_order_relaxed);
+} // namespace neocpp
+void Logger::log(LogLevel level, const std::string& message, const char* file, int line) {
+    log(level, message, LogFields(), file, line);
+} // namespace neocpp
+void Logger::log(LogLevel level, const std::string& message, LogFields fields, const char* file, int line) {
+    if (!isEnabled(level)) return;
+
+    LogRecord record;
+    record.level = level;
+    record.time = std::chrono::system_clock::now();
+    record.message = message;
+    record.fields = std::move(fields);
+    record.file = file;
+    record.line = line;
+
+    if (!enqueue(record)) {
+        writeToSinks(record);
+    }
+} // namespace neocpp
 } // namespace neocpp
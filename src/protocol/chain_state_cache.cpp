@@ -0,0 +1,243 @@
+#include "neocpp/protocol/chain_state_cache.hpp"
+#include "neocpp/protocol/neo_rpc_client.hpp"
+#include "neocpp/protocol/response_types_impl.hpp"
+#include "neocpp/protocol/stack_item.hpp"
+#include "neocpp/protocol/core/polling/block_polling.hpp"
+#include "neocpp/contract/policy_contract.hpp"
+#include "neocpp/contract/gas_token.hpp"
+#include "neocpp/types/contract_parameter.hpp"
+#include "neocpp/exceptions.hpp"
+#include <iterator>
+#include <map>
+
+namespace neocpp {
+
+namespace {
+
+std::mutex registryMutex;
+std::map<std::weak_ptr<NeoRpcClient>, SharedPtr<ChainStateCache>,
+         std::owner_less<std::weak_ptr<NeoRpcClient>>> registry;
+
+size_t index(ChainStateEntry entry) {
+    return static_cast<size_t>(entry);
+}
+
+} // namespace
+
+ChainStateCache::ChainStateCache(const SharedPtr<NeoRpcClient>& client,
+                                 std::chrono::milliseconds maxAge,
+                                 uint32_t committeeEpoch)
+    : client_(client), maxAge_(maxAge), committeeEpoch_(committeeEpoch) {
+    if (!client) {
+        throw IllegalArgumentException("RPC client must not be null");
+    }
+    if (committeeEpoch_ == 0) {
+        throw IllegalArgumentException("Committee epoch must be positive");
+    }
+}
+
+SharedPtr<ChainStateCache> ChainStateCache::forClient(const SharedPtr<NeoRpcClient>& client) {
+    if (!client) {
+        throw IllegalStateException("RPC client not set");
+    }
+
+    std::lock_guard<std::mutex> lock(registryMutex);
+    for (auto entry = registry.begin(); entry != registry.end();) {
+        entry = entry->first.expired() ? registry.erase(entry) : std::next(entry);
+    }
+    auto it = registry.find(client);
+    if (it != registry.end()) {
+        return it->second;
+    }
+
+    auto cache = std::make_shared<ChainStateCache>(client);
+    registry.emplace(client, cache);
+    return cache;
+}
+
+template<typename T, typename Select, typename Fetch>
+T ChainStateCache::lookup(ChainStateEntry entry, Select select, Fetch fetch) {
+    uint64_t generation = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Slot<T>& slot = select();
+        if (slot.value && Clock::now() - slot.fetchedAt < maxAge_) {
+            ++hits_[index(entry)];
+            return *slot.value;
+        }
+        generation = generations_[index(entry)];
+    }
+
+    // Fetch without the lock so concurrent lookups of other values are not serialized
+    ++misses_[index(entry)];
+    T value = fetch();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (generations_[index(entry)] == generation) {
+        Slot<T>& slot = select();
+        slot.value = value;
+        slot.fetchedAt = Clock::now();
+    }
+    return value;
+}
+
+uint32_t ChainStateCache::getBlockCount() {
+    return lookup<uint32_t>(ChainStateEntry::BLOCK_COUNT,
+        [this]() -> Slot<uint32_t>& { return blockCount_; },
+        [this]() { return lockClient()->getBlockCount(); });
+}
+
+std::vector<std::string> ChainStateCache::getCommittee() {
+    return lookup<std::vector<std::string>>(ChainStateEntry::COMMITTEE,
+        [this]() -> Slot<std::vector<std::string>>& { return committee_; },
+        [this]() { return lockClient()->getCommittee(); });
+}
+
+int64_t ChainStateCache::getFeePerByte() {
+    return lookup<int64_t>(ChainStateEntry::FEE_PER_BYTE,
+        [this]() -> Slot<int64_t>& { return feePerByte_; },
+        [this]() { return invokeInteger(PolicyContract::SCRIPT_HASH, "getFeePerByte", nlohmann::json::array()); });
+}
+
+int32_t ChainStateCache::getExecFeeFactor() {
+    return lookup<int32_t>(ChainStateEntry::EXEC_FEE_FACTOR,
+        [this]() -> Slot<int32_t>& { return execFeeFactor_; },
+        [this]() {
+            return static_cast<int32_t>(invokeInteger(PolicyContract::SCRIPT_HASH, "getExecFeeFactor", nlohmann::json::array()));
+        });
+}
+
+int64_t ChainStateCache::getGasBalance(const Hash160& account) {
+    return lookup<int64_t>(ChainStateEntry::GAS_BALANCE,
+        [this, &account]() -> Slot<int64_t>& { return gasBalances_[account]; },
+        [this, &account]() {
+            nlohmann::json params = nlohmann::json::array({ContractParameter::hash160(account).toRpcJson()});
+            return invokeInteger(GasToken::SCRIPT_HASH, "balanceOf", params);
+        });
+}
+
+void ChainStateCache::onNewBlock(uint32_t blockIndex) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (lastBlockIndex_ && blockIndex <= *lastBlockIndex_) {
+        return;
+    }
+
+    bool newEpoch = !lastBlockIndex_ || blockIndex / committeeEpoch_ != *lastBlockIndex_ / committeeEpoch_;
+    lastBlockIndex_ = blockIndex;
+
+    invalidateLocked(ChainStateEntry::FEE_PER_BYTE);
+    invalidateLocked(ChainStateEntry::EXEC_FEE_FACTOR);
+    invalidateLocked(ChainStateEntry::GAS_BALANCE);
+    if (newEpoch) {
+        invalidateLocked(ChainStateEntry::COMMITTEE);
+    }
+
+    // The block index is the block count minus one, so the count needs no round trip
+    invalidateLocked(ChainStateEntry::BLOCK_COUNT);
+    blockCount_.value = blockIndex + 1;
+    blockCount_.fetchedAt = Clock::now();
+}
+
+void ChainStateCache::subscribeTo(BlockPolling& polling) {
+    std::weak_ptr<ChainStateCache> weak = weak_from_this();
+    if (weak.expired()) {
+        throw IllegalStateException("ChainStateCache must be owned by a shared pointer to subscribe to block polling");
+    }
+    polling.subscribe([weak](uint32_t blockIndex) {
+        if (auto cache = weak.lock()) {
+            cache->onNewBlock(blockIndex);
+        }
+    });
+}
+
+void ChainStateCache::invalidate(ChainStateEntry entry) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    invalidateLocked(entry);
+}
+
+void ChainStateCache::invalidateAll() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t i = 0; i < ENTRY_COUNT; ++i) {
+        invalidateLocked(static_cast<ChainStateEntry>(i));
+    }
+}
+
+void ChainStateCache::invalidateShared(ChainStateEntry entry) {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    for (const auto& [client, cache] : registry) {
+        cache->invalidate(entry);
+    }
+}
+
+void ChainStateCache::invalidateLocked(ChainStateEntry entry) {
+    ++generations_[index(entry)];
+    switch (entry) {
+        case ChainStateEntry::BLOCK_COUNT:
+            blockCount_.value.reset();
+            break;
+        case ChainStateEntry::COMMITTEE:
+            committee_.value.reset();
+            break;
+        case ChainStateEntry::FEE_PER_BYTE:
+            feePerByte_.value.reset();
+            break;
+        case ChainStateEntry::EXEC_FEE_FACTOR:
+            execFeeFactor_.value.reset();
+            break;
+        case ChainStateEntry::GAS_BALANCE:
+            gasBalances_.clear();
+            break;
+    }
+}
+
+ChainStateCache::Stats ChainStateCache::getStats(ChainStateEntry entry) const {
+    Stats stats;
+    stats.hits = hits_[index(entry)];
+    stats.misses = misses_[index(entry)];
+    return stats;
+}
+
+ChainStateCache::Stats ChainStateCache::getStats() const {
+    Stats stats;
+    for (size_t i = 0; i < ENTRY_COUNT; ++i) {
+        stats.hits += hits_[i];
+        stats.misses += misses_[i];
+    }
+    return stats;
+}
+
+void ChainStateCache::resetStats() {
+    for (size_t i = 0; i < ENTRY_COUNT; ++i) {
+        hits_[i] = 0;
+        misses_[i] = 0;
+    }
+}
+
+SharedPtr<NeoRpcClient> ChainStateCache::lockClient() const {
+    auto client = client_.lock();
+    if (!client) {
+        throw IllegalStateException("RPC client of the chain state cache was destroyed");
+    }
+    return client;
+}
+
+int64_t ChainStateCache::invokeInteger(const Hash160& contract, const std::string& method, const nlohmann::json& params) {
+    auto response = lockClient()->invokeFunction(contract, method, params);
+    if (!response) {
+        throw RuntimeException("No response from " + method);
+    }
+    if (response->getState() != "HALT") {
+        throw RuntimeException(method + " did not halt: " + response->getState());
+    }
+
+    const auto& stack = response->getStack();
+    if (stack.empty()) {
+        throw RuntimeException("Invalid response from " + method + ": empty stack");
+    }
+    if (stack[0]->getType() != StackItemType::INTEGER) {
+        throw RuntimeException("Invalid " + method + " response type");
+    }
+    return stack[0]->getInteger();
+}
+
+} // namespace neocpp
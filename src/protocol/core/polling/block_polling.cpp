@@ -66,9 +66,11 @@ void BlockPolling::notifySubscribers(uint32_t blockIndex) {
         try {
             callback(blockIndex);
         } catch (const std::exception& e) {
-            LOG_WARN(std::string("Block callback error: ") + e.what());
+            NEOCPP_LOG_FIELDS(LogLevel::WARN, "Block callback error",
+                              {"block", std::to_string(blockIndex)}, {"error", e.what()});
         } catch (...) {
-            LOG_WARN("Block callback error: unknown exception");
+            NEOCPP_LOG_FIELDS(LogLevel::WARN, "Block callback error: unknown exception",
+                              {"block", std::to_string(blockIndex)});
         }
     }
 }
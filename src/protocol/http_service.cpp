@@ -36,6 +36,17 @@ HttpService::~HttpService() {
     // Cleanup is handled globally
 } // namespace neocpp
 nlohmann::json HttpService::post(const nlohmann::json& data, const std::string& endpoint) {
+    return postBody(data.dump(), endpoint);
+} // namespace neocpp
+nlohmann::json HttpService::postBody(const std::string& body, const std::string& endpoint) {
+    std::string response = postRaw(body, endpoint);
+    try {
+        return nlohmann::json::parse(response);
+    } catch (const nlohmann::json::exception& e) {
+        throw RpcException("Failed to parse JSON response: " + std::string(e.what()));
+    }
+} // namespace neocpp
+std::string HttpService::postRaw(const std::string& body, const std::string& endpoint) {
 #ifdef HAVE_CURL
     CURL* curl = curl_easy_init();
     if (!curl) {
@@ -43,14 +54,13 @@ nlohmann::json HttpService::post(const nlohmann::json& data, const std::string&
     }
 
     std::string url = baseUrl_ + endpoint;
-    std::string jsonStr = data.dump();
     std::string response;
 
     // Set CURL options
     curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
     curl_easy_setopt(curl, CURLOPT_POST, 1L);
-    curl_easy_setopt(curl, CURLOPT_POSTFIELDS, jsonStr.c_str());
-    curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, jsonStr.length());
+    curl_easy_setopt(curl, CURLOPT_POSTFIELDS, body.c_str());
+    curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, body.length());
     curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallback);
     curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response);
     curl_easy_setopt(curl, CURLOPT_TIMEOUT, 30L);
@@ -72,14 +82,9 @@ nlohmann::json HttpService::post(const nlohmann::json& data, const std::string&
         throw RpcException("HTTP request failed: " + std::string(curl_easy_strerror(res)));
     }
 
-    // Parse response
-    try {
-        return nlohmann::json::parse(response);
-    } catch (const nlohmann::json::exception& e) {
-        throw RpcException("Failed to parse JSON response: " + std::string(e.what()));
-    }
+    return response;
 #else
-    (void)data;
+    (void)body;
     (void)endpoint;
     throw RpcException("HTTP support not available (CURL not found)");
 #endif
@@ -2,6 +2,8 @@
 #include "neocpp/protocol/neo_rpc_client.hpp"
 #include "neocpp/protocol/http_service.hpp"
 #include "neocpp/protocol/response_types_impl.hpp"
+#include "neocpp/protocol/rpc_response_cache.hpp"
+#include "neocpp/protocol/single_flight_group.hpp"
 #include "neocpp/transaction/transaction.hpp"
 #include "neocpp/transaction/signer.hpp"
 #include "neocpp/serialization/binary_writer.hpp"
@@ -10,6 +12,7 @@
 #include "neocpp/types/contract_parameter.hpp"
 #include "neocpp/exceptions.hpp"
 #include "neocpp/logger.hpp"
+#include <functional>
 #include <sstream>
 
 namespace neocpp {
@@ -27,6 +30,68 @@ static nlohmann::json createRequest(const std::string& method, const nlohmann::j
         {"id", id}
     };
 } // namespace neocpp
+// Helper method to create a JSON-RPC request whose first parameter is the Base64 of what
+// write() serializes. The encoding streams straight into the body, skipping the intermediate
+// byte array, Base64 string and JSON tree.
+static std::string createBase64Request(const std::string& method,
+                                       const std::function<void(BinaryWriter&)>& write,
+                                       const nlohmann::json& extraParams, int id) {
+    std::string body = "{\"jsonrpc\":\"2.0\",\"method\":" + nlohmann::json(method).dump() + ",\"params\":[\"";
+    Base64OutputStream stream(body);
+    BinaryWriter writer(stream);
+    write(writer);
+    stream.finish();
+    body += '"';
+    for (const auto& param : extraParams) {
+        body += ',';
+        body += param.dump();
+    }
+    body += "],\"id\":" + std::to_string(id) + "}";
+    return body;
+} // namespace neocpp
+// Helper method to decode a response body straight into a typed response, skipping the
+// JSON tree of the whole body
+template <typename Response>
+static SharedPtr<Response> readResponse(std::string body) {
+    auto response = std::make_shared<Response>();
+    response->parseResponse(std::move(body));
+    return response;
+} // namespace neocpp
+// Helper method to decode a response through the response cache. A cached body is decoded
+// like a fresh one; a fresh body is stored only when isFinal says the result can no longer change.
+template <typename Response, typename Send, typename IsFinal>
+static SharedPtr<Response> readCachedResponse(RpcResponseCache* cache, const std::string& endpoint,
+                                              const std::string& method, const nlohmann::json& params,
+                                              Send send, IsFinal isFinal) {
+    if (!cache) {
+        return readResponse<Response>(send());
+    }
+    std::string key = RpcResponseCache::makeKey(endpoint, method, params);
+    std::string body;
+    if (cache->get(key, body)) {
+        return readResponse<Response>(std::move(body));
+    }
+    body = send();
+    auto response = readResponse<Response>(body);
+    if (isFinal(*response)) {
+        cache->put(key, body);
+    }
+    return response;
+} // namespace neocpp
+// Helper method to run a read-only call once for all identical calls in flight when a
+// single-flight group is set
+template <typename Result, typename Call>
+static SharedPtr<Result> shareInFlight(SingleFlightGroup* group, const std::string& endpoint,
+                                       const std::string& method, const nlohmann::json& params,
+                                       Call call, bool* shared = nullptr) {
+    if (!group) {
+        if (shared) {
+            *shared = false;
+        }
+        return call();
+    }
+    return group->run<Result>(RpcResponseCache::makeKey(endpoint, method, params), call, shared);
+} // namespace neocpp
 // Helper method to handle response
 static nlohmann::json handleResponse(const nlohmann::json& response) {
     if (response.contains("error")) {
@@ -77,35 +142,53 @@ Hash256 NeoRpcClient::getBestBlockHash() {
 } // namespace neocpp
 SharedPtr<NeoGetBlockResponse> NeoRpcClient::getBlock(const Hash256& hash, bool verbose) {
     auto params = nlohmann::json::array({hash.toString(), verbose});
-    auto request = createRequest("getblock", params, requestId_++);
-    auto response = httpService_->post(request);
-    auto result = handleResponse(response);
-
-    auto blockResponse = std::make_shared<NeoGetBlockResponse>();
-    blockResponse->parseJson(result);
-    return blockResponse;
+    return shareInFlight<NeoGetBlockResponse>(singleFlight_.get(), url_, "getblock", params, [&]() {
+        return readCachedResponse<NeoGetBlockResponse>(responseCache_.get(), url_, "getblock", params,
+            [&]() { return httpService_->postRaw(createRequest("getblock", params, requestId_++).dump()); },
+            [verbose](const NeoGetBlockResponse& block) { return !verbose || block.hasNextBlockHash(); });
+    });
 } // namespace neocpp
 SharedPtr<NeoGetBlockResponse> NeoRpcClient::getBlock(uint32_t index, bool verbose) {
     auto params = nlohmann::json::array({index, verbose});
-    auto request = createRequest("getblock", params, requestId_++);
-    auto response = httpService_->post(request);
-    auto result = handleResponse(response);
-
-    auto blockResponse = std::make_shared<NeoGetBlockResponse>();
-    blockResponse->parseJson(result);
-    return blockResponse;
+    return shareInFlight<NeoGetBlockResponse>(singleFlight_.get(), url_, "getblock", params, [&]() {
+        return readCachedResponse<NeoGetBlockResponse>(responseCache_.get(), url_, "getblock", params,
+            [&]() { return httpService_->postRaw(createRequest("getblock", params, requestId_++).dump()); },
+            [verbose](const NeoGetBlockResponse& block) { return !verbose || block.hasNextBlockHash(); });
+    });
 } // namespace neocpp
 uint32_t NeoRpcClient::getBlockCount() {
-    auto request = createRequest("getblockcount", nlohmann::json::array(), requestId_++);
-    auto response = httpService_->post(request);
-    auto result = handleResponse(response);
-    return result.get<uint32_t>();
+    auto params = nlohmann::json::array();
+    return *shareInFlight<uint32_t>(singleFlight_.get(), url_, "getblockcount", params, [&]() {
+        auto request = createRequest("getblockcount", params, requestId_++);
+        auto response = httpService_->post(request);
+        auto result = handleResponse(response);
+        return std::make_shared<uint32_t>(result.get<uint32_t>());
+    });
 } // namespace neocpp
 Hash256 NeoRpcClient::getBlockHash(uint32_t index) {
-    auto request = createRequest("getblockhash", nlohmann::json::array({index}), requestId_++);
-    auto response = httpService_->post(request);
-    auto result = handleResponse(response);
-    return Hash256::fromHexString(result.get<std::string>());
+    auto params = nlohmann::json::array({index});
+    return *shareInFlight<Hash256>(singleFlight_.get(), url_, "getblockhash", params, [&]() {
+        std::string key = RpcResponseCache::makeKey(url_, "getblockhash", params);
+        std::string body;
+        if (responseCache_ && responseCache_->get(key, body)) {
+            return std::make_shared<Hash256>(Hash256::fromHexString(
+                handleResponse(nlohmann::json::parse(body)).get<std::string>()));
+        }
+
+        auto request = createRequest("getblockhash", params, requestId_++);
+        body = httpService_->postRaw(request.dump());
+        nlohmann::json response;
+        try {
+            response = nlohmann::json::parse(body);
+        } catch (const nlohmann::json::exception& e) {
+            throw RpcException("Failed to parse JSON response: " + std::string(e.what()));
+        }
+        auto hash = std::make_shared<Hash256>(Hash256::fromHexString(handleResponse(response).get<std::string>()));
+        if (responseCache_) {
+            responseCache_->put(key, body);
+        }
+        return hash;
+    });
 } // namespace neocpp
 nlohmann::json NeoRpcClient::getBlockHeader(const Hash256& hash, bool verbose) {
     auto params = nlohmann::json::array({hash.toString(), verbose});
@@ -152,22 +235,23 @@ std::vector<nlohmann::json> NeoRpcClient::getNextBlockValidators() {
 } // namespace neocpp
 SharedPtr<NeoGetRawTransactionResponse> NeoRpcClient::getRawTransaction(const Hash256& hash, bool verbose) {
     auto params = nlohmann::json::array({hash.toString(), verbose});
-    auto request = createRequest("getrawtransaction", params, requestId_++);
-    auto response = httpService_->post(request);
-    auto result = handleResponse(response);
-
-    auto txResponse = std::make_shared<NeoGetRawTransactionResponse>();
-    txResponse->parseJson(result);
-    return txResponse;
+    // A transaction's content is fixed by its hash; verbose results also carry the block,
+    // which is known only once the transaction is confirmed
+    return shareInFlight<NeoGetRawTransactionResponse>(singleFlight_.get(), url_, "getrawtransaction", params, [&]() {
+        return readCachedResponse<NeoGetRawTransactionResponse>(responseCache_.get(), url_, "getrawtransaction", params,
+            [&]() { return httpService_->postRaw(createRequest("getrawtransaction", params, requestId_++).dump()); },
+            [verbose](const NeoGetRawTransactionResponse& transaction) {
+                return !verbose || transaction.getBlockHash() != Hash256();
+            });
+    });
 } // namespace neocpp
 SharedPtr<NeoGetApplicationLogResponse> NeoRpcClient::getApplicationLog(const Hash256& hash) {
-    auto request = createRequest("getapplicationlog", nlohmann::json::array({hash.toString()}), requestId_++);
-    auto response = httpService_->post(request);
-    auto result = handleResponse(response);
-
-    auto logResponse = std::make_shared<NeoGetApplicationLogResponse>();
-    logResponse->parseJson(result);
-    return logResponse;
+    auto params = nlohmann::json::array({hash.toString()});
+    return shareInFlight<NeoGetApplicationLogResponse>(singleFlight_.get(), url_, "getapplicationlog", params, [&]() {
+        return readCachedResponse<NeoGetApplicationLogResponse>(responseCache_.get(), url_, "getapplicationlog", params,
+            [&]() { return httpService_->postRaw(createRequest("getapplicationlog", params, requestId_++).dump()); },
+            [](const NeoGetApplicationLogResponse&) { return true; });
+    });
 } // namespace neocpp
 std::string NeoRpcClient::getStorage(const Hash160& scriptHash, const std::string& key) {
     Bytes keyBytes = Hex::decode(key);
@@ -219,46 +303,47 @@ SharedPtr<NeoInvokeResultResponse> NeoRpcClient::invokeFunction(const Hash160& s
         signers
     });
 
-    auto request = createRequest("invokefunction", requestParams, requestId_++);
-    auto response = httpService_->post(request);
-    auto result = handleResponse(response);
-
-    auto invokeResponse = std::make_shared<NeoInvokeResultResponse>();
-    invokeResponse->parseJson(result);
-    return invokeResponse;
+    auto send = [&]() {
+        auto request = createRequest("invokefunction", requestParams, requestId_++);
+        return readResponse<NeoInvokeResultResponse>(httpService_->postRaw(request.dump()));
+    };
+    bool shared = false;
+    auto response = shareInFlight<NeoInvokeResultResponse>(singleFlight_.get(), url_, "invokefunction", requestParams, send, &shared);
+    // An iterator session belongs to one caller; the others open their own
+    return shared && response->hasSession() ? send() : response;
 } // namespace neocpp
 SharedPtr<NeoInvokeResultResponse> NeoRpcClient::invokeScript(const Bytes& script,
                                                               const nlohmann::json& signers) {
-    std::string base64Script = Base64::encode(script);
-
-    auto params = nlohmann::json::array({base64Script, signers});
-    auto request = createRequest("invokescript", params, requestId_++);
-    auto response = httpService_->post(request);
-    auto result = handleResponse(response);
-
-    auto invokeResponse = std::make_shared<NeoInvokeResultResponse>();
-    invokeResponse->parseJson(result);
-    return invokeResponse;
+    auto send = [&]() {
+        auto request = createBase64Request("invokescript", [&](BinaryWriter& writer) {
+            writer.writeBytes(script);
+        }, nlohmann::json::array({signers}), requestId_++);
+        return readResponse<NeoInvokeResultResponse>(httpService_->postRaw(request));
+    };
+    if (!singleFlight_) {
+        return send();
+    }
+    bool shared = false;
+    auto params = nlohmann::json::array({Base64::encode(script), signers});
+    auto response = shareInFlight<NeoInvokeResultResponse>(singleFlight_.get(), url_, "invokescript", params, send, &shared);
+    return shared && response->hasSession() ? send() : response;
 } // namespace neocpp
 SharedPtr<NeoInvokeResultResponse> NeoRpcClient::invokeScript(const std::string& base64Script,
                                                               const nlohmann::json& signers) {
     auto params = nlohmann::json::array({base64Script, signers});
-    auto request = createRequest("invokescript", params, requestId_++);
-    auto response = httpService_->post(request);
-    auto result = handleResponse(response);
-
-    auto invokeResponse = std::make_shared<NeoInvokeResultResponse>();
-    invokeResponse->parseJson(result);
-    return invokeResponse;
+    auto send = [&]() {
+        auto request = createRequest("invokescript", params, requestId_++);
+        return readResponse<NeoInvokeResultResponse>(httpService_->postRaw(request.dump()));
+    };
+    bool shared = false;
+    auto response = shareInFlight<NeoInvokeResultResponse>(singleFlight_.get(), url_, "invokescript", params, send, &shared);
+    return shared && response->hasSession() ? send() : response;
 } // namespace neocpp
 Hash256 NeoRpcClient::sendRawTransaction(const SharedPtr<Transaction>& transaction) {
-    BinaryWriter writer;
-    transaction->serialize(writer);
-    Bytes rawTx = writer.toArray();
-    std::string base64Tx = Base64::encode(rawTx);
-
-    auto request = createRequest("sendrawtransaction", nlohmann::json::array({base64Tx}), requestId_++);
-    auto response = httpService_->post(request);
+    auto request = createBase64Request("sendrawtransaction", [&](BinaryWriter& writer) {
+        writer.writeBytes(transaction->getBytes());
+    }, nlohmann::json::array(), requestId_++);
+    auto response = httpService_->postBody(request);
     auto result = handleResponse(response);
 
     return Hash256::fromHexString(result["hash"].get<std::string>());
@@ -280,10 +365,7 @@ SharedPtr<NeoGetWalletBalanceResponse> NeoRpcClient::getWalletBalance(const Hash
     return balanceResponse;
 } // namespace neocpp
 int64_t NeoRpcClient::calculateNetworkFee(const SharedPtr<Transaction>& transaction) {
-    BinaryWriter writer;
-    transaction->serialize(writer);
-    Bytes rawTx = writer.toArray();
-    std::string base64Tx = Base64::encode(rawTx);
+    const std::string& base64Tx = transaction->toBase64();
 
     auto request = createRequest("calculatenetworkfee", nlohmann::json::array({base64Tx}), requestId_++);
     auto response = httpService_->post(request);
@@ -1,9 +1,31 @@
 #include "neocpp/protocol/response_types_impl.hpp"
+#include "neocpp/protocol/rpc_response_reader.hpp"
 #include "neocpp/protocol/stack_item.hpp"
 #include "neocpp/exceptions.hpp"
 
 namespace neocpp {
 
+// RawResultJson
+void RawResultJson::set(const nlohmann::json& json) {
+    json_ = json;
+    deferred_.reset();
+} // namespace neocpp
+void RawResultJson::setBody(std::string body) {
+    deferred_ = std::make_shared<Deferred>();
+    deferred_->body = std::move(body);
+} // namespace neocpp
+const nlohmann::json& RawResultJson::get() const {
+    if (!deferred_) {
+        return json_;
+    }
+    Deferred& deferred = *deferred_;
+    std::call_once(deferred.parsed, [&deferred]() {
+        auto response = nlohmann::json::parse(deferred.body);
+        deferred.result = std::move(response["result"]);
+        std::string().swap(deferred.body);
+    });
+    return deferred.result;
+} // namespace neocpp
 // NeoGetVersionResponse
 void NeoGetVersionResponse::parseJson(const nlohmann::json& json) {
     if (json.contains("tcpport")) {
@@ -37,104 +59,147 @@ void NeoGetPeersResponse::parseJson(const nlohmann::json& json) {
     rawJson_ = json;
 } // namespace neocpp
 // NeoGetBlockResponse
-void NeoGetBlockResponse::parseJson(const nlohmann::json& json) {
-    if (json.contains("hash")) {
-        hash_ = Hash256::fromHexString(json["hash"].get<std::string>());
-    }
-    if (json.contains("size")) {
-        size_ = json["size"].get<int>();
-    }
-    if (json.contains("version")) {
-        version_ = json["version"].get<int>();
-    }
-    if (json.contains("previousblockhash")) {
-        previousBlockHash_ = Hash256::fromHexString(json["previousblockhash"].get<std::string>());
-    }
-    if (json.contains("merkleroot")) {
-        merkleRoot_ = Hash256::fromHexString(json["merkleroot"].get<std::string>());
-    }
-    if (json.contains("time")) {
-        time_ = json["time"].get<uint64_t>();
-    }
-    if (json.contains("index")) {
-        index_ = json["index"].get<uint32_t>();
-    }
-    if (json.contains("nextconsensus")) {
-        nextConsensus_ = json["nextconsensus"].get<std::string>();
-    }
-    if (json.contains("witnesses")) {
-        witnesses_ = json["witnesses"];
-    }
-    if (json.contains("tx")) {
-        transactions_ = json["tx"];
-    }
-    if (json.contains("confirmations")) {
-        confirmations_ = json["confirmations"].get<int>();
+class NeoGetBlockResponse::FieldReader : public RpcResultVisitor {
+public:
+    explicit FieldReader(NeoGetBlockResponse& response) : response_(response) {}
+
+    void onValue(const std::string& key, nlohmann::json&& value) override {
+        if (key == "hash") {
+            response_.hash_ = Hash256::fromHexString(value.get<std::string>());
+        } else if (key == "size") {
+            response_.size_ = value.get<int>();
+        } else if (key == "version") {
+            response_.version_ = value.get<int>();
+        } else if (key == "previousblockhash") {
+            response_.previousBlockHash_ = Hash256::fromHexString(value.get<std::string>());
+        } else if (key == "merkleroot") {
+            response_.merkleRoot_ = Hash256::fromHexString(value.get<std::string>());
+        } else if (key == "time") {
+            response_.time_ = value.get<uint64_t>();
+        } else if (key == "index") {
+            response_.index_ = value.get<uint32_t>();
+        } else if (key == "nextconsensus") {
+            response_.nextConsensus_ = value.get<std::string>();
+        } else if (key == "confirmations") {
+            response_.confirmations_ = value.get<int>();
+        } else if (key == "nextblockhash") {
+            response_.nextBlockHash_ = Hash256::fromHexString(value.get<std::string>());
+            response_.hasNextBlockHash_ = true;
+        }
     }
-    if (json.contains("nextblockhash")) {
-        nextBlockHash_ = Hash256::fromHexString(json["nextblockhash"].get<std::string>());
-        hasNextBlockHash_ = true;
+
+    nlohmann::json* onStructure(const std::string& key) override {
+        if (key == "witnesses") {
+            return &response_.witnesses_;
+        }
+        if (key == "tx") {
+            return &response_.transactions_;
+        }
+        return nullptr;
     }
-    rawJson_ = json;
+
+private:
+    NeoGetBlockResponse& response_;
+};
+
+void NeoGetBlockResponse::parseJson(const nlohmann::json& json) {
+    FieldReader reader(*this);
+    RpcResponseReader::visit(json, reader);
+    rawJson_.set(json);
+} // namespace neocpp
+void NeoGetBlockResponse::parseResponse(std::string body) {
+    FieldReader reader(*this);
+    RpcResponseReader::read(body, reader);
+    rawJson_.setBody(std::move(body));
 } // namespace neocpp
 // NeoGetRawTransactionResponse
-void NeoGetRawTransactionResponse::parseJson(const nlohmann::json& json) {
-    if (json.contains("hash")) {
-        hash_ = Hash256::fromHexString(json["hash"].get<std::string>());
-    }
-    if (json.contains("size")) {
-        size_ = json["size"].get<int>();
-    }
-    if (json.contains("version")) {
-        version_ = json["version"].get<int>();
-    }
-    if (json.contains("nonce")) {
-        nonce_ = json["nonce"].get<uint32_t>();
-    }
-    if (json.contains("sender")) {
-        sender_ = json["sender"].get<std::string>();
-    }
-    if (json.contains("sysfee")) {
-        sysfee_ = json["sysfee"].get<std::string>();
-    }
-    if (json.contains("netfee")) {
-        netfee_ = json["netfee"].get<std::string>();
-    }
-    if (json.contains("validuntilblock")) {
-        validUntilBlock_ = json["validuntilblock"].get<uint32_t>();
-    }
-    if (json.contains("signers")) {
-        signers_ = json["signers"];
-    }
-    if (json.contains("attributes")) {
-        attributes_ = json["attributes"];
-    }
-    if (json.contains("witnesses")) {
-        witnesses_ = json["witnesses"];
-    }
-    if (json.contains("script")) {
-        script_ = json["script"].get<std::string>();
-    }
-    if (json.contains("blockhash")) {
-        blockHash_ = Hash256::fromHexString(json["blockhash"].get<std::string>());
-    }
-    if (json.contains("confirmations")) {
-        confirmations_ = json["confirmations"].get<int>();
+class NeoGetRawTransactionResponse::FieldReader : public RpcResultVisitor {
+public:
+    explicit FieldReader(NeoGetRawTransactionResponse& response) : response_(response) {}
+
+    void onValue(const std::string& key, nlohmann::json&& value) override {
+        if (key == "hash") {
+            response_.hash_ = Hash256::fromHexString(value.get<std::string>());
+        } else if (key == "size") {
+            response_.size_ = value.get<int>();
+        } else if (key == "version") {
+            response_.version_ = value.get<int>();
+        } else if (key == "nonce") {
+            response_.nonce_ = value.get<uint32_t>();
+        } else if (key == "sender") {
+            response_.sender_ = std::move(value.get_ref<std::string&>());
+        } else if (key == "sysfee") {
+            response_.sysfee_ = std::move(value.get_ref<std::string&>());
+        } else if (key == "netfee") {
+            response_.netfee_ = std::move(value.get_ref<std::string&>());
+        } else if (key == "validuntilblock") {
+            response_.validUntilBlock_ = value.get<uint32_t>();
+        } else if (key == "script") {
+            response_.script_ = std::move(value.get_ref<std::string&>());
+        } else if (key == "blockhash") {
+            response_.blockHash_ = Hash256::fromHexString(value.get<std::string>());
+        } else if (key == "confirmations") {
+            response_.confirmations_ = value.get<int>();
+        } else if (key == "blocktime") {
+            response_.blockTime_ = value.get<uint64_t>();
+        }
     }
-    if (json.contains("blocktime")) {
-        blockTime_ = json["blocktime"].get<uint64_t>();
+
+    nlohmann::json* onStructure(const std::string& key) override {
+        if (key == "signers") {
+            return &response_.signers_;
+        }
+        if (key == "attributes") {
+            return &response_.attributes_;
+        }
+        if (key == "witnesses") {
+            return &response_.witnesses_;
+        }
+        return nullptr;
     }
-    rawJson_ = json;
+
+private:
+    NeoGetRawTransactionResponse& response_;
+};
+
+void NeoGetRawTransactionResponse::parseJson(const nlohmann::json& json) {
+    FieldReader reader(*this);
+    RpcResponseReader::visit(json, reader);
+    rawJson_.set(json);
+} // namespace neocpp
+void NeoGetRawTransactionResponse::parseResponse(std::string body) {
+    FieldReader reader(*this);
+    RpcResponseReader::read(body, reader);
+    rawJson_.setBody(std::move(body));
 } // namespace neocpp
 // NeoGetApplicationLogResponse
-void NeoGetApplicationLogResponse::parseJson(const nlohmann::json& json) {
-    if (json.contains("txid")) {
-        txid_ = json["txid"].get<std::string>();
+class NeoGetApplicationLogResponse::FieldReader : public RpcResultVisitor {
+public:
+    explicit FieldReader(NeoGetApplicationLogResponse& response) : response_(response) {}
+
+    void onValue(const std::string& key, nlohmann::json&& value) override {
+        if (key == "txid") {
+            response_.txid_ = std::move(value.get_ref<std::string&>());
+        }
     }
-    if (json.contains("executions")) {
-        executions_ = json["executions"];
+
+    nlohmann::json* onStructure(const std::string& key) override {
+        return key == "executions" ? &response_.executions_ : nullptr;
     }
-    rawJson_ = json;
+
+private:
+    NeoGetApplicationLogResponse& response_;
+};
+
+void NeoGetApplicationLogResponse::parseJson(const nlohmann::json& json) {
+    FieldReader reader(*this);
+    RpcResponseReader::visit(json, reader);
+    rawJson_.set(json);
+} // namespace neocpp
+void NeoGetApplicationLogResponse::parseResponse(std::string body) {
+    FieldReader reader(*this);
+    RpcResponseReader::read(body, reader);
+    rawJson_.setBody(std::move(body));
 } // namespace neocpp
 // NeoGetContractStateResponse
 void NeoGetContractStateResponse::parseJson(const nlohmann::json& json) {
@@ -172,35 +237,79 @@ void NeoGetNep17BalancesResponse::parseJson(const nlohmann::json& json) {
     rawJson_ = json;
 } // namespace neocpp
 // NeoInvokeResultResponse
-void NeoInvokeResultResponse::parseJson(const nlohmann::json& json) {
-    if (json.contains("script")) {
-        script_ = json["script"].get<std::string>();
-    }
-    if (json.contains("state")) {
-        state_ = json["state"].get<std::string>();
-    }
-    if (json.contains("gasconsumed")) {
-        gasConsumed_ = json["gasconsumed"].get<std::string>();
-    }
-    if (json.contains("exception")) {
-        exception_ = json["exception"].get<std::string>();
-        hasException_ = true;
-    }
-    if (json.contains("stack")) {
-        for (const auto& item : json["stack"]) {
-            stack_.push_back(StackItem::fromJson(item));
+class NeoInvokeResultResponse::FieldReader : public RpcResultVisitor {
+public:
+    explicit FieldReader(NeoInvokeResultResponse& response)
+        : response_(response), arena_(std::make_shared<StackItemArena>()), stack_(*arena_) {}
+
+    void onValue(const std::string& key, nlohmann::json&& value) override {
+        if (key == "script") {
+            response_.script_ = std::move(value.get_ref<std::string&>());
+        } else if (key == "state") {
+            response_.state_ = std::move(value.get_ref<std::string&>());
+        } else if (key == "gasconsumed") {
+            response_.gasConsumed_ = std::move(value.get_ref<std::string&>());
+        } else if (key == "exception") {
+            // Nodes send "exception": null for a clean HALT
+            if (!value.is_null()) {
+                response_.exception_ = std::move(value.get_ref<std::string&>());
+                response_.hasException_ = true;
+            }
+        } else if (key == "tx") {
+            response_.tx_ = std::move(value.get_ref<std::string&>());
+        } else if (key == "session") {
+            response_.session_ = std::move(value.get_ref<std::string&>());
         }
     }
-    if (json.contains("tx")) {
-        tx_ = json["tx"].get<std::string>();
+
+    RpcEventSink* onEvents(const std::string& key) override {
+        return key == "stack" ? &stack_ : nullptr;
     }
-    if (json.contains("notifications")) {
-        notifications_ = json["notifications"];
+
+    nlohmann::json* onStructure(const std::string& key) override {
+        if (key == "notifications") {
+            return &response_.notifications_;
+        }
+        if (key == "diagnostics") {
+            return &response_.diagnostics_;
+        }
+        return nullptr;
     }
-    if (json.contains("diagnostics")) {
-        diagnostics_ = json["diagnostics"];
+
+    /// Hand the stack read into the arena to the response once the result has been read
+    void finish() {
+        response_.stackArena_ = std::move(arena_);
+        response_.stackViews_ = std::move(stack_.getViews());
+        response_.stack_ = std::make_shared<ConvertedStack>();
     }
-    rawJson_ = json;
+
+private:
+    NeoInvokeResultResponse& response_;
+    std::shared_ptr<StackItemArena> arena_;
+    StackItemArena::StackReader stack_;
+};
+
+void NeoInvokeResultResponse::parseJson(const nlohmann::json& json) {
+    FieldReader reader(*this);
+    RpcResponseReader::visit(json, reader);
+    reader.finish();
+    rawJson_.set(json);
+} // namespace neocpp
+const std::vector<StackItemPtr>& NeoInvokeResultResponse::getStack() const {
+    ConvertedStack& stack = *stack_;
+    std::call_once(stack.converted, [this, &stack]() {
+        stack.items.reserve(stackViews_.size());
+        for (const auto& view : stackViews_) {
+            stack.items.push_back(view.toStackItem());
+        }
+    });
+    return stack.items;
+} // namespace neocpp
+void NeoInvokeResultResponse::parseResponse(std::string body) {
+    FieldReader reader(*this);
+    RpcResponseReader::read(body, reader);
+    reader.finish();
+    rawJson_.setBody(std::move(body));
 } // namespace neocpp
 // NeoGetUnclaimedGasResponse
 void NeoGetUnclaimedGasResponse::parseJson(const nlohmann::json& json) {
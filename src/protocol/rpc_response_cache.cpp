@@ -0,0 +1,164 @@
+#include "neocpp/protocol/rpc_response_cache.hpp"
+#include "neocpp/crypto/hash.hpp"
+#include "neocpp/utils/hex.hpp"
+#include "neocpp/exceptions.hpp"
+#include "neocpp/logger.hpp"
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+
+namespace neocpp {
+
+namespace {
+
+// Temporary file names are unique per process and write, so concurrent writers never share one
+const std::string tempFileTag = std::to_string(std::random_device{}());
+std::atomic<uint64_t> tempFileCounter{0};
+
+} // namespace
+
+RpcResponseCache::RpcResponseCache(size_t maxBytes, const std::string& directory)
+    : maxBytes_(maxBytes), directory_(directory) {
+    if (!directory_.empty()) {
+        std::error_code error;
+        std::filesystem::create_directories(directory_, error);
+        if (error) {
+            throw IllegalArgumentException("Cannot create response cache directory " + directory_ + ": " + error.message());
+        }
+    }
+} // namespace neocpp
+std::string RpcResponseCache::makeKey(const std::string& endpoint, const std::string& method,
+                                      const nlohmann::json& params) {
+    // A space never occurs in a URL, so the endpoint cannot run into the method name
+    return endpoint + ' ' + method + params.dump();
+} // namespace neocpp
+bool RpcResponseCache::get(const std::string& key, std::string& body) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto found = index_.find(key);
+        if (found != index_.end()) {
+            entries_.splice(entries_.begin(), entries_, found->second);
+            body = found->second->body;
+            ++hits_;
+            return true;
+        }
+    }
+
+    if (!directory_.empty() && readFromDisk(key, body)) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        insertLocked(key, body);
+        ++hits_;
+        ++diskHits_;
+        return true;
+    }
+    ++misses_;
+    return false;
+} // namespace neocpp
+void RpcResponseCache::put(const std::string& key, const std::string& body) {
+    if (!directory_.empty()) {
+        writeToDisk(key, body);
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    insertLocked(key, body);
+    ++insertions_;
+} // namespace neocpp
+void RpcResponseCache::insertLocked(const std::string& key, const std::string& body) {
+    size_t size = key.size() + body.size();
+    auto found = index_.find(key);
+    if (found != index_.end()) {
+        byteCount_ -= found->second->key.size() + found->second->body.size();
+        entries_.erase(found->second);
+        index_.erase(found);
+    }
+    if (size > maxBytes_) {
+        return;
+    }
+
+    while (byteCount_ + size > maxBytes_ && !entries_.empty()) {
+        const Entry& oldest = entries_.back();
+        byteCount_ -= oldest.key.size() + oldest.body.size();
+        index_.erase(oldest.key);
+        entries_.pop_back();
+        ++evictions_;
+    }
+    entries_.push_front(Entry{key, body});
+    index_.emplace(key, entries_.begin());
+    byteCount_ += size;
+} // namespace neocpp
+void RpcResponseCache::clear(bool removeFromDisk) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    index_.clear();
+    byteCount_ = 0;
+
+    if (removeFromDisk && !directory_.empty()) {
+        std::error_code error;
+        for (const auto& file : std::filesystem::directory_iterator(directory_, error)) {
+            if (file.path().extension() == ".rpc") {
+                std::filesystem::remove(file.path(), error);
+            }
+        }
+    }
+} // namespace neocpp
+RpcResponseCache::Stats RpcResponseCache::getStats() const {
+    Stats stats;
+    stats.hits = hits_;
+    stats.diskHits = diskHits_;
+    stats.misses = misses_;
+    stats.insertions = insertions_;
+    stats.evictions = evictions_;
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats.entryCount = entries_.size();
+    stats.byteCount = byteCount_;
+    return stats;
+} // namespace neocpp
+void RpcResponseCache::resetStats() {
+    hits_ = 0;
+    diskHits_ = 0;
+    misses_ = 0;
+    insertions_ = 0;
+    evictions_ = 0;
+} // namespace neocpp
+std::string RpcResponseCache::pathFor(const std::string& key) const {
+    uint8_t digest[32];
+    HashUtils::sha256(reinterpret_cast<const uint8_t*>(key.data()), key.size(), digest);
+    return (std::filesystem::path(directory_) / (Hex::encode(digest, sizeof(digest)) + ".rpc")).string();
+} // namespace neocpp
+// An entry file holds the key on the first line and the body after it; the key guards
+// against digest collisions and files copied between stores
+bool RpcResponseCache::readFromDisk(const std::string& key, std::string& body) const {
+    std::ifstream file(pathFor(key), std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    std::string storedKey;
+    if (!std::getline(file, storedKey) || storedKey != key) {
+        return false;
+    }
+    body.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return !file.bad();
+} // namespace neocpp
+void RpcResponseCache::writeToDisk(const std::string& key, const std::string& body) const {
+    // Written to a temporary file and renamed, so readers never see a partial entry
+    std::string path = pathFor(key);
+    std::string temporary = path + ".tmp" + tempFileTag + "-" + std::to_string(tempFileCounter++);
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        file << key << '\n' << body;
+        if (!file) {
+            LOG_WARN("Cannot write response cache entry " + temporary);
+            file.close();
+            std::error_code error;
+            std::filesystem::remove(temporary, error);
+            return;
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(temporary, path, error);
+    if (error) {
+        LOG_WARN("Cannot store response cache entry " + path + ": " + error.message());
+        std::filesystem::remove(temporary, error);
+    }
+} // namespace neocpp
+} // namespace neocpp
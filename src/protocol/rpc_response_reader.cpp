@@ -0,0 +1,261 @@
+#include "neocpp/protocol/rpc_response_reader.hpp"
+#include "neocpp/exceptions.hpp"
+#include <vector>
+
+namespace neocpp {
+
+namespace {
+
+/// SAX handler for one JSON-RPC response. It tracks where it is in the envelope, passes
+/// scalar result members to the visitor, forwards the events of structures the visitor
+/// takes itself, builds the structures it asks for in place, and steps over everything else.
+class ResponseHandler {
+public:
+    explicit ResponseHandler(RpcResultVisitor& visitor) : visitor_(visitor) {}
+
+    bool null() {
+        return value(nlohmann::json());
+    }
+
+    bool boolean(bool v) {
+        return value(nlohmann::json(v));
+    }
+
+    bool number_integer(nlohmann::json::number_integer_t v) {
+        return value(nlohmann::json(v));
+    }
+
+    bool number_unsigned(nlohmann::json::number_unsigned_t v) {
+        return value(nlohmann::json(v));
+    }
+
+    bool number_float(nlohmann::json::number_float_t v, const std::string&) {
+        return value(nlohmann::json(v));
+    }
+
+    bool string(std::string& v) {
+        return value(nlohmann::json(std::move(v)));
+    }
+
+    bool binary(nlohmann::json::binary_t&) {
+        return true;  // never produced by JSON text
+    }
+
+    bool start_object(std::size_t) {
+        return startStructure(nlohmann::json::value_t::object);
+    }
+
+    bool start_array(std::size_t) {
+        return startStructure(nlohmann::json::value_t::array);
+    }
+
+    bool end_object() {
+        return endStructure();
+    }
+
+    bool end_array() {
+        return endStructure();
+    }
+
+    bool key(std::string& k) {
+        if (sink_) {
+            sink_->key(k);
+        } else if (!building_.empty()) {
+            pendingKey_ = std::move(k);
+        } else if (skipDepth_ == 0) {
+            key_ = std::move(k);
+        }
+        return true;
+    }
+
+    bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& e) {
+        throw RpcException("Failed to parse JSON response: " + std::string(e.what()));
+    }
+
+    /// Throw for error responses and responses without a result
+    void finish() const {
+        if (hasError_) {
+            std::string message = error_.is_object() && error_.contains("message") && error_["message"].is_string()
+                ? error_["message"].get<std::string>()
+                : error_.dump();
+            throw RpcException("RPC error: " + message);
+        }
+        if (!hasResult_) {
+            throw RpcException("Invalid RPC response: missing result");
+        }
+    }
+
+private:
+    // Depth in the envelope: 0 outside, 1 in the response object, 2 in the result object
+    enum Depth { OUTSIDE = 0, ENVELOPE = 1, RESULT = 2 };
+
+    /// Add v to the structure being built and return where it landed
+    nlohmann::json* insert(nlohmann::json&& v) {
+        nlohmann::json* parent = building_.back();
+        if (parent->is_object()) {
+            auto& members = parent->get_ref<nlohmann::json::object_t&>();
+            return &members.insert_or_assign(std::move(pendingKey_), std::move(v)).first->second;
+        }
+        auto& elements = parent->get_ref<nlohmann::json::array_t&>();
+        elements.push_back(std::move(v));
+        return &elements.back();
+    }
+
+    bool value(nlohmann::json&& v) {
+        if (sink_) {
+            sink_->value(std::move(v));
+        } else if (!building_.empty()) {
+            insert(std::move(v));
+        } else if (skipDepth_ > 0) {
+            // inside a structure nobody asked for
+        } else if (depth_ == RESULT) {
+            visitor_.onValue(key_, std::move(v));
+        } else if (depth_ == ENVELOPE) {
+            if (key_ == "result") {
+                hasResult_ = !v.is_null();
+            } else if (key_ == "error" && !v.is_null()) {
+                hasError_ = true;
+                error_ = std::move(v);
+            }
+        }
+        return true;
+    }
+
+    bool startStructure(nlohmann::json::value_t type) {
+        if (sink_) {
+            ++sinkDepth_;
+            startSink(type);
+            return true;
+        }
+        if (!building_.empty()) {
+            building_.push_back(insert(nlohmann::json(type)));
+            return true;
+        }
+        if (skipDepth_ > 0) {
+            ++skipDepth_;
+            return true;
+        }
+
+        nlohmann::json* target = nullptr;
+        switch (depth_) {
+            case OUTSIDE:
+                if (type != nlohmann::json::value_t::object) {
+                    throw RpcException("Invalid RPC response: expected an object");
+                }
+                depth_ = ENVELOPE;
+                return true;
+            case ENVELOPE:
+                if (key_ == "result") {
+                    hasResult_ = true;
+                    if (type == nlohmann::json::value_t::object) {
+                        depth_ = RESULT;
+                        return true;
+                    }
+                } else if (key_ == "error") {
+                    hasError_ = true;
+                    target = &error_;
+                }
+                break;
+            default:
+                if (RpcEventSink* sink = visitor_.onEvents(key_)) {
+                    sink_ = sink;
+                    sinkDepth_ = 1;
+                    startSink(type);
+                    return true;
+                }
+                target = visitor_.onStructure(key_);
+                break;
+        }
+
+        if (target) {
+            *target = nlohmann::json(type);
+            building_.push_back(target);
+        } else {
+            skipDepth_ = 1;
+        }
+        return true;
+    }
+
+    bool endStructure() {
+        if (sink_) {
+            sink_->endStructure();
+            if (--sinkDepth_ == 0) {
+                sink_ = nullptr;
+            }
+        } else if (!building_.empty()) {
+            building_.pop_back();
+        } else if (skipDepth_ > 0) {
+            --skipDepth_;
+        } else {
+            depth_ = depth_ == RESULT ? ENVELOPE : OUTSIDE;
+        }
+        return true;
+    }
+
+    void startSink(nlohmann::json::value_t type) {
+        if (type == nlohmann::json::value_t::object) {
+            sink_->startObject();
+        } else {
+            sink_->startArray();
+        }
+    }
+
+    RpcResultVisitor& visitor_;
+    RpcEventSink* sink_ = nullptr;           // receives the events of the current member
+    size_t sinkDepth_ = 0;
+    int depth_ = OUTSIDE;
+    size_t skipDepth_ = 0;
+    std::vector<nlohmann::json*> building_;  // open structures, innermost last
+    std::string key_;                        // last key at envelope or result level
+    std::string pendingKey_;                 // last key inside a structure being built
+    bool hasResult_ = false;
+    bool hasError_ = false;
+    nlohmann::json error_;
+};
+
+/// Send the events of an already parsed value to a sink
+void replay(const nlohmann::json& value, RpcEventSink& sink) {
+    if (value.is_object()) {
+        sink.startObject();
+        for (const auto& member : value.items()) {
+            std::string key = member.key();
+            sink.key(key);
+            replay(member.value(), sink);
+        }
+        sink.endStructure();
+    } else if (value.is_array()) {
+        sink.startArray();
+        for (const auto& element : value) {
+            replay(element, sink);
+        }
+        sink.endStructure();
+    } else {
+        sink.value(nlohmann::json(value));
+    }
+}
+
+} // namespace
+
+void RpcResponseReader::read(std::string_view body, RpcResultVisitor& visitor) {
+    ResponseHandler handler(visitor);
+    nlohmann::json::sax_parse(body.begin(), body.end(), &handler);
+    handler.finish();
+} // namespace neocpp
+void RpcResponseReader::visit(const nlohmann::json& result, RpcResultVisitor& visitor) {
+    if (!result.is_object()) {
+        return;
+    }
+    for (const auto& member : result.items()) {
+        const nlohmann::json& value = member.value();
+        if (value.is_structured()) {
+            if (RpcEventSink* sink = visitor.onEvents(member.key())) {
+                replay(value, *sink);
+            } else if (nlohmann::json* target = visitor.onStructure(member.key())) {
+                *target = value;
+            }
+        } else {
+            visitor.onValue(member.key(), nlohmann::json(value));
+        }
+    }
+} // namespace neocpp
+} // namespace neocpp
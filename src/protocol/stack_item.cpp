@@ -54,8 +54,11 @@ StackItemPtr StackItem::fromJson(const nlohmann::json& json) {
     }
     else if (type == "Integer") {
         std::string valueStr = json["value"].get<std::string>();
-        int64_t value = std::stoll(valueStr);
-        return std::make_shared<IntegerStackItem>(value);
+        try {
+            return std::make_shared<IntegerStackItem>(BigInteger::parse(valueStr));
+        } catch (const IllegalArgumentException&) {
+            throw DeserializationException("Invalid integer stack item: " + valueStr);
+        }
     }
     else if (type == "ByteString") {
         std::string hexStr = json["value"].get<std::string>();
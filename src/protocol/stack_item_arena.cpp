@@ -0,0 +1,606 @@
+#include "neocpp/protocol/stack_item_arena.hpp"
+#include "neocpp/utils/hex.hpp"
+#include "neocpp/exceptions.hpp"
+#include <charconv>
+
+namespace neocpp {
+
+// StackItemView
+StackItemType StackItemView::getType() const {
+    return arena_->nodes_[index_].type;
+} // namespace neocpp
+bool StackItemView::getBoolean() const {
+    const auto& node = arena_->nodes_[index_];
+    switch (node.type) {
+        case StackItemType::BOOLEAN:
+            return node.value != 0;
+        case StackItemType::INTEGER:
+            return node.value != 0 || node.count != 0;
+        case StackItemType::BYTE_STRING:
+        case StackItemType::ARRAY:
+        case StackItemType::STRUCT:
+        case StackItemType::MAP:
+            return node.count != 0;
+        default:
+            throw IllegalStateException("Cannot convert to boolean");
+    }
+} // namespace neocpp
+int64_t StackItemView::getInteger() const {
+    const auto& node = arena_->nodes_[index_];
+    switch (node.type) {
+        case StackItemType::INTEGER:
+            if (node.count != 0) {
+                return getBigInteger().toInt64();
+            }
+            return node.value;
+        case StackItemType::BOOLEAN:
+        case StackItemType::POINTER:
+            return node.value;
+        default:
+            throw IllegalStateException("Cannot convert to integer");
+    }
+} // namespace neocpp
+BigInteger StackItemView::getBigInteger() const {
+    const auto& node = arena_->nodes_[index_];
+    if (node.type == StackItemType::INTEGER && node.count != 0) {
+        return BigInteger::fromBytes(ByteView(arena_->bytes_.data() + node.offset, node.count));
+    }
+    return BigInteger(getInteger());
+} // namespace neocpp
+ByteView StackItemView::getBytes() const {
+    const auto& node = arena_->nodes_[index_];
+    if (node.type != StackItemType::BYTE_STRING) {
+        throw IllegalStateException("Cannot convert to byte array");
+    }
+    return ByteView(arena_->bytes_.data() + node.offset, node.count);
+} // namespace neocpp
+std::string_view StackItemView::getString() const {
+    const auto& node = arena_->nodes_[index_];
+    if (node.type != StackItemType::BYTE_STRING && node.type != StackItemType::INTEROP_INTERFACE) {
+        throw IllegalStateException("Cannot convert to string");
+    }
+    return std::string_view(reinterpret_cast<const char*>(arena_->bytes_.data()) + node.offset, node.count);
+} // namespace neocpp
+bool StackItemView::isArray() const {
+    StackItemType type = getType();
+    return type == StackItemType::ARRAY || type == StackItemType::STRUCT;
+} // namespace neocpp
+bool StackItemView::isMap() const {
+    return getType() == StackItemType::MAP;
+} // namespace neocpp
+size_t StackItemView::size() const {
+    if (!isArray() && !isMap()) {
+        throw IllegalStateException("Stack item has no elements");
+    }
+    return arena_->nodes_[index_].count;
+} // namespace neocpp
+StackItemView StackItemView::child(size_t slot, size_t count, size_t index) const {
+    if (index >= count) {
+        throw IllegalArgumentException("Index out of bounds");
+    }
+    return StackItemView(arena_, arena_->children_[arena_->nodes_[index_].offset + slot]);
+} // namespace neocpp
+StackItemView StackItemView::at(size_t index) const {
+    if (!isArray()) {
+        throw IllegalStateException("Cannot convert to array");
+    }
+    return child(index, arena_->nodes_[index_].count, index);
+} // namespace neocpp
+StackItemView StackItemView::keyAt(size_t index) const {
+    if (!isMap()) {
+        throw IllegalStateException("Cannot convert to map");
+    }
+    return child(2 * index, arena_->nodes_[index_].count, index);
+} // namespace neocpp
+StackItemView StackItemView::valueAt(size_t index) const {
+    if (!isMap()) {
+        throw IllegalStateException("Cannot convert to map");
+    }
+    return child(2 * index + 1, arena_->nodes_[index_].count, index);
+} // namespace neocpp
+StackItemPtr StackItemView::toStackItem() const {
+    const auto& node = arena_->nodes_[index_];
+    switch (node.type) {
+        case StackItemType::BOOLEAN:
+            return std::make_shared<BooleanStackItem>(node.value != 0);
+        case StackItemType::INTEGER:
+            return std::make_shared<IntegerStackItem>(getBigInteger());
+        case StackItemType::POINTER:
+            return std::make_shared<PointerStackItem>(node.value);
+        case StackItemType::BYTE_STRING:
+            return std::make_shared<ByteStringStackItem>(getBytes().toBytes());
+        case StackItemType::INTEROP_INTERFACE:
+            return std::make_shared<InteropInterfaceStackItem>(std::string(getString()));
+        case StackItemType::ARRAY:
+        case StackItemType::STRUCT: {
+            std::vector<StackItemPtr> items;
+            items.reserve(node.count);
+            for (size_t i = 0; i < node.count; ++i) {
+                items.push_back(at(i).toStackItem());
+            }
+            if (node.type == StackItemType::STRUCT) {
+                return std::make_shared<StructStackItem>(items);
+            }
+            return std::make_shared<ArrayStackItem>(items);
+        }
+        case StackItemType::MAP: {
+            std::map<StackItemPtr, StackItemPtr, std::owner_less<StackItemPtr>> map;
+            for (size_t i = 0; i < node.count; ++i) {
+                map[keyAt(i).toStackItem()] = valueAt(i).toStackItem();
+            }
+            return std::make_shared<MapStackItem>(map);
+        }
+        default:
+            throw IllegalStateException("Unsupported stack item type");
+    }
+} // namespace neocpp
+nlohmann::json StackItemView::toJson() const {
+    const auto& node = arena_->nodes_[index_];
+    switch (node.type) {
+        case StackItemType::BOOLEAN:
+            return nlohmann::json{{"type", "Boolean"}, {"value", node.value != 0}};
+        case StackItemType::INTEGER:
+            return nlohmann::json{{"type", "Integer"}, {"value", getBigInteger().toString()}};
+        case StackItemType::POINTER:
+            return nlohmann::json{{"type", "Pointer"}, {"value", node.value}};
+        case StackItemType::BYTE_STRING: {
+            ByteView bytes = getBytes();
+            return nlohmann::json{{"type", "ByteString"}, {"value", Hex::encode(bytes.data(), bytes.size())}};
+        }
+        case StackItemType::INTEROP_INTERFACE:
+            return nlohmann::json{{"type", "InteropInterface"}, {"interface", std::string(getString())}};
+        case StackItemType::ARRAY:
+        case StackItemType::STRUCT: {
+            nlohmann::json items = nlohmann::json::array();
+            for (size_t i = 0; i < node.count; ++i) {
+                items.push_back(at(i).toJson());
+            }
+            return nlohmann::json{{"type", node.type == StackItemType::STRUCT ? "Struct" : "Array"}, {"value", items}};
+        }
+        case StackItemType::MAP: {
+            nlohmann::json entries = nlohmann::json::array();
+            for (size_t i = 0; i < node.count; ++i) {
+                entries.push_back(nlohmann::json{{"key", keyAt(i).toJson()}, {"value", valueAt(i).toJson()}});
+            }
+            return nlohmann::json{{"type", "Map"}, {"value", entries}};
+        }
+        default:
+            throw IllegalStateException("Unsupported stack item type");
+    }
+} // namespace neocpp
+// StackItemArena
+StackItemView StackItemArena::add(const nlohmann::json& json) {
+    return StackItemView(this, addJson(json));
+} // namespace neocpp
+StackItemView StackItemArena::add(const StackItem& item) {
+    return StackItemView(this, addItem(item));
+} // namespace neocpp
+void StackItemArena::reserve(size_t items, size_t bytes) {
+    nodes_.reserve(items);
+    children_.reserve(items);
+    bytes_.reserve(bytes);
+} // namespace neocpp
+void StackItemArena::clear() {
+    nodes_.clear();
+    children_.clear();
+    bytes_.clear();
+} // namespace neocpp
+uint32_t StackItemArena::addNode(StackItemType type) {
+    Node node;
+    node.type = type;
+    nodes_.push_back(node);
+    return static_cast<uint32_t>(nodes_.size() - 1);
+} // namespace neocpp
+uint32_t StackItemArena::addChildren(uint32_t node, size_t slots) {
+    auto offset = static_cast<uint32_t>(children_.size());
+    children_.resize(children_.size() + slots);
+    nodes_[node].offset = offset;
+    return offset;
+} // namespace neocpp
+void StackItemArena::setBytes(uint32_t node, const uint8_t* data, size_t size) {
+    nodes_[node].offset = static_cast<uint32_t>(bytes_.size());
+    nodes_[node].count = static_cast<uint32_t>(size);
+    bytes_.insert(bytes_.end(), data, data + size);
+} // namespace neocpp
+void StackItemArena::setInteger(uint32_t node, const BigInteger& value) {
+    if (value.fitsInt64()) {
+        nodes_[node].value = value.toInt64();
+        return;
+    }
+    uint8_t encoded[BigInteger::MAX_SIZE];
+    size_t size = value.getByteLength();
+    value.writeBytes(encoded, size);
+    setBytes(node, encoded, size);
+} // namespace neocpp
+uint32_t StackItemArena::addJson(const nlohmann::json& json) {
+    if (!json.contains("type")) {
+        throw DeserializationException("Stack item JSON must contain 'type' field");
+    }
+
+    const std::string& type = json["type"].get_ref<const std::string&>();
+
+    if (type == "Array" || type == "Struct") {
+        uint32_t node = addNode(type == "Array" ? StackItemType::ARRAY : StackItemType::STRUCT);
+        const auto& items = json["value"];
+        uint32_t offset = addChildren(node, items.size());
+        nodes_[node].count = static_cast<uint32_t>(items.size());
+        for (size_t i = 0; i < items.size(); ++i) {
+            uint32_t child = addJson(items[i]);
+            children_[offset + i] = child;
+        }
+        return node;
+    }
+    if (type == "Map") {
+        uint32_t node = addNode(StackItemType::MAP);
+        if (!json.contains("value") || !json["value"].is_array()) {
+            return node;
+        }
+        size_t entries = 0;
+        for (const auto& entry : json["value"]) {
+            if (entry.contains("key") && entry.contains("value")) {
+                ++entries;
+            }
+        }
+        uint32_t offset = addChildren(node, 2 * entries);
+        nodes_[node].count = static_cast<uint32_t>(entries);
+        size_t slot = offset;
+        for (const auto& entry : json["value"]) {
+            if (entry.contains("key") && entry.contains("value")) {
+                uint32_t key = addJson(entry["key"]);
+                children_[slot++] = key;
+                uint32_t value = addJson(entry["value"]);
+                children_[slot++] = value;
+            }
+        }
+        return node;
+    }
+
+    static const nlohmann::json missing;
+    auto value = json.find(type == "InteropInterface" ? "interface" : "value");
+    return addScalar(type, value != json.end() ? *value : missing);
+} // namespace neocpp
+uint32_t StackItemArena::addScalar(const std::string& type, const nlohmann::json& value) {
+    if (type == "Boolean") {
+        if (!value.is_boolean()) {
+            throw DeserializationException("Invalid boolean stack item");
+        }
+        uint32_t node = addNode(StackItemType::BOOLEAN);
+        nodes_[node].value = value.get<bool>() ? 1 : 0;
+        return node;
+    }
+    if (type == "Integer") {
+        if (!value.is_string()) {
+            throw DeserializationException("Invalid integer stack item: " + value.dump());
+        }
+        const std::string& text = value.get_ref<const std::string&>();
+        int64_t parsed = 0;
+        auto result = std::from_chars(text.data(), text.data() + text.size(), parsed);
+        uint32_t node = addNode(StackItemType::INTEGER);
+        if (result.ec == std::errc() && result.ptr == text.data() + text.size()) {
+            nodes_[node].value = parsed;
+            return node;
+        }
+        // Wider than 64 bits, or not a number at all
+        try {
+            setInteger(node, BigInteger::parse(text));
+        } catch (const IllegalArgumentException&) {
+            nodes_.pop_back();
+            throw DeserializationException("Invalid integer stack item: " + text);
+        }
+        return node;
+    }
+    if (type == "ByteString") {
+        if (!value.is_string()) {
+            throw DeserializationException("Invalid byte string stack item");
+        }
+        // Decoded straight into the shared buffer; invalid hex gives an empty string, as in fromJson
+        std::string_view hex = value.get_ref<const std::string&>();
+        size_t digits = hex.size() - (hex.size() >= 2 && hex[0] == '0' && (hex[1] == 'x' || hex[1] == 'X') ? 2 : 0);
+        uint32_t node = addNode(StackItemType::BYTE_STRING);
+        size_t offset = bytes_.size();
+        nodes_[node].offset = static_cast<uint32_t>(offset);
+        if (digits % 2 == 0) {
+            bytes_.resize(offset + digits / 2);
+            if (Hex::decode(hex, bytes_.data() + offset, digits / 2)) {
+                nodes_[node].count = static_cast<uint32_t>(digits / 2);
+            } else {
+                bytes_.resize(offset);
+            }
+        }
+        return node;
+    }
+    if (type == "Pointer") {
+        if (!value.is_number()) {
+            throw DeserializationException("Invalid pointer stack item");
+        }
+        uint32_t node = addNode(StackItemType::POINTER);
+        nodes_[node].value = value.get<int64_t>();
+        return node;
+    }
+    if (type == "InteropInterface") {
+        if (!value.is_string()) {
+            throw DeserializationException("Invalid interop interface stack item");
+        }
+        const std::string& id = value.get_ref<const std::string&>();
+        uint32_t node = addNode(StackItemType::INTEROP_INTERFACE);
+        setBytes(node, reinterpret_cast<const uint8_t*>(id.data()), id.size());
+        return node;
+    }
+    throw DeserializationException("Unknown stack item type: " + type);
+} // namespace neocpp
+uint32_t StackItemArena::addItem(const StackItem& item) {
+    StackItemType type = item.getType();
+    switch (type) {
+        case StackItemType::BOOLEAN:
+        case StackItemType::POINTER: {
+            uint32_t node = addNode(type);
+            nodes_[node].value = item.getInteger();
+            return node;
+        }
+        case StackItemType::INTEGER: {
+            uint32_t node = addNode(type);
+            setInteger(node, item.getBigInteger());
+            return node;
+        }
+        case StackItemType::BYTE_STRING: {
+            Bytes bytes = item.getByteArray();
+            uint32_t node = addNode(type);
+            setBytes(node, bytes.data(), bytes.size());
+            return node;
+        }
+        case StackItemType::INTEROP_INTERFACE: {
+            std::string id = item.getString();
+            uint32_t node = addNode(type);
+            setBytes(node, reinterpret_cast<const uint8_t*>(id.data()), id.size());
+            return node;
+        }
+        case StackItemType::ARRAY:
+        case StackItemType::STRUCT: {
+            auto items = item.getArray();
+            uint32_t node = addNode(type);
+            uint32_t offset = addChildren(node, items.size());
+            nodes_[node].count = static_cast<uint32_t>(items.size());
+            for (size_t i = 0; i < items.size(); ++i) {
+                uint32_t child = addItem(*items[i]);
+                children_[offset + i] = child;
+            }
+            return node;
+        }
+        case StackItemType::MAP: {
+            auto map = item.getMap();
+            uint32_t node = addNode(type);
+            uint32_t offset = addChildren(node, 2 * map.size());
+            nodes_[node].count = static_cast<uint32_t>(map.size());
+            size_t slot = offset;
+            for (const auto& [key, value] : map) {
+                uint32_t keyNode = addItem(*key);
+                children_[slot++] = keyNode;
+                uint32_t valueNode = addItem(*value);
+                children_[slot++] = valueNode;
+            }
+            return node;
+        }
+        default:
+            throw IllegalArgumentException("Unsupported stack item type");
+    }
+} // namespace neocpp
+// StackItemArena::StackReader
+void StackItemArena::StackReader::key(std::string& key) {
+    if (!frames_.empty()) {
+        Frame& top = frames_.back();
+        if (top.kind == Kind::ITEM || top.kind == Kind::ENTRY || top.kind == Kind::BUFFER) {
+            top.key = std::move(key);
+        }
+    }
+} // namespace neocpp
+void StackItemArena::StackReader::value(nlohmann::json&& value) {
+    if (frames_.empty()) {
+        throw DeserializationException("Stack must be an array");
+    }
+    Frame& top = frames_.back();
+    switch (top.kind) {
+        case Kind::STACK:
+        case Kind::ELEMENTS:
+            throw DeserializationException("Stack item JSON must contain 'type' field");
+        case Kind::ENTRY:
+            if (top.key == "key" || top.key == "value") {
+                throw DeserializationException("Stack item JSON must contain 'type' field");
+            }
+            break;
+        case Kind::ITEM:
+            if (top.key == "type") {
+                if (!value.is_string()) {
+                    throw DeserializationException("Stack item type must be a string");
+                }
+                top.type = std::move(value.get_ref<std::string&>());
+            } else if (top.key == "value") {
+                top.value = std::move(value);
+            } else if (top.key == "interface") {
+                top.interface = std::move(value);
+            }
+            break;
+        case Kind::BUFFER:
+            if (top.target->is_object()) {
+                (*top.target)[std::move(top.key)] = std::move(value);
+            } else {
+                top.target->push_back(std::move(value));
+            }
+            break;
+        default:
+            break;  // entries that are not key/value objects and skipped structures
+    }
+} // namespace neocpp
+void StackItemArena::StackReader::startObject() {
+    startStructure(nlohmann::json::value_t::object);
+} // namespace neocpp
+void StackItemArena::StackReader::startArray() {
+    startStructure(nlohmann::json::value_t::array);
+} // namespace neocpp
+void StackItemArena::StackReader::push(Kind kind, nlohmann::json* target) {
+    frames_.emplace_back();
+    frames_.back().kind = kind;
+    frames_.back().start = pending_.size();
+    frames_.back().target = target;
+} // namespace neocpp
+void StackItemArena::StackReader::startStructure(nlohmann::json::value_t type) {
+    bool isObject = type == nlohmann::json::value_t::object;
+    if (frames_.empty()) {
+        if (isObject) {
+            throw DeserializationException("Stack must be an array");
+        }
+        push(Kind::STACK);
+        return;
+    }
+
+    Frame& top = frames_.back();
+    switch (top.kind) {
+        case Kind::STACK:
+        case Kind::ELEMENTS:
+            if (!isObject) {
+                throw DeserializationException("Stack item JSON must contain 'type' field");
+            }
+            push(Kind::ITEM);
+            break;
+        case Kind::ENTRIES:
+            push(isObject ? Kind::ENTRY : Kind::SKIP);
+            break;
+        case Kind::ENTRY:
+            if (top.key != "key" && top.key != "value") {
+                push(Kind::SKIP);
+            } else if (!isObject) {
+                throw DeserializationException("Stack item JSON must contain 'type' field");
+            } else {
+                push(Kind::ITEM);
+            }
+            break;
+        case Kind::ITEM:
+            if (top.key == "value") {
+                startItemValue(type);
+            } else {
+                push(Kind::SKIP);
+            }
+            break;
+        case Kind::BUFFER: {
+            nlohmann::json* parent = top.target;
+            nlohmann::json* child = nullptr;
+            if (parent->is_object()) {
+                child = &((*parent)[std::move(top.key)] = nlohmann::json(type));
+            } else {
+                parent->push_back(nlohmann::json(type));
+                child = &parent->back();
+            }
+            push(Kind::BUFFER, child);
+            break;
+        }
+        case Kind::SKIP:
+            push(Kind::SKIP);
+            break;
+    }
+} // namespace neocpp
+void StackItemArena::StackReader::startItemValue(nlohmann::json::value_t type) {
+    Frame& item = frames_.back();
+    bool isArray = type == nlohmann::json::value_t::array;
+    if (item.type.empty()) {
+        // The type decides how the value is read, so without it the value is kept as JSON
+        item.collecting = true;
+        collected_ = nlohmann::json(type);
+        push(Kind::BUFFER, &collected_);
+    } else if (item.type == "Array" || item.type == "Struct") {
+        if (!isArray) {
+            throw DeserializationException("Invalid " + item.type + " stack item value");
+        }
+        push(Kind::ELEMENTS);
+    } else if (item.type == "Map") {
+        // A Map value that is not an array gives an empty map, as in add
+        push(isArray ? Kind::ENTRIES : Kind::SKIP);
+    } else {
+        throw DeserializationException("Invalid " + item.type + " stack item value");
+    }
+} // namespace neocpp
+void StackItemArena::StackReader::endStructure() {
+    Frame& frame = frames_.back();
+    switch (frame.kind) {
+        case Kind::STACK:
+            views_.reserve(views_.size() + pending_.size() - frame.start);
+            for (size_t i = frame.start; i < pending_.size(); ++i) {
+                views_.push_back(arena_.view(pending_[i]));
+            }
+            pending_.resize(frame.start);
+            frames_.pop_back();
+            break;
+        case Kind::ITEM: {
+            uint32_t node = endItem(frame);
+            frames_.pop_back();
+            deliver(node);
+            break;
+        }
+        case Kind::ELEMENTS:
+            endContainer(1);
+            break;
+        case Kind::ENTRIES:
+            endContainer(2);
+            break;
+        case Kind::ENTRY:
+            // Entries without both a key and a value are left out, as in add
+            if (frame.entryKey != NONE && frame.entryValue != NONE) {
+                pending_.push_back(frame.entryKey);
+                pending_.push_back(frame.entryValue);
+            }
+            frames_.pop_back();
+            break;
+        default:
+            frames_.pop_back();
+            break;
+    }
+} // namespace neocpp
+uint32_t StackItemArena::StackReader::endItem(Frame& item) {
+    if (item.collecting) {
+        nlohmann::json json = {{"type", item.type}, {"value", std::move(collected_)}};
+        collected_ = nullptr;
+        if (item.type.empty()) {
+            throw DeserializationException("Stack item JSON must contain 'type' field");
+        }
+        return arena_.addJson(json);
+    }
+    if (item.type.empty()) {
+        throw DeserializationException("Stack item JSON must contain 'type' field");
+    }
+
+    StackItemType type = StackItemType::ANY;
+    if (item.type == "Array") {
+        type = StackItemType::ARRAY;
+    } else if (item.type == "Struct") {
+        type = StackItemType::STRUCT;
+    } else if (item.type == "Map") {
+        type = StackItemType::MAP;
+    } else {
+        return arena_.addScalar(item.type, item.type == "InteropInterface" ? item.interface : item.value);
+    }
+    if (type != StackItemType::MAP && !item.value.is_null()) {
+        throw DeserializationException("Invalid " + item.type + " stack item value");
+    }
+    uint32_t node = arena_.addNode(type);
+    arena_.nodes_[node].offset = item.childOffset;
+    arena_.nodes_[node].count = item.childCount;
+    return node;
+} // namespace neocpp
+void StackItemArena::StackReader::endContainer(size_t slotsPerChild) {
+    size_t start = frames_.back().start;
+    frames_.pop_back();
+
+    // The children of one container are appended as one run once they are all known
+    Frame& item = frames_.back();
+    item.childOffset = static_cast<uint32_t>(arena_.children_.size());
+    item.childCount = static_cast<uint32_t>((pending_.size() - start) / slotsPerChild);
+    arena_.children_.insert(arena_.children_.end(), pending_.begin() + static_cast<std::ptrdiff_t>(start), pending_.end());
+    pending_.resize(start);
+} // namespace neocpp
+void StackItemArena::StackReader::deliver(uint32_t node) {
+    Frame& top = frames_.back();
+    if (top.kind == Kind::ENTRY) {
+        (top.key == "key" ? top.entryKey : top.entryValue) = node;
+    } else {
+        pending_.push_back(node);
+    }
+} // namespace neocpp
+} // namespace neocpp
@@ -48,6 +48,18 @@ ScriptBuilder& ScriptBuilder::pushInteger(int64_t value) {
 
     return *this;
 } // namespace neocpp
+ScriptBuilder& ScriptBuilder::pushInteger(const BigInteger& value) {
+    if (value.fitsInt64()) {
+        return pushInteger(value.toInt64());
+    }
+
+    size_t width = value.getByteLength() <= 16 ? 16 : 32;
+    emit(width == 16 ? OpCode::PUSHINT128 : OpCode::PUSHINT256);
+    size_t offset = script_.size();
+    script_.resize(offset + width);
+    value.writeBytes(script_.data() + offset, width);
+    return *this;
+} // namespace neocpp
 ScriptBuilder& ScriptBuilder::pushData(const Bytes& data) {
     emitPushData(data);
     return *this;
@@ -70,7 +82,7 @@ ScriptBuilder& ScriptBuilder::pushContractParameter(const ContractParameter& par
         case ContractParameterType::BOOLEAN:
             return pushBool(parameter.getBoolean());
         case ContractParameterType::INTEGER:
-            return pushInteger(parameter.getInteger());
+            return pushInteger(parameter.getBigInteger());
         case ContractParameterType::BYTE_ARRAY:
             return pushData(parameter.getByteArray());
         case ContractParameterType::STRING:
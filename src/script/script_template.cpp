@@ -0,0 +1,420 @@
+#include "neocpp/script/script_template.hpp"
+#include "neocpp/script/script_builder.hpp"
+#include "neocpp/types/hash160.hpp"
+#include "neocpp/types/hash256.hpp"
+#include "neocpp/crypto/ec_key_pair.hpp"
+#include "neocpp/exceptions.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace neocpp {
+
+namespace {
+
+constexpr size_t HASH160_PUSH_SIZE = 1 + NeoConstants::HASH160_SIZE;
+constexpr size_t HASH256_PUSH_SIZE = 1 + NeoConstants::HASH256_SIZE;
+constexpr size_t PUBLIC_KEY_PUSH_SIZE = 1 + NeoConstants::PUBLIC_KEY_SIZE_COMPRESSED;
+
+uint8_t opcode(OpCode op) {
+    return OpCodeHelper::toByte(op);
+}
+
+// The encoders below mirror ScriptBuilder::pushInteger and ScriptBuilder::pushData
+size_t integerSize(int64_t value) {
+    if (value >= -1 && value <= 16) return 1;
+    if (value >= -128 && value <= 127) return 2;
+    if (value >= -32768 && value <= 32767) return 3;
+    if (value >= -2147483648LL && value <= 2147483647LL) return 5;
+    return 9;
+}
+
+uint8_t* writeInteger(uint8_t* out, int64_t value) {
+    if (value == -1) {
+        *out++ = opcode(OpCode::PUSHM1);
+        return out;
+    }
+    if (value >= 0 && value <= 16) {
+        *out++ = static_cast<uint8_t>(opcode(OpCode::PUSH0) + value);
+        return out;
+    }
+
+    int width = 8;
+    if (value >= -128 && value <= 127) {
+        *out++ = opcode(OpCode::PUSHINT8);
+        width = 1;
+    } else if (value >= -32768 && value <= 32767) {
+        *out++ = opcode(OpCode::PUSHINT16);
+        width = 2;
+    } else if (value >= -2147483648LL && value <= 2147483647LL) {
+        *out++ = opcode(OpCode::PUSHINT32);
+        width = 4;
+    } else {
+        *out++ = opcode(OpCode::PUSHINT64);
+    }
+    for (int i = 0; i < width; ++i) {
+        *out++ = static_cast<uint8_t>((value >> (i * 8)) & 0xFF);
+    }
+    return out;
+}
+
+size_t integerSize(const BigInteger& value) {
+    if (value.fitsInt64()) return integerSize(value.toInt64());
+    return value.getByteLength() <= 16 ? 17 : 33;
+}
+
+uint8_t* writeInteger(uint8_t* out, const BigInteger& value) {
+    if (value.fitsInt64()) {
+        return writeInteger(out, value.toInt64());
+    }
+    size_t width = value.getByteLength() <= 16 ? 16 : 32;
+    *out++ = opcode(width == 16 ? OpCode::PUSHINT128 : OpCode::PUSHINT256);
+    value.writeBytes(out, width);
+    return out + width;
+}
+
+size_t dataSize(size_t length) {
+    if (length <= 75) return 1 + length;
+    if (length <= 0xFF) return 2 + length;
+    if (length <= 0xFFFF) return 3 + length;
+    return 5 + length;
+}
+
+uint8_t* writeData(uint8_t* out, const uint8_t* data, size_t length) {
+    if (length <= 75) {
+        *out++ = static_cast<uint8_t>(length);
+    } else if (length <= 0xFF) {
+        *out++ = opcode(OpCode::PUSHDATA1);
+        *out++ = static_cast<uint8_t>(length);
+    } else if (length <= 0xFFFF) {
+        *out++ = opcode(OpCode::PUSHDATA2);
+        *out++ = static_cast<uint8_t>(length & 0xFF);
+        *out++ = static_cast<uint8_t>((length >> 8) & 0xFF);
+    } else {
+        *out++ = opcode(OpCode::PUSHDATA4);
+        for (int i = 0; i < 4; ++i) {
+            *out++ = static_cast<uint8_t>((length >> (i * 8)) & 0xFF);
+        }
+    }
+    if (length > 0) {
+        std::memcpy(out, data, length);
+    }
+    return out + length;
+}
+
+} // namespace
+
+// Argument
+
+ScriptTemplate::Argument ScriptTemplate::Argument::constant(const ContractParameter& value) {
+    Argument argument;
+    argument.kind_ = Kind::CONSTANT;
+    argument.value_ = value;
+    return argument;
+}
+
+ScriptTemplate::Argument ScriptTemplate::Argument::null() {
+    return Argument();
+}
+
+ScriptTemplate::Argument ScriptTemplate::Argument::slot(const std::string& name, SlotType type) {
+    Argument argument;
+    argument.kind_ = Kind::SLOT;
+    argument.slotName_ = name;
+    argument.slotType_ = type;
+    return argument;
+}
+
+// Values
+
+ScriptTemplate::Values::Values(const ScriptTemplate& owner)
+    : owner_(&owner), values_(owner.slots_.size()) {
+}
+
+ScriptTemplate::Values::Value& ScriptTemplate::Values::at(size_t slot, SlotType type) {
+    if (slot >= values_.size()) {
+        throw IllegalArgumentException("Slot index out of range: " + std::to_string(slot));
+    }
+    const Slot& declared = owner_->slots_[slot];
+    if (declared.type != type) {
+        throw IllegalArgumentException("Wrong value type for slot '" + declared.name + "'");
+    }
+    Value& value = values_[slot];
+    value.isSet = true;
+    return value;
+}
+
+ScriptTemplate::Values& ScriptTemplate::Values::setBoolean(size_t slot, bool value) {
+    at(slot, SlotType::BOOLEAN).integer = BigInteger(value ? 1 : 0);
+    return *this;
+}
+
+ScriptTemplate::Values& ScriptTemplate::Values::setInteger(size_t slot, int64_t value) {
+    at(slot, SlotType::INTEGER).integer = BigInteger(value);
+    return *this;
+}
+
+ScriptTemplate::Values& ScriptTemplate::Values::setInteger(size_t slot, const BigInteger& value) {
+    at(slot, SlotType::INTEGER).integer = value;
+    return *this;
+}
+
+ScriptTemplate::Values& ScriptTemplate::Values::setHash160(size_t slot, const Hash160& value) {
+    const auto& bytes = value.getBytes();
+    std::reverse_copy(bytes.begin(), bytes.end(), at(slot, SlotType::HASH160).fixed.begin());
+    return *this;
+}
+
+ScriptTemplate::Values& ScriptTemplate::Values::setHash256(size_t slot, const Hash256& value) {
+    const auto& bytes = value.getBytes();
+    std::reverse_copy(bytes.begin(), bytes.end(), at(slot, SlotType::HASH256).fixed.begin());
+    return *this;
+}
+
+ScriptTemplate::Values& ScriptTemplate::Values::setPublicKey(size_t slot, const Bytes& encodedPublicKey) {
+    if (encodedPublicKey.size() != NeoConstants::PUBLIC_KEY_SIZE_COMPRESSED) {
+        throw IllegalArgumentException("Public key must be " +
+                                       std::to_string(NeoConstants::PUBLIC_KEY_SIZE_COMPRESSED) + " bytes");
+    }
+    std::copy(encodedPublicKey.begin(), encodedPublicKey.end(), at(slot, SlotType::PUBLIC_KEY).fixed.begin());
+    return *this;
+}
+
+ScriptTemplate::Values& ScriptTemplate::Values::setBytes(size_t slot, const Bytes& value) {
+    at(slot, SlotType::BYTE_ARRAY).bytes.assign(value.begin(), value.end());
+    return *this;
+}
+
+ScriptTemplate::Values& ScriptTemplate::Values::setString(size_t slot, const std::string& value) {
+    at(slot, SlotType::STRING).bytes.assign(value.begin(), value.end());
+    return *this;
+}
+
+ScriptTemplate::Values& ScriptTemplate::Values::set(const std::string& name, const ContractParameter& value) {
+    size_t slot = owner_->getSlotIndex(name);
+    switch (owner_->slots_[slot].type) {
+        case SlotType::BOOLEAN:
+            return setBoolean(slot, value.getBoolean());
+        case SlotType::INTEGER:
+            return setInteger(slot, value.getBigInteger());
+        case SlotType::HASH160:
+            return setHash160(slot, value.getHash160());
+        case SlotType::HASH256:
+            return setHash256(slot, value.getHash256());
+        case SlotType::PUBLIC_KEY:
+            return setPublicKey(slot, value.getPublicKey()->getEncoded());
+        case SlotType::BYTE_ARRAY:
+            return setBytes(slot, value.getByteArray());
+        case SlotType::STRING:
+            return setString(slot, value.getString());
+    }
+    throw IllegalArgumentException("Unsupported slot type");
+}
+
+// ScriptTemplate
+
+ScriptTemplate ScriptTemplate::contractCall(const Hash160& scriptHash, const std::string& method,
+                                            const std::vector<Argument>& arguments) {
+    ScriptTemplate result;
+    result.callContract(scriptHash, method, arguments);
+    return result;
+}
+
+ScriptTemplate& ScriptTemplate::emit(OpCode op) {
+    uint8_t byte = opcode(op);
+    appendConstant(&byte, 1);
+    return *this;
+}
+
+ScriptTemplate& ScriptTemplate::emitRaw(const Bytes& bytes) {
+    appendConstant(bytes.data(), bytes.size());
+    return *this;
+}
+
+ScriptTemplate& ScriptTemplate::push(const ContractParameter& parameter) {
+    ScriptBuilder builder;
+    builder.pushContractParameter(parameter);
+    return emitRaw(builder.toArray());
+}
+
+ScriptTemplate& ScriptTemplate::pushSlot(const std::string& name, SlotType type) {
+    appendSlot(declareSlot(name, type));
+    return *this;
+}
+
+ScriptTemplate& ScriptTemplate::callContract(const Hash160& scriptHash, const std::string& method,
+                                             const std::vector<Argument>& arguments) {
+    // Same layout as ScriptBuilder::callContract: arguments in reverse, method, hash, SYSCALL
+    for (auto it = arguments.rbegin(); it != arguments.rend(); ++it) {
+        pushArgument(*it);
+    }
+    ScriptBuilder builder;
+    builder.pushString(method)
+           .pushData(scriptHash.toLittleEndianArray())
+           .emitSysCall("System.Contract.Call");
+    return emitRaw(builder.toArray());
+}
+
+ScriptTemplate& ScriptTemplate::callContract(const std::string& scriptHashSlot, const std::string& method,
+                                             const std::vector<Argument>& arguments) {
+    for (auto it = arguments.rbegin(); it != arguments.rend(); ++it) {
+        pushArgument(*it);
+    }
+    ScriptBuilder methodBuilder;
+    emitRaw(methodBuilder.pushString(method).toArray());
+    pushSlot(scriptHashSlot, SlotType::HASH160);
+    ScriptBuilder sysCallBuilder;
+    return emitRaw(sysCallBuilder.emitSysCall("System.Contract.Call").toArray());
+}
+
+ScriptTemplate& ScriptTemplate::append(const ScriptTemplate& other) {
+    for (const auto& segment : other.segments_) {
+        appendConstant(other.code_.data() + segment.offset, segment.length);
+        if (segment.slot != NO_SLOT) {
+            const Slot& slot = other.slots_[segment.slot];
+            appendSlot(declareSlot(slot.name, slot.type));
+        }
+    }
+    return *this;
+}
+
+size_t ScriptTemplate::getSlotIndex(const std::string& name) const {
+    for (size_t i = 0; i < slots_.size(); ++i) {
+        if (slots_[i].name == name) {
+            return i;
+        }
+    }
+    throw IllegalArgumentException("Unknown template slot: " + name);
+}
+
+void ScriptTemplate::instantiate(const Values& values, Bytes& out) const {
+    if (values.owner_ != this) {
+        throw IllegalArgumentException("Values were created for a different template");
+    }
+
+    size_t size = code_.size();
+    for (size_t i = 0; i < slots_.size(); ++i) {
+        if (!values.values_[i].isSet) {
+            throw IllegalStateException("Template slot '" + slots_[i].name + "' has no value");
+        }
+    }
+    for (const auto& segment : segments_) {
+        if (segment.slot == NO_SLOT) {
+            continue;
+        }
+        const auto& value = values.values_[segment.slot];
+        switch (slots_[segment.slot].type) {
+            case SlotType::BOOLEAN:
+                size += 1;
+                break;
+            case SlotType::INTEGER:
+                size += integerSize(value.integer);
+                break;
+            case SlotType::HASH160:
+                size += HASH160_PUSH_SIZE;
+                break;
+            case SlotType::HASH256:
+                size += HASH256_PUSH_SIZE;
+                break;
+            case SlotType::PUBLIC_KEY:
+                size += PUBLIC_KEY_PUSH_SIZE;
+                break;
+            case SlotType::BYTE_ARRAY:
+            case SlotType::STRING:
+                size += dataSize(value.bytes.size());
+                break;
+        }
+    }
+
+    out.resize(size);
+    uint8_t* cursor = out.data();
+    for (const auto& segment : segments_) {
+        if (segment.length > 0) {
+            std::memcpy(cursor, code_.data() + segment.offset, segment.length);
+            cursor += segment.length;
+        }
+        if (segment.slot == NO_SLOT) {
+            continue;
+        }
+
+        const auto& value = values.values_[segment.slot];
+        switch (slots_[segment.slot].type) {
+            case SlotType::BOOLEAN:
+                *cursor++ = opcode(!value.integer.isZero() ? OpCode::PUSH1 : OpCode::PUSH0);
+                break;
+            case SlotType::INTEGER:
+                cursor = writeInteger(cursor, value.integer);
+                break;
+            case SlotType::HASH160:
+                cursor = writeData(cursor, value.fixed.data(), NeoConstants::HASH160_SIZE);
+                break;
+            case SlotType::HASH256:
+                cursor = writeData(cursor, value.fixed.data(), NeoConstants::HASH256_SIZE);
+                break;
+            case SlotType::PUBLIC_KEY:
+                cursor = writeData(cursor, value.fixed.data(), NeoConstants::PUBLIC_KEY_SIZE_COMPRESSED);
+                break;
+            case SlotType::BYTE_ARRAY:
+            case SlotType::STRING:
+                cursor = writeData(cursor, value.bytes.data(), value.bytes.size());
+                break;
+        }
+    }
+}
+
+Bytes ScriptTemplate::instantiate(const Values& values) const {
+    Bytes out;
+    instantiate(values, out);
+    return out;
+}
+
+void ScriptTemplate::appendConstant(const uint8_t* data, size_t length) {
+    if (length == 0) {
+        return;
+    }
+    // Extend the trailing constant run unless a slot closes it
+    if (segments_.empty() || segments_.back().slot != NO_SLOT) {
+        segments_.push_back({code_.size(), 0, NO_SLOT});
+    }
+    code_.insert(code_.end(), data, data + length);
+    segments_.back().length += length;
+}
+
+void ScriptTemplate::appendSlot(size_t slot) {
+    if (segments_.empty() || segments_.back().slot != NO_SLOT) {
+        segments_.push_back({code_.size(), 0, slot});
+    } else {
+        segments_.back().slot = slot;
+    }
+}
+
+size_t ScriptTemplate::declareSlot(const std::string& name, SlotType type) {
+    if (name.empty()) {
+        throw IllegalArgumentException("Template slot name must not be empty");
+    }
+    for (size_t i = 0; i < slots_.size(); ++i) {
+        if (slots_[i].name == name) {
+            if (slots_[i].type != type) {
+                throw IllegalArgumentException("Template slot '" + name + "' is already declared with another type");
+            }
+            return i;
+        }
+    }
+    slots_.push_back({name, type});
+    return slots_.size() - 1;
+}
+
+void ScriptTemplate::pushArgument(const Argument& argument) {
+    switch (argument.kind_) {
+        case Argument::Kind::CONSTANT:
+            push(argument.value_);
+            break;
+        case Argument::Kind::NULL_VALUE:
+            emit(OpCode::PUSHNULL);
+            break;
+        case Argument::Kind::SLOT:
+            pushSlot(argument.slotName_, argument.slotType_);
+            break;
+    }
+}
+
+} // namespace neocpp
@@ -7,7 +7,7 @@
 namespace neocpp {
 
 BinaryReader::BinaryReader(const Bytes& data)
-    : data_(nullptr), size_(0), position_(0) {
+    : data_(nullptr), size_(0), position_(0), borrowed_(false) {
     // Copy data to owned storage to avoid dangling pointer issues with temporaries
     ownedData_ = data;
     data_ = ownedData_.data();
@@ -15,17 +15,25 @@ BinaryReader::BinaryReader(const Bytes& data)
 }
 
 BinaryReader::BinaryReader(const uint8_t* data, size_t size)
-    : data_(data), size_(size), position_(0) {
+    : data_(data), size_(size), position_(0), borrowed_(true) {
 }
 
 BinaryReader::BinaryReader(std::istream& stream)
-    : data_(nullptr), size_(0), position_(0) {
+    : data_(nullptr), size_(0), position_(0), borrowed_(false) {
     // Read all data from stream
     ownedData_.assign(std::istreambuf_iterator<char>(stream),
                       std::istreambuf_iterator<char>());
     data_ = ownedData_.data();
     size_ = ownedData_.size();
 } // namespace neocpp
+void BinaryReader::ensureAvailable(size_t count) const {
+    if (count > size_ - position_) {
+        throw DeserializationException("Attempted to read beyond end of data");
+    }
+} // namespace neocpp
+BinaryReader BinaryReader::borrow(ByteView data) {
+    return BinaryReader(data.data(), data.size());
+} // namespace neocpp
 uint8_t BinaryReader::readByte() {
     if (position_ >= size_) {
         throw DeserializationException("Attempted to read beyond end of data");
@@ -36,20 +44,22 @@ bool BinaryReader::readBool() {
     return readByte() != 0;
 } // namespace neocpp
 Bytes BinaryReader::readBytes(size_t count) {
-    if (position_ + count > size_) {
-        throw DeserializationException("Attempted to read beyond end of data");
-    }
+    ensureAvailable(count);
     Bytes result(data_ + position_, data_ + position_ + count);
     position_ += count;
     return result;
 } // namespace neocpp
 void BinaryReader::readBytes(uint8_t* buffer, size_t count) {
-    if (position_ + count > size_) {
-        throw DeserializationException("Attempted to read beyond end of data");
-    }
+    ensureAvailable(count);
     std::memcpy(buffer, data_ + position_, count);
     position_ += count;
 } // namespace neocpp
+ByteView BinaryReader::readBytesView(size_t count) {
+    ensureAvailable(count);
+    ByteView result(data_ + position_, count);
+    position_ += count;
+    return result;
+} // namespace neocpp
 int8_t BinaryReader::readInt8() {
     return static_cast<int8_t>(readByte());
 } // namespace neocpp
@@ -57,42 +67,22 @@ uint8_t BinaryReader::readUInt8() {
     return readByte();
 } // namespace neocpp
 int16_t BinaryReader::readInt16() {
-    uint8_t b0 = readByte();
-    uint8_t b1 = readByte();
-    return static_cast<int16_t>(b0 | (b1 << 8));
+    return readLittleEndian<int16_t>();
 } // namespace neocpp
 uint16_t BinaryReader::readUInt16() {
-    uint8_t b0 = readByte();
-    uint8_t b1 = readByte();
-    return static_cast<uint16_t>(b0 | (b1 << 8));
+    return readLittleEndian<uint16_t>();
 } // namespace neocpp
 int32_t BinaryReader::readInt32() {
-    uint8_t b0 = readByte();
-    uint8_t b1 = readByte();
-    uint8_t b2 = readByte();
-    uint8_t b3 = readByte();
-    return static_cast<int32_t>(b0 | (b1 << 8) | (b2 << 16) | (b3 << 24));
+    return readLittleEndian<int32_t>();
 } // namespace neocpp
 uint32_t BinaryReader::readUInt32() {
-    uint8_t b0 = readByte();
-    uint8_t b1 = readByte();
-    uint8_t b2 = readByte();
-    uint8_t b3 = readByte();
-    return static_cast<uint32_t>(b0 | (b1 << 8) | (b2 << 16) | (b3 << 24));
+    return readLittleEndian<uint32_t>();
 } // namespace neocpp
 int64_t BinaryReader::readInt64() {
-    int64_t result = 0;
-    for (int i = 0; i < 8; ++i) {
-        result |= static_cast<int64_t>(readByte()) << (i * 8);
-    }
-    return result;
+    return readLittleEndian<int64_t>();
 } // namespace neocpp
 uint64_t BinaryReader::readUInt64() {
-    uint64_t result = 0;
-    for (int i = 0; i < 8; ++i) {
-        result |= static_cast<uint64_t>(readByte()) << (i * 8);
-    }
-    return result;
+    return readLittleEndian<uint64_t>();
 } // namespace neocpp
 uint64_t BinaryReader::readVarInt() {
     uint8_t first = readByte();
@@ -125,13 +115,23 @@ Bytes BinaryReader::readVarBytes() {
     }
     return readBytes(static_cast<size_t>(length));
 } // namespace neocpp
+ByteView BinaryReader::readVarBytesView() {
+    uint64_t length = readVarInt();
+    if (length > size_ - position_) {
+        throw DeserializationException("Attempted to read beyond end of data");
+    }
+    return readBytesView(static_cast<size_t>(length));
+} // namespace neocpp
 std::string BinaryReader::readVarString() {
     uint64_t length = readVarInt();
-    Bytes bytes = readBytes(static_cast<size_t>(length));
+    if (length > size_ - position_) {
+        throw DeserializationException("Attempted to read beyond end of data");
+    }
+    ByteView bytes = readBytesView(static_cast<size_t>(length));
     return std::string(bytes.begin(), bytes.end());
 } // namespace neocpp
 std::string BinaryReader::readFixedString(size_t length) {
-    Bytes bytes = readBytes(length);
+    ByteView bytes = readBytesView(length);
     // Find null terminator if present
     auto nullPos = std::find(bytes.begin(), bytes.end(), 0);
     if (nullPos != bytes.end()) {
@@ -35,48 +35,45 @@ void BinaryWriter::writeUInt8(uint8_t value) {
     writeByte(value);
 } // namespace neocpp
 void BinaryWriter::writeInt16(int16_t value) {
-    writeByte(value & 0xFF);
-    writeByte((value >> 8) & 0xFF);
+    writeLittleEndian(value);
 } // namespace neocpp
 void BinaryWriter::writeUInt16(uint16_t value) {
-    writeByte(value & 0xFF);
-    writeByte((value >> 8) & 0xFF);
+    writeLittleEndian(value);
 } // namespace neocpp
 void BinaryWriter::writeInt32(int32_t value) {
-    writeByte(value & 0xFF);
-    writeByte((value >> 8) & 0xFF);
-    writeByte((value >> 16) & 0xFF);
-    writeByte((value >> 24) & 0xFF);
+    writeLittleEndian(value);
 } // namespace neocpp
 void BinaryWriter::writeUInt32(uint32_t value) {
-    writeByte(value & 0xFF);
-    writeByte((value >> 8) & 0xFF);
-    writeByte((value >> 16) & 0xFF);
-    writeByte((value >> 24) & 0xFF);
+    writeLittleEndian(value);
 } // namespace neocpp
 void BinaryWriter::writeInt64(int64_t value) {
-    for (int i = 0; i < 8; ++i) {
-        writeByte((value >> (i * 8)) & 0xFF);
-    }
+    writeLittleEndian(value);
 } // namespace neocpp
 void BinaryWriter::writeUInt64(uint64_t value) {
-    for (int i = 0; i < 8; ++i) {
-        writeByte((value >> (i * 8)) & 0xFF);
-    }
+    writeLittleEndian(value);
 } // namespace neocpp
 void BinaryWriter::writeVarInt(uint64_t value) {
     if (value < 0xFD) {
         writeByte(static_cast<uint8_t>(value));
-    } else if (value <= 0xFFFF) {
-        writeByte(0xFD);
-        writeUInt16(static_cast<uint16_t>(value));
+        return;
+    }
+    // Prefix and value go out together
+    uint8_t bytes[9];
+    size_t length;
+    if (value <= 0xFFFF) {
+        bytes[0] = 0xFD;
+        LittleEndian::store(bytes + 1, static_cast<uint16_t>(value));
+        length = 3;
     } else if (value <= 0xFFFFFFFF) {
-        writeByte(0xFE);
-        writeUInt32(static_cast<uint32_t>(value));
+        bytes[0] = 0xFE;
+        LittleEndian::store(bytes + 1, static_cast<uint32_t>(value));
+        length = 5;
     } else {
-        writeByte(0xFF);
-        writeUInt64(value);
+        bytes[0] = 0xFF;
+        LittleEndian::store(bytes + 1, value);
+        length = 9;
     }
+    writeBytes(bytes, length);
 } // namespace neocpp
 void BinaryWriter::writeVarBytes(const Bytes& bytes) {
     writeVarInt(bytes.size());
@@ -91,8 +88,9 @@ void BinaryWriter::writeFixedString(const std::string& str, size_t length) {
     writeBytes(reinterpret_cast<const uint8_t*>(str.data()), writeLength);
 
     // Pad with zeros if necessary
-    for (size_t i = writeLength; i < length; ++i) {
-        writeByte(0);
+    if (writeLength < length) {
+        Bytes padding(length - writeLength, 0);
+        writeBytes(padding);
     }
 } // namespace neocpp
 } // namespace neocpp
@@ -6,6 +6,7 @@ namespace neocpp {
 
 Bytes NeoSerializable::toArray() const {
     BinaryWriter writer;
+    writer.reserve(getSize());
     serialize(writer);
     return writer.toArray();
 } // namespace neocpp
@@ -1,14 +1,14 @@
-
 #include "neocpp/transaction/contract_parameters_context.hpp"
 #include "neocpp/transaction/transaction.hpp"
 #include "neocpp/transaction/witness.hpp"
 #include "neocpp/transaction/signer.hpp"
+#include "neocpp/transaction/network_fee_calculator.hpp"
 #include "neocpp/wallet/account.hpp"
 #include "neocpp/crypto/ec_key_pair.hpp"
+#include "neocpp/crypto/ecdsa_signature.hpp"
 #include "neocpp/script/script_builder.hpp"
-#include "neocpp/script/op_code.hpp"
-#include "neocpp/crypto/hash.hpp"
 #include "neocpp/utils/hex.hpp"
+#include "neocpp/utils/parallel.hpp"
 #include "neocpp/exceptions.hpp"
 #include "neocpp/serialization/binary_writer.hpp"
 #include "neocpp/serialization/binary_reader.hpp"
@@ -22,35 +22,168 @@ ContractParametersContext::ContractParametersContext(const SharedPtr<Transaction
         throw IllegalArgumentException("Transaction cannot be null");
     }
 
-    // Initialize verification scripts from signers
+    // Initialize items from signers. Scripts are set when an account signs
+    // or via setVerificationScript.
     for (const auto& signer : transaction->getSigners()) {
-        // Initialize with empty script - will be populated when account signs
-        // or can be manually set via setVerificationScript method
-        verificationScripts_[signer->getAccount()] = Bytes();
+        items_[signer->getAccount()];
+    }
+} // namespace neocpp
+void ContractParametersContext::setVerificationScript(const Bytes& script) {
+    Hash160 scriptHash = Hash160::fromScript(script);
+    if (items_.find(scriptHash) == items_.end()) {
+        throw IllegalArgumentException("Verification script does not belong to a signer: " + scriptHash.toString());
     }
+    setVerificationScript(scriptHash, script);
+} // namespace neocpp
+void ContractParametersContext::setVerificationScript(const Hash160& scriptHash, const Bytes& script) {
+    parseVerificationScript(items_[scriptHash], script);
+} // namespace neocpp
+void ContractParametersContext::parseVerificationScript(Item& item, const Bytes& script) {
+    item.verificationScript = script;
+    item.signingThreshold = 1;
+    item.publicKeys.clear();
+
+    Bytes publicKey;
+    if (NetworkFeeCalculator::isSignatureContract(script, publicKey)) {
+        item.publicKeys.push_back(std::move(publicKey));
+    } else {
+        NetworkFeeCalculator::isMultiSigContract(script, item.signingThreshold, item.publicKeys);
+    }
+} // namespace neocpp
+void ContractParametersContext::loadVerificationScript(const Hash160& scriptHash, const Bytes& script) {
+    if (items_.find(scriptHash) == items_.end()) {
+        throw DeserializationException("Verification script for a script hash that is not a signer: " +
+                                       scriptHash.toString());
+    }
+    if (Hash160::fromScript(script) != scriptHash) {
+        throw DeserializationException("Verification script does not match its script hash " + scriptHash.toString());
+    }
+    setVerificationScript(scriptHash, script);
 } // namespace neocpp
 void ContractParametersContext::addSignature(const SharedPtr<Account>& account, const Bytes& signature) {
     auto scriptHash = account->getScriptHash();
     auto publicKey = account->getKeyPair()->getPublicKey()->getEncoded();
 
+    // Store verification script if not already stored; accounts that are not signers are rejected below
+    auto it = items_.find(scriptHash);
+    if (it != items_.end() && it->second.verificationScript.empty()) {
+        setVerificationScript(scriptHash, account->getVerificationScript());
+    }
+
     addSignature(scriptHash, publicKey, signature);
+} // namespace neocpp
+bool ContractParametersContext::addSignature(const Hash160& scriptHash, const Bytes& publicKey, const Bytes& signature) {
+    return addSignatures({PendingSignature{scriptHash, publicKey, signature}}) == 1;
+} // namespace neocpp
+size_t ContractParametersContext::addSignatures(const std::vector<PendingSignature>& signatures) {
+    return addSignatures(signatures, {});
+} // namespace neocpp
+size_t ContractParametersContext::addSignatures(const std::vector<PendingSignature>& signatures,
+                                                const std::map<Hash160, Item>& scripts) {
+    // Verify everything first so a bad signature leaves the context unchanged
+    Bytes hash = transaction_->getHash().toArray();
+    Parallel::forChunks(signatures.size(), threads_, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            verifySignature(signatures[i], hash, scripts);
+        }
+    });
 
-    // Store verification script if not already stored
-    if (verificationScripts_[scriptHash].empty()) {
-        verificationScripts_[scriptHash] = account->getVerificationScript();
-        parseVerificationScript(scriptHash, account->getVerificationScript());
+    for (const auto& [scriptHash, script] : scripts) {
+        auto& item = items_.at(scriptHash);
+        item.verificationScript = script.verificationScript;
+        item.signingThreshold = script.signingThreshold;
+        item.publicKeys = script.publicKeys;
     }
+
+    size_t added = 0;
+    for (const auto& pending : signatures) {
+        auto& item = items_.at(pending.scriptHash);
+        if (item.verificationScript.empty()) {
+            setVerificationScript(pending.scriptHash, ScriptBuilder::buildVerificationScript(pending.publicKey));
+        }
+        if (item.signatures.emplace(pending.publicKey, pending.signature).second) {
+            ++added;
+        }
+    }
+    return added;
 } // namespace neocpp
-void ContractParametersContext::addSignature(const Hash160& scriptHash, const Bytes& publicKey, const Bytes& signature) {
-    // Add signature to the collection
-    signatures_[scriptHash].push_back(signature);
+void ContractParametersContext::verifySignature(const PendingSignature& pending, const Bytes& hash,
+                                                const std::map<Hash160, Item>& scripts) const {
+    auto it = items_.find(pending.scriptHash);
+    if (it == items_.end()) {
+        throw IllegalArgumentException("Script hash is not a signer: " + pending.scriptHash.toString());
+    }
+
+    auto script = scripts.find(pending.scriptHash);
+    const Item& item = script != scripts.end() ? script->second : it->second;
+    if (item.verificationScript.empty()) {
+        // Without a script only the signer's own single-sig key can be accepted
+        if (Hash160::fromPublicKey(pending.publicKey) != pending.scriptHash) {
+            throw IllegalArgumentException("No verification script for " + pending.scriptHash.toString());
+        }
+    } else if (!item.publicKeys.empty() &&
+               std::find(item.publicKeys.begin(), item.publicKeys.end(), pending.publicKey) == item.publicKeys.end()) {
+        throw IllegalArgumentException("Public key is not part of the verification script of " +
+                                       pending.scriptHash.toString());
+    }
+
+    bool valid = false;
+    try {
+        ECPublicKey publicKey(pending.publicKey);
+        valid = publicKey.verifyHash(hash, std::make_shared<ECDSASignature>(pending.signature));
+    } catch (const std::exception&) {
+        valid = false;
+    }
+    if (!valid) {
+        throw IllegalArgumentException("Invalid signature for " + pending.scriptHash.toString());
+    }
 } // namespace neocpp
 bool ContractParametersContext::sign(const SharedPtr<Account>& account) {
-    auto txHash = transaction_->getHash();
-    auto signature = account->sign(txHash.toArray());
+    auto scriptHash = account->getScriptHash();
+    auto publicKey = account->getKeyPair()->getPublicKey()->getEncoded();
 
-    addSignature(account, signature);
-    return true;
+    auto own = items_.find(scriptHash);
+    if (own != items_.end() && own->second.verificationScript.empty()) {
+        setVerificationScript(scriptHash, account->getVerificationScript());
+    }
+
+    // Sign once, then add the signature to every script that lists the key
+    Bytes signature;
+    bool added = false;
+    for (auto& [hash, item] : items_) {
+        if (std::find(item.publicKeys.begin(), item.publicKeys.end(), publicKey) == item.publicKeys.end() ||
+            item.signatures.count(publicKey) != 0) {
+            continue;
+        }
+        if (signature.empty()) {
+            signature = account->signHash(transaction_->getHash().toArray());
+        }
+        item.signatures.emplace(publicKey, signature);
+        added = true;
+    }
+    return added;
+} // namespace neocpp
+size_t ContractParametersContext::merge(const ContractParametersContext& other) {
+    if (other.transaction_->getHash() != transaction_->getHash()) {
+        throw IllegalArgumentException("Cannot merge contexts for different transactions");
+    }
+
+    // Collect the other side's scripts and signatures without touching this context, so
+    // a signature that does not verify leaves it unchanged
+    std::map<Hash160, Item> scripts;
+    std::vector<PendingSignature> pending;
+    for (const auto& [scriptHash, otherItem] : other.items_) {
+        auto it = items_.find(scriptHash);
+        if (it != items_.end() && it->second.verificationScript.empty() && !otherItem.verificationScript.empty()) {
+            parseVerificationScript(scripts[scriptHash], otherItem.verificationScript);
+        }
+        for (const auto& [publicKey, signature] : otherItem.signatures) {
+            if (it == items_.end() || it->second.signatures.count(publicKey) == 0) {
+                pending.push_back(PendingSignature{scriptHash, publicKey, signature});
+            }
+        }
+    }
+    return addSignatures(pending, scripts);
 } // namespace neocpp
 bool ContractParametersContext::isComplete() const {
     for (const auto& signer : transaction_->getSigners()) {
@@ -78,22 +211,33 @@ std::vector<SharedPtr<Witness>> ContractParametersContext::getWitnesses() const
     return witnesses;
 } // namespace neocpp
 SharedPtr<Witness> ContractParametersContext::getWitness(const Hash160& scriptHash) const {
-    auto sigIt = signatures_.find(scriptHash);
-    auto scriptIt = verificationScripts_.find(scriptHash);
-
-    if (sigIt == signatures_.end() || scriptIt == verificationScripts_.end()) {
+    auto it = items_.find(scriptHash);
+    if (it == items_.end() || it->second.signatures.empty()) {
         return nullptr;
     }
+    const Item& item = it->second;
 
-    // Build invocation script
-    ScriptBuilder builder;
-    for (const auto& sig : sigIt->second) {
-        builder.pushData(sig);
+    // CheckMultisig walks keys and signatures in step, so signatures follow key order in the script
+    std::vector<Bytes> signatures;
+    if (item.publicKeys.empty()) {
+        for (const auto& [publicKey, signature] : item.signatures) {
+            signatures.push_back(signature);
+        }
+    } else {
+        for (const auto& publicKey : item.publicKeys) {
+            auto sig = item.signatures.find(publicKey);
+            if (sig != item.signatures.end()) {
+                signatures.push_back(sig->second);
+                if (static_cast<int>(signatures.size()) == item.signingThreshold) {
+                    break;
+                }
+            }
+        }
     }
 
     auto witness = std::make_shared<Witness>();
-    witness->setInvocationScript(builder.toArray());
-    witness->setVerificationScript(scriptIt->second);
+    witness->setInvocationScript(ScriptBuilder::buildInvocationScript(signatures));
+    witness->setVerificationScript(item.verificationScript);
 
     return witness;
 } // namespace neocpp
@@ -101,26 +245,20 @@ nlohmann::json ContractParametersContext::toJson() const {
     nlohmann::json json;
 
     // Serialize transaction to bytes then encode to hex
-    BinaryWriter writer;
-    transaction_->serialize(writer);
-    json["transaction"] = Hex::encode(writer.toArray());
+    json["transaction"] = Hex::encode(transaction_->getBytes());
 
-    // Serialize signatures
-    nlohmann::json sigs;
-    for (const auto& [scriptHash, signatures] : signatures_) {
-        nlohmann::json sigArray;
-        for (const auto& sig : signatures) {
-            sigArray.push_back(Hex::encode(sig));
+    // Serialize signatures keyed by public key, and verification scripts
+    nlohmann::json sigs = nlohmann::json::object();
+    nlohmann::json scripts = nlohmann::json::object();
+    for (const auto& [scriptHash, item] : items_) {
+        nlohmann::json keyed = nlohmann::json::object();
+        for (const auto& [publicKey, signature] : item.signatures) {
+            keyed[Hex::encode(publicKey)] = Hex::encode(signature);
         }
-        sigs[scriptHash.toString()] = sigArray;
+        sigs[scriptHash.toString()] = keyed;
+        scripts[scriptHash.toString()] = Hex::encode(item.verificationScript);
     }
     json["signatures"] = sigs;
-
-    // Serialize verification scripts
-    nlohmann::json scripts;
-    for (const auto& [scriptHash, script] : verificationScripts_) {
-        scripts[scriptHash.toString()] = Hex::encode(script);
-    }
     json["verificationScripts"] = scripts;
 
     return json;
@@ -134,106 +272,115 @@ SharedPtr<ContractParametersContext> ContractParametersContext::fromJson(const n
 
     auto context = std::make_shared<ContractParametersContext>(transaction);
 
-    // Deserialize signatures
-    if (json.contains("signatures")) {
-        for (const auto& [hashStr, sigArray] : json["signatures"].items()) {
-            Hash160 scriptHash(hashStr);
-            for (const auto& sigHex : sigArray) {
-                auto sig = Hex::decode(sigHex.get<std::string>());
-                context->signatures_[scriptHash].push_back(sig);
+    // Deserialize verification scripts first so signatures can be checked against them
+    if (json.contains("verificationScripts")) {
+        for (const auto& [hashStr, scriptHex] : json["verificationScripts"].items()) {
+            auto script = Hex::decode(scriptHex.get<std::string>());
+            if (!script.empty()) {
+                context->loadVerificationScript(Hash160(hashStr), script);
             }
         }
     }
 
-    // Deserialize verification scripts
-    if (json.contains("verificationScripts")) {
-        for (const auto& [hashStr, scriptHex] : json["verificationScripts"].items()) {
+    // Deserialize signatures
+    std::vector<PendingSignature> pending;
+    if (json.contains("signatures")) {
+        Bytes hash = transaction->getHash().toArray();
+        for (const auto& [hashStr, sigs] : json["signatures"].items()) {
             Hash160 scriptHash(hashStr);
-            auto script = Hex::decode(scriptHex.get<std::string>());
-            context->verificationScripts_[scriptHash] = script;
+            if (sigs.is_object()) {
+                for (const auto& [keyHex, sigHex] : sigs.items()) {
+                    pending.push_back(PendingSignature{scriptHash, Hex::decode(keyHex), Hex::decode(sigHex.get<std::string>())});
+                }
+                continue;
+            }
+
+            // Older exports list bare signatures; attribute each to the script key it verifies against
+            auto it = context->items_.find(scriptHash);
+            for (const auto& sigHex : sigs) {
+                PendingSignature candidate{scriptHash, Bytes(), Hex::decode(sigHex.get<std::string>())};
+                if (it != context->items_.end()) {
+                    for (const auto& publicKey : it->second.publicKeys) {
+                        candidate.publicKey = publicKey;
+                        try {
+                            context->verifySignature(candidate, hash);
+                            break;
+                        } catch (const IllegalArgumentException&) {
+                            candidate.publicKey.clear();
+                        }
+                    }
+                }
+                if (candidate.publicKey.empty()) {
+                    throw IllegalArgumentException("Invalid signature for " + hashStr);
+                }
+                pending.push_back(std::move(candidate));
+            }
         }
     }
+    context->addSignatures(pending);
 
     return context;
 } // namespace neocpp
-void ContractParametersContext::parseVerificationScript(const Hash160& scriptHash, const Bytes& script) {
-    // Parse verification script to determine if single-sig or multi-sig
+Bytes ContractParametersContext::toArray() const {
+    BinaryWriter writer;
+    writer.writeUInt8(BINARY_FORMAT_VERSION);
+    writer.writeBytes(transaction_->getBytes());
 
-    if (script.empty()) {
-        return;
+    writer.writeVarInt(items_.size());
+    for (const auto& [scriptHash, item] : items_) {
+        scriptHash.serialize(writer);
+        writer.writeVarBytes(item.verificationScript);
+        writer.writeVarInt(item.signatures.size());
+        for (const auto& [publicKey, signature] : item.signatures) {
+            writer.writeVarBytes(publicKey);
+            writer.writeVarBytes(signature);
+        }
     }
-
-    size_t pos = 0;
-
-    // Check for standard single-sig pattern:
-    // PUSH21 (0x21) + 33 bytes pubkey + SYSCALL (0x41) + 4 bytes interop hash
-    if (script.size() >= 40 && script[0] == 0x21 && script[34] == 0x41) {
-        // Single-sig verification script
-        scriptInfo_[scriptHash] = {1, 1}; // m=1, n=1
-        return;
+    return writer.toArray();
+} // namespace neocpp
+SharedPtr<ContractParametersContext> ContractParametersContext::fromArray(const Bytes& data) {
+    BinaryReader reader(data);
+    if (reader.readUInt8() != BINARY_FORMAT_VERSION) {
+        throw DeserializationException("Unsupported contract parameters context version");
     }
 
-    // Check for multi-sig pattern:
-    // PUSH<m> + PUSH21 <pubkey1> + ... + PUSH21 <pubkeyn> + PUSH<n> + SYSCALL
-    if (script.size() > 40) {
-        // First byte should be PUSH1-PUSH16 for m value
-        if (script[pos] >= 0x11 && script[pos] <= 0x20) {
-            int m = script[pos] - 0x10; // m value (required signatures)
-            pos++;
-
-            // Count public keys
-            int pubkeyCount = 0;
-            while (pos < script.size() - 6) { // Need at least 6 bytes for PUSH<n> + SYSCALL
-                if (script[pos] == 0x21) { // PUSH21 (33 bytes)
-                    pos += 34; // Skip opcode + 33 bytes
-                    pubkeyCount++;
-                } else {
-                    break;
-                }
-            }
+    auto context = std::make_shared<ContractParametersContext>(Transaction::deserialize(reader));
 
-            // Check for PUSH<n> and SYSCALL
-            if (pos < script.size() - 5 &&
-                script[pos] >= 0x11 && script[pos] <= 0x20 &&
-                script[pos + 1] == 0x41) {
-                int n = script[pos] - 0x10; // n value (total keys)
+    std::vector<PendingSignature> pending;
+    uint64_t itemCount = reader.readVarInt();
+    for (uint64_t i = 0; i < itemCount; ++i) {
+        Hash160 scriptHash = Hash160::deserialize(reader);
+        Bytes script = reader.readVarBytes();
+        if (!script.empty()) {
+            context->loadVerificationScript(scriptHash, script);
+        }
 
-                if (pubkeyCount == n && m <= n) {
-                    // Valid multi-sig script
-                    scriptInfo_[scriptHash] = {m, n};
-                    return;
-                }
-            }
+        uint64_t signatureCount = reader.readVarInt();
+        if (signatureCount > NeoConstants::MAX_PUBLIC_KEYS_PER_MULTISIG_ACCOUNT) {
+            throw DeserializationException("Too many signatures for " + scriptHash.toString());
         }
+        for (uint64_t j = 0; j < signatureCount; ++j) {
+            Bytes publicKey = reader.readVarBytes();
+            Bytes signature = reader.readVarBytes();
+            pending.push_back(PendingSignature{scriptHash, std::move(publicKey), std::move(signature)});
+        }
+    }
+    if (reader.hasMore()) {
+        throw DeserializationException("Unexpected data after contract parameters context");
     }
 
-    // Default to single-sig if pattern not recognized
-    scriptInfo_[scriptHash] = {1, 1};
+    context->addSignatures(pending);
+    return context;
 } // namespace neocpp
 int ContractParametersContext::getRequiredSignatures(const Hash160& scriptHash) const {
-    // Parse verification script to determine required signatures
-    auto it = scriptInfo_.find(scriptHash);
-    if (it != scriptInfo_.end()) {
-        return it->second.first; // Return m value
-    }
-
-    // If not parsed yet, try to parse from stored script
-    auto scriptIt = verificationScripts_.find(scriptHash);
-    if (scriptIt != verificationScripts_.end()) {
-        const_cast<ContractParametersContext*>(this)->parseVerificationScript(scriptHash, scriptIt->second);
-        auto infoIt = scriptInfo_.find(scriptHash);
-        if (infoIt != scriptInfo_.end()) {
-            return infoIt->second.first;
-        }
-    }
-
-    return 1; // Default to single-sig
+    auto it = items_.find(scriptHash);
+    return it != items_.end() ? it->second.signingThreshold : 1;
 } // namespace neocpp
 int ContractParametersContext::getCollectedSignatures(const Hash160& scriptHash) const {
-    auto it = signatures_.find(scriptHash);
-    if (it == signatures_.end()) {
+    auto it = items_.find(scriptHash);
+    if (it == items_.end()) {
         return 0;
     }
-    return static_cast<int>(it->second.size());
+    return static_cast<int>(it->second.signatures.size());
 } // namespace neocpp
 } // namespace neocpp
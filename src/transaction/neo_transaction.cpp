@@ -41,7 +41,20 @@ Bytes NeoTransaction::getHash() const {
     return hash;
 } // namespace neocpp
 Bytes NeoTransaction::serializeWithoutWitnesses() const {
+    // version + nonce + system fee + network fee + valid until block
+    size_t size = 1 + 4 + 8 + 8 + 4;
+    size += BinaryWriter::getVarSize(signers_.size());
+    for (const auto& signer : signers_) {
+        size += signer.getSize();
+    }
+    size += BinaryWriter::getVarSize(attributes_.size());
+    for (const auto& attribute : attributes_) {
+        size += attribute.getSize();
+    }
+    size += BinaryWriter::getVarSize(script_.size()) + script_.size();
+
     BinaryWriter writer;
+    writer.reserve(size);
 
     // Write version byte
     writer.writeByte(version_);
@@ -76,10 +89,15 @@ Bytes NeoTransaction::serializeWithoutWitnesses() const {
     return writer.toArray();
 } // namespace neocpp
 Bytes NeoTransaction::serialize() const {
-    BinaryWriter writer;
-
     // First serialize everything except witnesses
     Bytes withoutWitnesses = serializeWithoutWitnesses();
+    size_t size = withoutWitnesses.size() + BinaryWriter::getVarSize(witnesses_.size());
+    for (const auto& witness : witnesses_) {
+        size += witness.getSize();
+    }
+
+    BinaryWriter writer;
+    writer.reserve(size);
     writer.writeBytes(withoutWitnesses);
 
     // Then add witnesses
@@ -0,0 +1,272 @@
+#include "neocpp/transaction/nep17_payout_planner.hpp"
+#include "neocpp/transaction/transaction.hpp"
+#include "neocpp/transaction/transaction_builder.hpp"
+#include "neocpp/transaction/network_fee_calculator.hpp"
+#include "neocpp/transaction/signer.hpp"
+#include "neocpp/transaction/witness.hpp"
+#include "neocpp/protocol/neo_rpc_client.hpp"
+#include "neocpp/protocol/chain_state_cache.hpp"
+#include "neocpp/protocol/response_types_impl.hpp"
+#include "neocpp/script/script_builder.hpp"
+#include "neocpp/serialization/binary_writer.hpp"
+#include "neocpp/types/contract_parameter.hpp"
+#include "neocpp/wallet/account.hpp"
+#include "neocpp/utils/parallel.hpp"
+#include "neocpp/exceptions.hpp"
+#include <algorithm>
+#include <future>
+#include <random>
+
+namespace neocpp {
+
+Nep17PayoutPlanner::Nep17PayoutPlanner(const SharedPtr<NeoRpcClient>& client, const SharedPtr<Account>& sender)
+    : client_(client), sender_(sender) {
+    if (!client_) {
+        throw IllegalArgumentException("RPC client must not be null");
+    }
+    if (!sender_ || !sender_->getKeyPair()) {
+        throw IllegalArgumentException("Payout sender must be an account with a private key");
+    }
+
+    using Argument = ScriptTemplate::Argument;
+    transferTemplate_.callContract("token", "transfer", {
+        Argument::constant(ContractParameter::hash160(sender_->getScriptHash())),
+        Argument::slot("to", ScriptTemplate::SlotType::HASH160),
+        Argument::slot("amount", ScriptTemplate::SlotType::INTEGER),
+        Argument::null()
+    }).emit(OpCode::ASSERT);
+    tokenSlot_ = transferTemplate_.getSlotIndex("token");
+    recipientSlot_ = transferTemplate_.getSlotIndex("to");
+    amountSlot_ = transferTemplate_.getSlotIndex("amount");
+}
+
+Nep17PayoutPlanner& Nep17PayoutPlanner::addTransfer(const Hash160& token, const Hash160& recipient, int64_t amount) {
+    if (amount < 0) {
+        throw IllegalArgumentException("Transfer amount must not be negative");
+    }
+    transfers_.push_back({token, recipient, amount});
+    return *this;
+}
+
+Nep17PayoutPlanner& Nep17PayoutPlanner::addTransfer(const Hash160& token, const std::string& recipient, int64_t amount) {
+    return addTransfer(token, Hash160::fromAddress(recipient), amount);
+}
+
+Nep17PayoutPlanner& Nep17PayoutPlanner::addTransfers(const std::vector<Nep17Transfer>& transfers) {
+    transfers_.reserve(transfers_.size() + transfers.size());
+    for (const auto& transfer : transfers) {
+        addTransfer(transfer.token, transfer.recipient, transfer.amount);
+    }
+    return *this;
+}
+
+Nep17PayoutPlanner& Nep17PayoutPlanner::setMaxSystemFee(int64_t fee) {
+    if (fee <= 0) {
+        throw IllegalArgumentException("System fee budget must be positive");
+    }
+    maxSystemFee_ = fee;
+    return *this;
+}
+
+Nep17PayoutPlanner& Nep17PayoutPlanner::setMaxTransactionSize(size_t size) {
+    if (size == 0 || size > static_cast<size_t>(NeoConstants::MAX_TRANSACTION_SIZE)) {
+        throw IllegalArgumentException("Transaction size limit must be between 1 and " +
+                                       std::to_string(NeoConstants::MAX_TRANSACTION_SIZE));
+    }
+    maxTransactionSize_ = size;
+    return *this;
+}
+
+Nep17PayoutPlanner& Nep17PayoutPlanner::setValidUntilBlockIncrement(uint32_t blocks) {
+    if (blocks == 0 || blocks > NeoConstants::MAX_VALID_UNTIL_BLOCK_INCREMENT) {
+        throw IllegalArgumentException("Invalid valid-until-block increment");
+    }
+    validUntilBlockIncrement_ = blocks;
+    return *this;
+}
+
+Nep17PayoutPlanner& Nep17PayoutPlanner::setFirstNonce(uint32_t nonce) {
+    hasFirstNonce_ = true;
+    firstNonce_ = nonce;
+    return *this;
+}
+
+Nep17PayoutPlanner& Nep17PayoutPlanner::setThreads(unsigned int threads) {
+    threads_ = threads;
+    return *this;
+}
+
+void Nep17PayoutPlanner::buildTransferScript(const Nep17Transfer& transfer, ScriptTemplate::Values& values,
+                                             Bytes& out) const {
+    values.setHash160(tokenSlot_, transfer.token)
+          .setHash160(recipientSlot_, transfer.recipient)
+          .setInteger(amountSlot_, transfer.amount);
+    transferTemplate_.instantiate(values, out);
+}
+
+int64_t Nep17PayoutPlanner::simulate(const Bytes& script, const std::string& what) const {
+    auto signer = std::make_shared<Signer>(sender_->getScriptHash(), WitnessScope::CALLED_BY_ENTRY);
+    auto response = client_->invokeScript(script, TransactionBuilder::buildSignersJson({signer}));
+    if (!response) {
+        throw RuntimeException("Failed to invoke script");
+    }
+    if (response->getState() != "HALT") {
+        throw IllegalStateException("Simulated " + what + " did not halt: " +
+                                    (response->hasException() ? response->getException() : response->getState()));
+    }
+    return std::stoll(response->getGasConsumed());
+}
+
+int64_t Nep17PayoutPlanner::getTransferFee(const Hash160& token) {
+    auto cached = transferFees_.find(token);
+    if (cached != transferFees_.end()) {
+        return cached->second;
+    }
+
+    // Price the costliest transfer of the token: the largest amount, to a recipient that has
+    // no balance yet, so the transfer has to create the recipient's storage
+    const Nep17Transfer* largest = nullptr;
+    for (const auto& transfer : transfers_) {
+        if (transfer.token == token && (!largest || transfer.amount > largest->amount)) {
+            largest = &transfer;
+        }
+    }
+    if (!largest) {
+        throw IllegalArgumentException("No transfer of token " + token.toString() + " was added");
+    }
+
+    Bytes freshRecipient(NeoConstants::HASH160_SIZE);
+    std::random_device random;
+    for (auto& byte : freshRecipient) {
+        byte = static_cast<uint8_t>(random());
+    }
+
+    auto values = transferTemplate_.newValues();
+    Bytes script;
+    buildTransferScript({token, Hash160(freshRecipient), largest->amount}, values, script);
+    int64_t fee = simulate(script, "transfer of token " + token.toString());
+    transferFees_[token] = fee;
+    return fee;
+}
+
+std::vector<Nep17PayoutBatch> Nep17PayoutPlanner::plan() {
+    if (transfers_.empty()) {
+        throw IllegalStateException("No transfers to plan");
+    }
+
+    // Chain state and fee templates are independent round trips
+    auto blockCount = std::async(std::launch::async, [this]() {
+        return ChainStateCache::forClient(client_)->getBlockCount();
+    });
+    auto calculator = std::async(std::launch::async, [this]() {
+        return NetworkFeeCalculator::fromClient(client_);
+    });
+
+    std::vector<Hash160> tokens;
+    for (const auto& transfer : transfers_) {
+        if (transferFees_.count(transfer.token) == 0 &&
+            std::find(tokens.begin(), tokens.end(), transfer.token) == tokens.end()) {
+            tokens.push_back(transfer.token);
+        }
+    }
+    for (const auto& token : tokens) {
+        getTransferFee(token);
+    }
+
+    std::vector<Bytes> scripts(transfers_.size());
+    Parallel::forChunks(transfers_.size(), threads_, [&](size_t begin, size_t end) {
+        auto values = transferTemplate_.newValues();
+        for (size_t i = begin; i < end; ++i) {
+            buildTransferScript(transfers_[i], values, scripts[i]);
+        }
+    });
+
+    // Signed size of a transaction is its empty-script size plus the script and the single witness
+    auto signer = std::make_shared<Signer>(sender_->getScriptHash(), WitnessScope::CALLED_BY_ENTRY);
+    Bytes verificationScript = sender_->getVerificationScript();
+    Transaction empty;
+    empty.addSigner(signer);
+    size_t emptySize = empty.getSize() - BinaryWriter::getVarSize(0);
+    size_t witnessSize = Witness(Bytes(NetworkFeeCalculator::invocationScriptSize(verificationScript)),
+                                 verificationScript).getSize();
+    auto signedSize = [&](size_t scriptSize) {
+        return emptySize + BinaryWriter::getVarSize(scriptSize) + scriptSize + witnessSize;
+    };
+
+    std::vector<Nep17PayoutBatch> batches;
+    size_t scriptSize = 0;
+    int64_t systemFee = 0;
+    for (size_t i = 0; i < transfers_.size(); ++i) {
+        int64_t fee = transferFees_[transfers_[i].token];
+        size_t size = scripts[i].size();
+        bool fits = !batches.empty() &&
+                    signedSize(scriptSize + size) <= maxTransactionSize_ &&
+                    systemFee + fee <= maxSystemFee_;
+        if (!fits) {
+            if (signedSize(size) > maxTransactionSize_ || fee > maxSystemFee_) {
+                throw TransactionException("Transfer " + std::to_string(i) + " does not fit in a transaction on its own");
+            }
+            batches.push_back({nullptr, i, 0});
+            scriptSize = 0;
+            systemFee = 0;
+        }
+        ++batches.back().transferCount;
+        scriptSize += size;
+        systemFee += fee;
+    }
+
+    uint32_t validUntilBlock = blockCount.get() + validUntilBlockIncrement_;
+    auto feeCalculator = calculator.get();
+
+    Parallel::forChunks(batches.size(), threads_, [&](size_t begin, size_t end) {
+        for (size_t b = begin; b < end; ++b) {
+            auto& batch = batches[b];
+            Bytes script;
+            int64_t batchSystemFee = 0;
+            for (size_t i = batch.firstTransfer; i < batch.firstTransfer + batch.transferCount; ++i) {
+                script.insert(script.end(), scripts[i].begin(), scripts[i].end());
+                batchSystemFee += transferFees_.at(transfers_[i].token);
+            }
+
+            // The packed script is simulated as a whole, which prices recipients that are
+            // contracts; the fee templates stay a floor for state that changes before inclusion
+            int64_t simulatedFee = simulate(script, "payout transaction " + std::to_string(b));
+            batchSystemFee = std::max(batchSystemFee, simulatedFee);
+            if (batchSystemFee > maxSystemFee_) {
+                throw TransactionException("Payout transaction " + std::to_string(b) + " needs a system fee of " +
+                                           std::to_string(batchSystemFee) + ", over the budget");
+            }
+
+            auto transaction = std::make_shared<Transaction>();
+            transaction->setValidUntilBlock(validUntilBlock);
+            transaction->addSigner(signer);
+            transaction->setScript(script);
+            transaction->setSystemFee(batchSystemFee);
+            transaction->setNetworkFee(feeCalculator->calculate(*transaction, {verificationScript}));
+            batch.transaction = transaction;
+        }
+    });
+
+    uint32_t nonce = hasFirstNonce_ ? firstNonce_ : batches.front().transaction->getNonce();
+    for (auto& batch : batches) {
+        batch.transaction->setNonce(nonce++);
+    }
+    return batches;
+}
+
+void Nep17PayoutPlanner::sign(const std::vector<Nep17PayoutBatch>& batches) const {
+    Parallel::forChunks(batches.size(), threads_, [&](size_t begin, size_t end) {
+        for (size_t b = begin; b < end; ++b) {
+            batches[b].transaction->clearWitnesses();
+            batches[b].transaction->sign(sender_);
+        }
+    });
+}
+
+std::vector<Nep17PayoutBatch> Nep17PayoutPlanner::build() {
+    auto batches = plan();
+    sign(batches);
+    return batches;
+}
+
+} // namespace neocpp
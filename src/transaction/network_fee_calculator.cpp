@@ -0,0 +1,261 @@
+#include "neocpp/transaction/network_fee_calculator.hpp"
+#include "neocpp/transaction/transaction.hpp"
+#include "neocpp/transaction/transaction_attribute.hpp"
+#include "neocpp/protocol/chain_state_cache.hpp"
+#include "neocpp/script/script_builder.hpp"
+#include "neocpp/script/interop_service.hpp"
+#include "neocpp/script/op_code.hpp"
+#include "neocpp/serialization/binary_writer.hpp"
+#include "neocpp/neo_constants.hpp"
+#include "neocpp/exceptions.hpp"
+#include <future>
+
+namespace neocpp {
+
+namespace {
+
+constexpr size_t PUBLIC_KEY_SIZE = 33;
+constexpr size_t SIGNATURE_SIZE = 64;
+
+uint8_t op(OpCode opcode) {
+    return OpCodeHelper::toByte(opcode);
+}
+
+// Reads a push of a compressed public key, in either the short form emitted by
+// ScriptBuilder (length byte + key) or the explicit PUSHDATA1 form.
+bool readPublicKey(const Bytes& script, size_t& pos, Bytes* publicKey = nullptr) {
+    size_t start;
+    if (pos + 1 + PUBLIC_KEY_SIZE <= script.size() && script[pos] == PUBLIC_KEY_SIZE) {
+        start = pos + 1;
+    } else if (pos + 2 + PUBLIC_KEY_SIZE <= script.size() && script[pos] == op(OpCode::PUSHDATA1) &&
+               script[pos + 1] == PUBLIC_KEY_SIZE) {
+        start = pos + 2;
+    } else {
+        return false;
+    }
+    if (publicKey) {
+        publicKey->assign(script.begin() + start, script.begin() + start + PUBLIC_KEY_SIZE);
+    }
+    pos = start + PUBLIC_KEY_SIZE;
+    return true;
+}
+
+// Reads a small integer push as emitted by ScriptBuilder::pushInteger.
+bool readInteger(const Bytes& script, size_t& pos, int& value) {
+    if (pos >= script.size()) {
+        return false;
+    }
+    uint8_t code = script[pos];
+    if (code >= op(OpCode::PUSH0) && code <= op(OpCode::PUSH16)) {
+        value = code - op(OpCode::PUSH0);
+        pos += 1;
+        return true;
+    }
+    if (code == op(OpCode::PUSHINT8) && pos + 2 <= script.size()) {
+        value = static_cast<int8_t>(script[pos + 1]);
+        pos += 2;
+        return true;
+    }
+    if (code == op(OpCode::PUSHINT16) && pos + 3 <= script.size()) {
+        value = static_cast<int16_t>(script[pos + 1] | (script[pos + 2] << 8));
+        pos += 3;
+        return true;
+    }
+    return false;
+}
+
+bool readSysCall(const Bytes& script, size_t& pos, uint32_t& hash) {
+    if (pos + 5 > script.size() || script[pos] != op(OpCode::SYSCALL)) {
+        return false;
+    }
+    hash = static_cast<uint32_t>(script[pos + 1]) |
+           (static_cast<uint32_t>(script[pos + 2]) << 8) |
+           (static_cast<uint32_t>(script[pos + 3]) << 16) |
+           (static_cast<uint32_t>(script[pos + 4]) << 24);
+    pos += 5;
+    return true;
+}
+
+bool isCheckMultiSigHash(uint32_t hash) {
+    // ScriptBuilder emits "CheckMultiSig" while the interop table spells it "CheckMultisig"
+    static const uint32_t builderHash = InteropService::getHash("System.Crypto.CheckMultiSig");
+    static const uint32_t interopHash = InteropService::getHash(InteropService::SYSTEM_CRYPTO_CHECK_MULTISIG);
+    return hash == builderHash || hash == interopHash;
+}
+
+// Parses a standard single-signature script; the key is copied only when asked for.
+bool parseSignatureContract(const Bytes& script, Bytes* publicKey) {
+    static const uint32_t checkSigHash = InteropService::getHash(InteropService::SYSTEM_CRYPTO_CHECK_SIG);
+
+    size_t pos = 0;
+    uint32_t hash = 0;
+    return readPublicKey(script, pos, publicKey) && readSysCall(script, pos, hash) &&
+           hash == checkSigHash && pos == script.size();
+}
+
+// Parses a standard multi-signature script; the keys are copied only when asked for, so
+// fee estimates count them without allocating.
+bool parseMultiSigContract(const Bytes& script, int& signingThreshold, int& publicKeyCount,
+                           std::vector<Bytes>* publicKeys) {
+    size_t pos = 0;
+    int m = 0;
+    if (!readInteger(script, pos, m)) {
+        return false;
+    }
+
+    std::vector<Bytes> keys;
+    Bytes publicKey;
+    int count = 0;
+    while (readPublicKey(script, pos, publicKeys ? &publicKey : nullptr)) {
+        if (publicKeys) {
+            keys.push_back(std::move(publicKey));
+        }
+        ++count;
+    }
+
+    int n = 0;
+    uint32_t hash = 0;
+    if (!readInteger(script, pos, n) || !readSysCall(script, pos, hash) ||
+        !isCheckMultiSigHash(hash) || pos != script.size()) {
+        return false;
+    }
+    if (n != count || m < 1 || m > n || n > NeoConstants::MAX_PUBLIC_KEYS_PER_MULTISIG_ACCOUNT) {
+        return false;
+    }
+
+    signingThreshold = m;
+    publicKeyCount = n;
+    if (publicKeys) {
+        *publicKeys = std::move(keys);
+    }
+    return true;
+}
+
+size_t signatureInvocationSize() {
+    static const size_t size = ScriptBuilder::buildInvocationScript({Bytes(SIGNATURE_SIZE)}).size();
+    return size;
+}
+
+size_t varBytesSize(size_t length) {
+    return BinaryWriter::getVarSize(static_cast<uint64_t>(length)) + length;
+}
+
+} // namespace
+
+NetworkFeeCalculator::NetworkFeeCalculator(int64_t feePerByte, int32_t execFeeFactor)
+    : feePerByte_(feePerByte), execFeeFactor_(execFeeFactor) {
+    if (feePerByte < 0 || execFeeFactor < 0) {
+        throw IllegalArgumentException("Fee policy values must not be negative");
+    }
+}
+
+SharedPtr<NetworkFeeCalculator> NetworkFeeCalculator::fromClient(const SharedPtr<NeoRpcClient>& client, bool refresh) {
+    if (!client) {
+        throw IllegalStateException("RPC client not set");
+    }
+
+    auto cache = ChainStateCache::forClient(client);
+    if (refresh) {
+        cache->invalidate(ChainStateEntry::FEE_PER_BYTE);
+        cache->invalidate(ChainStateEntry::EXEC_FEE_FACTOR);
+    }
+
+    // Fetch both values concurrently so a cold cache costs a single round trip
+    auto execFeeFactor = std::async(std::launch::async, [&cache]() { return cache->getExecFeeFactor(); });
+    int64_t feePerByte = cache->getFeePerByte();
+    return std::make_shared<NetworkFeeCalculator>(feePerByte, execFeeFactor.get());
+}
+
+void NetworkFeeCalculator::clearCache() {
+    ChainStateCache::invalidateShared(ChainStateEntry::FEE_PER_BYTE);
+    ChainStateCache::invalidateShared(ChainStateEntry::EXEC_FEE_FACTOR);
+}
+
+bool NetworkFeeCalculator::isSignatureContract(const Bytes& script) {
+    return parseSignatureContract(script, nullptr);
+}
+
+bool NetworkFeeCalculator::isSignatureContract(const Bytes& script, Bytes& publicKey) {
+    return parseSignatureContract(script, &publicKey);
+}
+
+bool NetworkFeeCalculator::isMultiSigContract(const Bytes& script, int& signingThreshold, int& publicKeyCount) {
+    return parseMultiSigContract(script, signingThreshold, publicKeyCount, nullptr);
+}
+
+bool NetworkFeeCalculator::isMultiSigContract(const Bytes& script, int& signingThreshold, std::vector<Bytes>& publicKeys) {
+    int publicKeyCount = 0;
+    return parseMultiSigContract(script, signingThreshold, publicKeyCount, &publicKeys);
+}
+
+bool NetworkFeeCalculator::canPrice(const Bytes& script) {
+    int m = 0;
+    int n = 0;
+    return isSignatureContract(script) || isMultiSigContract(script, m, n);
+}
+
+bool NetworkFeeCalculator::canPriceAttributes(const Transaction& transaction) {
+    for (const auto& attribute : transaction.getAttributes()) {
+        if (attribute->getType() != TransactionAttributeType::HIGH_PRIORITY) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int64_t NetworkFeeCalculator::signatureContractCost() {
+    // Signature push, public key push, SYSCALL and the CheckSig interop
+    return PUSHDATA_PRICE * 2 + SYSCALL_PRICE + CHECK_SIG_PRICE;
+}
+
+int64_t NetworkFeeCalculator::multiSignatureContractCost(int signingThreshold, int publicKeyCount) {
+    // m signature pushes, n key pushes, the m and n integer pushes, SYSCALL, and CheckSig per key
+    return PUSHDATA_PRICE * (signingThreshold + publicKeyCount) + PUSH_INTEGER_PRICE * 2 +
+           SYSCALL_PRICE + CHECK_SIG_PRICE * publicKeyCount;
+}
+
+size_t NetworkFeeCalculator::invocationScriptSize(const Bytes& script) {
+    if (isSignatureContract(script)) {
+        return signatureInvocationSize();
+    }
+    int m = 0;
+    int n = 0;
+    if (isMultiSigContract(script, m, n)) {
+        return signatureInvocationSize() * m;
+    }
+    throw IllegalArgumentException("Cannot price a non-standard verification script locally");
+}
+
+int64_t NetworkFeeCalculator::calculateWitnessFee(const Bytes& verificationScript) const {
+    int64_t executionCost = 0;
+    size_t invocationSize = 0;
+    int m = 0;
+    int n = 0;
+    if (isSignatureContract(verificationScript)) {
+        executionCost = signatureContractCost();
+        invocationSize = signatureInvocationSize();
+    } else if (isMultiSigContract(verificationScript, m, n)) {
+        executionCost = multiSignatureContractCost(m, n);
+        invocationSize = signatureInvocationSize() * m;
+    } else {
+        throw IllegalArgumentException("Cannot price a non-standard verification script locally");
+    }
+
+    size_t witnessSize = varBytesSize(invocationSize) + varBytesSize(verificationScript.size());
+    return static_cast<int64_t>(witnessSize) * feePerByte_ + executionCost * execFeeFactor_;
+}
+
+int64_t NetworkFeeCalculator::calculate(const Transaction& transaction, const std::vector<Bytes>& verificationScripts) const {
+    if (!canPriceAttributes(transaction)) {
+        throw IllegalArgumentException("Cannot price transaction attributes with a policy fee locally");
+    }
+    size_t unsignedSize = transaction.getUnsignedSize() + BinaryWriter::getVarSize(static_cast<uint64_t>(verificationScripts.size()));
+
+    int64_t fee = static_cast<int64_t>(unsignedSize) * feePerByte_;
+    for (const auto& script : verificationScripts) {
+        fee += calculateWitnessFee(script);
+    }
+    return fee;
+}
+
+} // namespace neocpp
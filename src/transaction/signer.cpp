@@ -5,6 +5,7 @@
 #include "neocpp/serialization/binary_reader.hpp"
 #include "neocpp/utils/hex.hpp"
 #include "neocpp/exceptions.hpp"
+#include <algorithm>
 
 namespace neocpp {
 
@@ -39,15 +40,18 @@ size_t Signer::getSize() const {
     size_t size = NeoConstants::HASH160_SIZE + 1; // account + scopes
 
     if (hasScope(WitnessScope::CUSTOM_CONTRACTS)) {
-        size += 1 + allowedContracts_.size() * NeoConstants::HASH160_SIZE;
+        size += BinaryWriter::getVarSize(allowedContracts_.size()) + allowedContracts_.size() * NeoConstants::HASH160_SIZE;
     }
 
     if (hasScope(WitnessScope::CUSTOM_GROUPS)) {
-        size += 1 + allowedGroups_.size() * 33; // Assuming compressed public keys
+        size += BinaryWriter::getVarSize(allowedGroups_.size());
+        for (const auto& group : allowedGroups_) {
+            size += group.size();
+        }
     }
 
     if (hasScope(WitnessScope::WITNESS_RULES)) {
-        size += 1;
+        size += BinaryWriter::getVarSize(rules_.size());
         for (const auto& rule : rules_) {
             size += rule->getSize();
         }
@@ -84,10 +88,11 @@ SharedPtr<Signer> Signer::deserialize(BinaryReader& reader) {
     Hash160 account = Hash160::deserialize(reader);
     WitnessScope scopes = WitnessScopeHelper::fromByte(reader.readUInt8());
 
-    auto signer = std::make_shared<Signer>(account, scopes);
+    auto signer = reader.makeShared<Signer>(account, scopes);
 
     if (signer->hasScope(WitnessScope::CUSTOM_CONTRACTS)) {
         uint64_t count = reader.readVarInt();
+        signer->allowedContracts_.reserve(static_cast<size_t>(std::min<uint64_t>(count, NeoConstants::MAX_SIGNER_SUBITEMS)));
         for (uint64_t i = 0; i < count; ++i) {
             signer->allowedContracts_.push_back(Hash160::deserialize(reader));
         }
@@ -95,6 +100,7 @@ SharedPtr<Signer> Signer::deserialize(BinaryReader& reader) {
 
     if (signer->hasScope(WitnessScope::CUSTOM_GROUPS)) {
         uint64_t count = reader.readVarInt();
+        signer->allowedGroups_.reserve(static_cast<size_t>(std::min<uint64_t>(count, NeoConstants::MAX_SIGNER_SUBITEMS)));
         for (uint64_t i = 0; i < count; ++i) {
             signer->allowedGroups_.push_back(reader.readBytes(33));
         }
@@ -102,6 +108,7 @@ SharedPtr<Signer> Signer::deserialize(BinaryReader& reader) {
 
     if (signer->hasScope(WitnessScope::WITNESS_RULES)) {
         uint64_t count = reader.readVarInt();
+        signer->rules_.reserve(static_cast<size_t>(std::min<uint64_t>(count, NeoConstants::MAX_SIGNER_SUBITEMS)));
         for (uint64_t i = 0; i < count; ++i) {
             signer->rules_.push_back(WitnessRule::deserialize(reader));
         }
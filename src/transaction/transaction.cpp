@@ -9,6 +9,7 @@
 #include "neocpp/serialization/binary_writer.hpp"
 #include "neocpp/serialization/binary_reader.hpp"
 #include "neocpp/crypto/hash.hpp"
+#include "neocpp/utils/base64.hpp"
 #include "neocpp/wallet/account.hpp"
 #include "neocpp/crypto/ec_key_pair.hpp"
 #include "neocpp/neo_constants.hpp"
@@ -25,21 +26,26 @@ Transaction::Transaction()
       systemFee_(0),
       networkFee_(0),
       validUntilBlock_(0),
-      hashCalculated_(false) {
+      scriptBorrowed_(false),
+      hashCalculated_(false),
+      unsignedCached_(false),
+      bytesCached_(false),
+      base64Cached_(false) {
 } // namespace neocpp
 void Transaction::addSigner(const SharedPtr<Signer>& signer) {
     signers_.push_back(signer);
-    hashCalculated_ = false;
+    invalidateCache();
 } // namespace neocpp
 void Transaction::addAttribute(const SharedPtr<TransactionAttribute>& attribute) {
     if (attributes_.size() >= NeoConstants::MAX_TRANSACTION_ATTRIBUTES) {
         throw TransactionException("Maximum number of attributes exceeded");
     }
     attributes_.push_back(attribute);
-    hashCalculated_ = false;
+    invalidateCache();
 } // namespace neocpp
 void Transaction::addWitness(const SharedPtr<Witness>& witness) {
     witnesses_.push_back(witness);
+    invalidateWitnessCache();
 } // namespace neocpp
 void Transaction::sign(const SharedPtr<Account>& account) {
     // Calculate the hash of the transaction
@@ -66,15 +72,69 @@ std::string Transaction::getTxId() const {
     return getHash().toString();
 } // namespace neocpp
 Hash256 Transaction::calculateHash() const {
-    Bytes hashData = getHashData();
+    const Bytes& hashData = getHashData();
     // Neo N3 uses double SHA256 for transaction hash
     Bytes hash = HashUtils::doubleSha256(hashData);
     return Hash256(hash);
 } // namespace neocpp
-Bytes Transaction::getHashData() const {
-    BinaryWriter writer;
-    serializeUnsigned(writer);
-    return writer.toArray();
+const Bytes& Transaction::getHashData() const {
+    if (!unsignedCached_) {
+        BinaryWriter writer;
+        writer.reserve(getUnsignedSize());
+        serializeUnsigned(writer);
+        unsignedBytes_ = writer.toArray();
+        unsignedCached_ = true;
+    }
+    return unsignedBytes_;
+} // namespace neocpp
+const Bytes& Transaction::getBytes() const {
+    if (!bytesCached_) {
+        // Reuse the hash data so signing and then sending serializes the body once
+        const Bytes& unsignedBytes = getHashData();
+        BinaryWriter writer;
+        writer.reserve(getSize());
+        writer.writeBytes(unsignedBytes);
+        writer.writeVarInt(witnesses_.size());
+        for (const auto& witness : witnesses_) {
+            witness->serialize(writer);
+        }
+        bytes_ = writer.toArray();
+        bytesCached_ = true;
+    }
+    return bytes_;
+} // namespace neocpp
+const std::string& Transaction::toBase64() const {
+    if (!base64Cached_) {
+        base64_ = Base64::encode(getBytes());
+        base64Cached_ = true;
+    }
+    return base64_;
+} // namespace neocpp
+Bytes Transaction::toArray() const {
+    return getBytes();
+} // namespace neocpp
+const Bytes& Transaction::getOwnedScript() const {
+    auto owned = std::atomic_load(&ownedScript_);
+    if (!owned) {
+        auto copy = std::make_shared<const Bytes>(scriptView_.toBytes());
+        // A concurrent first call may have published its copy already; then that one is used
+        if (std::atomic_compare_exchange_strong(&ownedScript_, &owned, copy)) {
+            owned = copy;
+        }
+    }
+    return *owned;
+} // namespace neocpp
+void Transaction::invalidateCache() {
+    hashCalculated_ = false;
+    unsignedCached_ = false;
+    unsignedBytes_.clear();
+    invalidateWitnessCache();
+} // namespace neocpp
+void Transaction::invalidateWitnessCache() {
+    bytesCached_ = false;
+    bytes_.clear();
+    base64Cached_ = false;
+    base64_.clear();
 } // namespace neocpp
 bool Transaction::verify() const {
     // Basic validation
@@ -86,7 +146,7 @@ bool Transaction::verify() const {
         return false;
     }
 
-    if (script_.empty()) {
+    if (getScriptView().empty()) {
         return false;
     }
 
@@ -129,9 +189,31 @@ int64_t Transaction::calculateNetworkFee() const {
     return fee;
 } // namespace neocpp
 size_t Transaction::getSize() const {
-    BinaryWriter writer;
-    serialize(writer);
-    return writer.size();
+    if (bytesCached_) {
+        return bytes_.size();
+    }
+    size_t size = getUnsignedSize() + BinaryWriter::getVarSize(witnesses_.size());
+    for (const auto& witness : witnesses_) {
+        size += witness->getSize();
+    }
+    return size;
+} // namespace neocpp
+size_t Transaction::getUnsignedSize() const {
+    if (unsignedCached_) {
+        return unsignedBytes_.size();
+    }
+    // version + nonce + system fee + network fee + valid until block
+    size_t size = 1 + 4 + 8 + 8 + 4;
+    size += BinaryWriter::getVarSize(signers_.size());
+    for (const auto& signer : signers_) {
+        size += signer->getSize();
+    }
+    size += BinaryWriter::getVarSize(attributes_.size());
+    for (const auto& attribute : attributes_) {
+        size += attribute->getSize();
+    }
+    ByteView script = getScriptView();
+    return size + BinaryWriter::getVarSize(script.size()) + script.size();
 } // namespace neocpp
 void Transaction::serialize(BinaryWriter& writer) const {
     serializeUnsigned(writer);
@@ -162,10 +244,12 @@ void Transaction::serializeUnsigned(BinaryWriter& writer) const {
     }
 
     // Write script
-    writer.writeVarBytes(script_);
+    ByteView script = getScriptView();
+    writer.writeVarInt(script.size());
+    writer.writeBytes(script.data(), script.size());
 } // namespace neocpp
 SharedPtr<Transaction> Transaction::deserialize(BinaryReader& reader) {
-    auto tx = std::make_shared<Transaction>();
+    auto tx = reader.makeShared<Transaction>();
 
     tx->version_ = reader.readUInt8();
     tx->nonce_ = reader.readUInt32();
@@ -175,56 +259,47 @@ SharedPtr<Transaction> Transaction::deserialize(BinaryReader& reader) {
 
     // Read signers
     uint64_t signerCount = reader.readVarInt();
+    // Neo bounds signers (and so witnesses) by the attribute limit
+    if (signerCount > NeoConstants::MAX_TRANSACTION_ATTRIBUTES) {
+        throw DeserializationException("Too many transaction signers: " + std::to_string(signerCount));
+    }
+    tx->signers_.reserve(static_cast<size_t>(signerCount));
     for (uint64_t i = 0; i < signerCount; ++i) {
         tx->signers_.push_back(Signer::deserialize(reader));
     }
 
     // Read attributes
     uint64_t attrCount = reader.readVarInt();
-    tx->attributes_.clear();
+    // Compared by subtraction so that a hostile count cannot wrap around the limit
+    if (attrCount > NeoConstants::MAX_TRANSACTION_ATTRIBUTES - tx->signers_.size()) {
+        throw DeserializationException("Too many transaction attributes: " + std::to_string(attrCount));
+    }
+    tx->attributes_.reserve(static_cast<size_t>(attrCount));
     for (uint64_t i = 0; i < attrCount; ++i) {
-        // Read attribute type
-        uint8_t type = reader.readByte();
-
-        // Neo N3 supports the following attribute types:
-        // 0x01 - HighPriority
-        // 0x11 - OracleResponse
-        // 0x20 - NotValidBefore
-        // 0x21 - Conflicts
-
-        switch (type) {
-            case 0x01: // HighPriority
-                // No additional data for HighPriority
-                break;
-            case 0x11: { // OracleResponse
-                [[maybe_unused]] uint64_t id = reader.readUInt64();
-                [[maybe_unused]] uint8_t code = reader.readUInt8();
-                Bytes result = reader.readVarBytes();
-                // Store the oracle response data (would need proper attribute structure)
-                break;
+        auto attribute = TransactionAttribute::deserialize(reader);
+        // Only Conflicts may appear more than once
+        if (attribute->getType() != TransactionAttributeType::CONFLICTS) {
+            for (const auto& existing : tx->attributes_) {
+                if (existing->getType() == attribute->getType()) {
+                    throw DeserializationException("Duplicate transaction attribute type: " +
+                                                   std::to_string(static_cast<int>(attribute->getType())));
+                }
             }
-            case 0x20: { // NotValidBefore
-                [[maybe_unused]] uint32_t height = reader.readUInt32();
-                // Store the height
-                break;
-            }
-            case 0x21: { // Conflicts
-                Hash256 hash = Hash256::deserialize(reader);
-                // Store the conflicting transaction hash
-                break;
-            }
-            default:
-                // Unknown attribute type, skip remaining data based on type
-                // For safety, throw an exception for unknown types
-                throw DeserializationException("Unknown transaction attribute type: " + std::to_string(type));
         }
+        tx->attributes_.push_back(attribute);
     }
 
     // Read script
-    tx->script_ = reader.readVarBytes();
+    if (reader.isBorrowed()) {
+        tx->scriptView_ = reader.readVarBytesView();
+        tx->scriptBorrowed_ = true;
+    } else {
+        tx->script_ = reader.readVarBytes();
+    }
 
     // Read witnesses
     uint64_t witnessCount = reader.readVarInt();
+    tx->witnesses_.reserve(static_cast<size_t>(std::min<uint64_t>(witnessCount, NeoConstants::MAX_TRANSACTION_ATTRIBUTES)));
     for (uint64_t i = 0; i < witnessCount; ++i) {
         tx->witnesses_.push_back(Witness::deserialize(reader));
     }
@@ -20,23 +20,29 @@ SharedPtr<TransactionAttribute> TransactionAttribute::deserialize(BinaryReader&
 
     switch (type) {
         case TransactionAttributeType::HIGH_PRIORITY:
-            attribute = std::make_shared<HighPriorityAttribute>();
+            attribute = reader.makeShared<HighPriorityAttribute>();
             break;
         case TransactionAttributeType::ORACLE_RESPONSE: {
             uint64_t id = reader.readUInt64();
             uint8_t code = reader.readUInt8();
             Bytes result = reader.readVarBytes();
-            attribute = std::make_shared<OracleResponseAttribute>(id, code, result);
+            if (result.size() > OracleResponseAttribute::MAX_RESULT_SIZE) {
+                throw DeserializationException("Oracle response result too large: " + std::to_string(result.size()));
+            }
+            if (code != OracleResponseAttribute::CODE_SUCCESS && !result.empty()) {
+                throw DeserializationException("Oracle response with an error code carries a result");
+            }
+            attribute = reader.makeShared<OracleResponseAttribute>(id, code, result);
             break;
         }
         case TransactionAttributeType::NOT_VALID_BEFORE: {
             uint32_t height = reader.readUInt32();
-            attribute = std::make_shared<NotValidBeforeAttribute>(height);
+            attribute = reader.makeShared<NotValidBeforeAttribute>(height);
             break;
         }
         case TransactionAttributeType::CONFLICTS: {
             Hash256 hash = Hash256::deserialize(reader);
-            attribute = std::make_shared<ConflictsAttribute>(hash);
+            attribute = reader.makeShared<ConflictsAttribute>(hash);
             break;
         }
         default:
@@ -47,15 +53,7 @@ SharedPtr<TransactionAttribute> TransactionAttribute::deserialize(BinaryReader&
 } // namespace neocpp
 size_t OracleResponseAttribute::getSize() const {
     // Type byte + uint64 (id) + uint8 (code) + var bytes (result)
-    size_t varIntSize = 1; // Default for values < 0xFD
-    if (result_.size() >= 0xFD && result_.size() <= 0xFFFF) {
-        varIntSize = 3;
-    } else if (result_.size() > 0xFFFF && result_.size() <= 0xFFFFFFFF) {
-        varIntSize = 5;
-    } else if (result_.size() > 0xFFFFFFFF) {
-        varIntSize = 9;
-    }
-    return 1 + 8 + 1 + varIntSize + result_.size();
+    return 1 + 8 + 1 + BinaryWriter::getVarSize(result_.size()) + result_.size();
 } // namespace neocpp
 void OracleResponseAttribute::serializeWithoutType(BinaryWriter& writer) const {
     writer.writeUInt64(id_);
@@ -2,7 +2,9 @@
 #include "neocpp/transaction/transaction.hpp"
 #include "neocpp/transaction/signer.hpp"
 #include "neocpp/transaction/witness.hpp"
+#include "neocpp/transaction/network_fee_calculator.hpp"
 #include "neocpp/protocol/neo_rpc_client.hpp"
+#include "neocpp/protocol/chain_state_cache.hpp"
 #include "neocpp/wallet/account.hpp"
 #include "neocpp/script/script_builder.hpp"
 #include "neocpp/types/contract_parameter.hpp"
@@ -19,6 +21,9 @@
 #include "neocpp/transaction/witness_scope.hpp"
 #include <openssl/rand.h>
 #include <algorithm>
+#include <exception>
+#include <future>
+#include <unordered_map>
 
 namespace neocpp {
 
@@ -51,16 +56,7 @@ TransactionBuilder& TransactionBuilder::setValidUntilBlock(uint32_t block) {
     return *this;
 } // namespace neocpp
 TransactionBuilder& TransactionBuilder::setValidUntilBlockRelative(uint32_t blocksFromNow) {
-    if (!client_) {
-        throw IllegalStateException("RPC client not set");
-    }
-
-    auto blockCount = client_->getBlockCount();
-    if (!blockCount) {
-        throw RuntimeException("Failed to get block count");
-    }
-
-    transaction_->setValidUntilBlock(blockCount + blocksFromNow);
+    transaction_->setValidUntilBlock(getCurrentBlockCount() + blocksFromNow);
     return *this;
 } // namespace neocpp
 TransactionBuilder& TransactionBuilder::setSystemFee(int64_t fee) {
@@ -91,24 +87,7 @@ SharedPtr<Signer> TransactionBuilder::firstSigner() const {
     return signers[0];
 } // namespace neocpp
 TransactionBuilder& TransactionBuilder::calculateNetworkFee() {
-    if (!client_) {
-        throw IllegalStateException("RPC client not set");
-    }
-
-    // Base fee calculation
-    int64_t fee = 0;
-
-    // Calculate verification cost for each signer
-    for (const auto& signer : transaction_->getSigners()) {
-        // Basic verification cost
-        fee += 1000000; // 0.01 GAS base cost
-    }
-
-    // Calculate size-based fee
-    auto size = transaction_->getSize();
-    fee += size * 1000; // Fee per byte
-
-    transaction_->setNetworkFee(fee);
+    transaction_->setNetworkFee(calcNetworkFee(*transaction_) + additionalNetworkFee_);
     return *this;
 } // namespace neocpp
 TransactionBuilder& TransactionBuilder::addSigner(const SharedPtr<Signer>& signer) {
@@ -212,25 +191,50 @@ TransactionBuilder& TransactionBuilder::extendScript(const Bytes& script) {
     return *this;
 } // namespace neocpp
 SharedPtr<Transaction> TransactionBuilder::getUnsignedTransaction() {
-    // Set valid until block if not set
-    if (transaction_->getValidUntilBlock() == 0) {
-        setValidUntilBlockRelative(100);
-    }
-
     // Verify there are signers
-    auto signers = transaction_->getSigners();
-    if (signers.empty()) {
+    if (transaction_->getSigners().empty()) {
         throw IllegalStateException("Cannot create a transaction without signers. At least one signer with witness scope fee-only or higher is required.");
     }
 
+    // The RPC phases only read the transaction and do not depend on each other, so they run
+    // concurrently and the builder waits for the slowest round trip instead of their sum.
+    // Results are applied afterwards, in the original order, so errors surface as before.
+    bool needsValidUntilBlock = transaction_->getValidUntilBlock() == 0;
+    bool checksFeeCoverage = feeError_ || feeConsumer_;
+
+    // The fee phases read the script, attributes and encoded size while this thread sets the
+    // valid-until block, so they work on a copy. Neither fee depends on the valid-until block:
+    // it is a fixed-width field and the script is simulated without it.
+    const Transaction snapshot(*transaction_);
+
+    std::future<uint32_t> blockCount;
+    if (needsValidUntilBlock) {
+        blockCount = std::async(std::launch::async, [this]() { return getCurrentBlockCount(); });
+    }
+    std::future<bool> highPriorityAllowed;
+    if (isHighPriority_) {
+        highPriorityAllowed = std::async(std::launch::async, [this]() { return isAllowedForHighPriority(); });
+    }
+    std::future<int64_t> gasBalance;
+    if (checksFeeCoverage) {
+        gasBalance = std::async(std::launch::async, [this]() { return getSenderGasBalance(); });
+    }
+    auto systemFeeResult = std::async(std::launch::async, [this, &snapshot]() { return getSystemFeeForScript(snapshot); });
+    auto networkFeeResult = std::async(std::launch::async, [this, &snapshot]() { return calcNetworkFee(snapshot); });
+
+    // Set valid until block if not set
+    if (needsValidUntilBlock) {
+        transaction_->setValidUntilBlock(blockCount.get() + 100);
+    }
+
     // Check high priority
-    if (isHighPriority_ && !isAllowedForHighPriority()) {
+    if (isHighPriority_ && !highPriorityAllowed.get()) {
         throw IllegalStateException("This transaction does not have a committee member as signer. Only committee members can send transactions with high priority.");
     }
 
     // Calculate fees
-    int64_t systemFee = getSystemFeeForScript() + additionalSystemFee_;
-    int64_t networkFee = calcNetworkFee() + additionalNetworkFee_;
+    int64_t systemFee = systemFeeResult.get() + additionalSystemFee_;
+    int64_t networkFee = networkFeeResult.get() + additionalNetworkFee_;
     int64_t totalFees = systemFee + networkFee;
 
     // Set fees
@@ -238,11 +242,26 @@ SharedPtr<Transaction> TransactionBuilder::getUnsignedTransaction() {
     transaction_->setNetworkFee(networkFee);
 
     // Check fee coverage
-    if (feeError_ && !canSendCoverFees(totalFees)) {
-        throw *feeError_;
-    } else if (feeConsumer_ && !canSendCoverFees(totalFees)) {
-        int64_t gasBalance = getSenderGasBalance();
-        feeConsumer_(totalFees, gasBalance);
+    if (checksFeeCoverage) {
+        int64_t balance = 0;
+        std::exception_ptr balanceError;
+        try {
+            balance = gasBalance.get();
+        } catch (const std::exception& e) {
+            LOG_DEBUG(std::string("Error checking sender balance: ") + e.what());
+            balanceError = std::current_exception();
+        }
+
+        // If the balance cannot be determined, assume the sender cannot cover the fees
+        if (balanceError || balance < totalFees) {
+            if (feeError_) {
+                throw *feeError_;
+            }
+            if (balanceError) {
+                std::rethrow_exception(balanceError);
+            }
+            feeConsumer_(totalFees, balance);
+        }
     }
 
     // Sort signers and witnesses
@@ -341,13 +360,14 @@ void TransactionBuilder::addWitnessForAccount(const SharedPtr<Account>& account)
 void TransactionBuilder::sortSigners() {
     auto signers = transaction_->getSigners();
 
-    // Sort signers by scope first, then by account hash
+    // Sort signers by scope first, then by account hash. Comparing the raw big-endian bytes
+    // gives the same order as comparing the hex strings without formatting them.
     std::sort(signers.begin(), signers.end(),
         [](const SharedPtr<Signer>& a, const SharedPtr<Signer>& b) {
             if (a->getScopes() != b->getScopes()) {
                 return a->getScopes() < b->getScopes();
             }
-            return a->getAccount().toString() < b->getAccount().toString();
+            return a->getAccount() < b->getAccount();
         });
 
     transaction_->clearSigners();
@@ -357,22 +377,26 @@ void TransactionBuilder::sortSigners() {
 } // namespace neocpp
 void TransactionBuilder::sortWitnesses() {
     auto witnesses = transaction_->getWitnesses();
-    auto signers = transaction_->getSigners();
+    const auto& signers = transaction_->getSigners();
 
     if (witnesses.size() != signers.size()) {
         return; // Can't sort if counts don't match
     }
 
+    // Hash each verification script once; the first witness for a script hash wins
+    std::unordered_map<Hash160, SharedPtr<Witness>, Hash160::Hasher> witnessesByHash;
+    witnessesByHash.reserve(witnesses.size());
+    for (const auto& witness : witnesses) {
+        witnessesByHash.emplace(Hash160::fromScript(witness->getVerificationScript()), witness);
+    }
+
     // Sort witnesses to match signer order
     std::vector<SharedPtr<Witness>> sortedWitnesses;
+    sortedWitnesses.reserve(signers.size());
     for (const auto& signer : signers) {
-        // Find matching witness by verification script hash
-        for (const auto& witness : witnesses) {
-            Hash160 scriptHash = Hash160::fromScript(witness->getVerificationScript());
-            if (scriptHash == signer->getAccount()) {
-                sortedWitnesses.push_back(witness);
-                break;
-            }
+        auto it = witnessesByHash.find(signer->getAccount());
+        if (it != witnessesByHash.end()) {
+            sortedWitnesses.push_back(it->second);
         }
     }
 
@@ -388,7 +412,7 @@ bool TransactionBuilder::isAllowedForHighPriority() {
         throw IllegalStateException("RPC client not set");
     }
 
-    std::vector<std::string> committee = client_->getCommittee();
+    std::vector<std::string> committee = ChainStateCache::forClient(client_)->getCommittee();
     if (committee.empty()) {
         throw RuntimeException("Failed to get committee members or committee is empty");
     }
@@ -494,16 +518,16 @@ bool TransactionBuilder::signersContainMultiSigWithCommitteeMember(const std::ve
     // No multi-sig with committee member found
     return false;
 } // namespace neocpp
-int64_t TransactionBuilder::getSystemFeeForScript() {
+int64_t TransactionBuilder::getSystemFeeForScript(const Transaction& transaction) {
     if (!client_) {
         throw IllegalStateException("RPC client not set");
     }
 
-    auto script = transaction_->getScript();
+    auto script = transaction.getScript();
 
     // Convert signers to JSON format
     nlohmann::json signersJson = nlohmann::json::array();
-    for (const auto& signer : transaction_->getSigners()) {
+    for (const auto& signer : transaction.getSigners()) {
         nlohmann::json signerObj;
         signerObj["account"] = signer->getAccount().toString();
 
@@ -549,47 +573,56 @@ int64_t TransactionBuilder::getSystemFeeForScript() {
     // Parse gas consumed from string
     return std::stoll(response->getGasConsumed());
 } // namespace neocpp
-int64_t TransactionBuilder::calcNetworkFee() {
-    // Create a temporary transaction for fee calculation
+int64_t TransactionBuilder::calcNetworkFee(const Transaction& transaction) {
+    if (signingAccounts_.empty()) {
+        throw IllegalStateException("A transaction requires at least one signing account. None was provided.");
+    }
+
+    if (!client_) {
+        throw IllegalStateException("RPC client not set");
+    }
+
+    std::vector<Bytes> verificationScripts;
+    verificationScripts.reserve(signingAccounts_.size());
+    bool standardAccountsOnly = true;
+    for (const auto& account : signingAccounts_) {
+        verificationScripts.push_back(createFakeVerificationScript(account));
+        standardAccountsOnly = standardAccountsOnly && NetworkFeeCalculator::canPrice(verificationScripts.back());
+    }
+
+    // Standard single-sig and multi-sig accounts are priced locally from the cached policy,
+    // unless an attribute carries a policy fee that only the node can price
+    if (standardAccountsOnly && NetworkFeeCalculator::canPriceAttributes(transaction)) {
+        return NetworkFeeCalculator::fromClient(client_)->calculate(transaction, verificationScripts);
+    }
+
+    // Contract verification has to be executed by the node
     auto tx = std::make_shared<Transaction>();
-    tx->setVersion(transaction_->getVersion());
-    tx->setNonce(transaction_->getNonce());
+    tx->setVersion(transaction.getVersion());
+    tx->setNonce(transaction.getNonce());
     tx->setSystemFee(0);
     tx->setNetworkFee(0);
-    tx->setValidUntilBlock(transaction_->getValidUntilBlock());
-    tx->setScript(transaction_->getScript());
+    tx->setValidUntilBlock(transaction.getValidUntilBlock());
+    tx->setScript(transaction.getScript());
 
     // Copy signers
-    for (const auto& signer : transaction_->getSigners()) {
+    for (const auto& signer : transaction.getSigners()) {
         tx->addSigner(signer);
     }
 
     // Copy attributes
-    for (const auto& attribute : transaction_->getAttributes()) {
+    for (const auto& attribute : transaction.getAttributes()) {
         tx->addAttribute(attribute);
     }
 
-    bool hasAtLeastOneSigningAccount = false;
-
     // Add fake witnesses for fee calculation
-    for (const auto& account : signingAccounts_) {
-        auto verificationScript = createFakeVerificationScript(account);
+    for (const auto& verificationScript : verificationScripts) {
         auto witness = std::make_shared<Witness>();
         witness->setVerificationScript(verificationScript);
         tx->addWitness(witness);
-        hasAtLeastOneSigningAccount = true;
-    }
-
-    if (!hasAtLeastOneSigningAccount) {
-        throw IllegalStateException("A transaction requires at least one signing account. None was provided.");
-    }
-
-    if (!client_) {
-        throw IllegalStateException("RPC client not set");
     }
 
-    auto fee = client_->calculateNetworkFee(tx);
-    return fee;
+    return client_->calculateNetworkFee(tx);
 } // namespace neocpp
 int64_t TransactionBuilder::getSenderGasBalance() {
     if (!client_) {
@@ -604,55 +637,19 @@ int64_t TransactionBuilder::getSenderGasBalance() {
     // Use the first signer's account as the sender
     auto senderHash = signers[0]->getAccount();
 
-    // Call balanceOf on the GAS contract
-    std::vector<ContractParameter> params = {
-        ContractParameter::hash160(senderHash)
-    };
-
-    // Convert ContractParameter vector to JSON format
-    nlohmann::json jsonParams = nlohmann::json::array();
-    for (const auto& param : params) {
-        jsonParams.push_back(param.toRpcJson());
-    }
-
-    auto response = client_->invokeFunction(GasToken::SCRIPT_HASH, "balanceOf", jsonParams);
-    if (!response) {
-        throw RuntimeException("Failed to get GAS balance");
-    }
-
-    const auto& stack = response->getStack();
-    if (stack.empty()) {
-        throw RuntimeException("Invalid response from balanceOf call: empty stack");
-    }
-
-    // Parse the balance from the stack result
-    // StackItem is an abstract base, we need to use the appropriate getter
-    auto& stackItem = stack[0];
-    if (stackItem->getType() == StackItemType::INTEGER) {
-        return std::stoll(stackItem->getString());
-    } else if (stackItem->getType() == StackItemType::BYTE_STRING) {
-        // Handle hex string representation if needed
-        try {
-            return std::stoll(stackItem->getString(), nullptr, 16);
-        } catch (const std::exception& e) {
-            LOG_ERROR(std::string("Failed to parse balance from response: ") + e.what());
-            throw RuntimeException("Failed to parse balance from response");
-        } catch (...) {
-            LOG_ERROR("Failed to parse balance from response: unknown error");
-            throw RuntimeException("Failed to parse balance from response");
-        }
+    // Call balanceOf on the GAS contract; balances are cached until the next block
+    return ChainStateCache::forClient(client_)->getGasBalance(senderHash);
+} // namespace neocpp
+uint32_t TransactionBuilder::getCurrentBlockCount() {
+    if (!client_) {
+        throw IllegalStateException("RPC client not set");
     }
 
-    throw RuntimeException("Invalid balanceOf response type");
-} // namespace neocpp
-bool TransactionBuilder::canSendCoverFees(int64_t fees) {
-    try {
-        return getSenderGasBalance() >= fees;
-    } catch (const std::exception& e) {
-        LOG_DEBUG(std::string("Error checking sender balance: ") + e.what());
-        // If there's an error checking balance, assume sender cannot cover fees
-        return false;
+    auto blockCount = ChainStateCache::forClient(client_)->getBlockCount();
+    if (!blockCount) {
+        throw RuntimeException("Failed to get block count");
     }
+    return blockCount;
 } // namespace neocpp
 nlohmann::json TransactionBuilder::buildSignersJson(const std::vector<SharedPtr<Signer>>& signers) {
     nlohmann::json signersJson = nlohmann::json::array();
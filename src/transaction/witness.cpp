@@ -12,11 +12,30 @@ namespace neocpp {
 Witness::Witness(const Bytes& invocationScript, const Bytes& verificationScript)
     : invocationScript_(invocationScript), verificationScript_(verificationScript) {
 } // namespace neocpp
+const Witness::OwnedScripts& Witness::getOwnedScripts() const {
+    auto owned = std::atomic_load(&ownedScripts_);
+    if (!owned) {
+        auto copy = std::make_shared<const OwnedScripts>(OwnedScripts{invocationView_.toBytes(), verificationView_.toBytes()});
+        // A concurrent first call may have published its copy already; then that one is used
+        if (std::atomic_compare_exchange_strong(&ownedScripts_, &owned, copy)) {
+            owned = copy;
+        }
+    }
+    return *owned;
+} // namespace neocpp
+void Witness::materialize() {
+    if (borrowed_) {
+        invocationScript_ = invocationView_.toBytes();
+        verificationScript_ = verificationView_.toBytes();
+        borrowed_ = false;
+        ownedScripts_.reset();
+    }
+} // namespace neocpp
 Hash160 Witness::getScriptHash() const {
-    if (verificationScript_.empty()) {
+    if (getVerificationScriptView().empty()) {
         return Hash160();
     }
-    return Hash160::fromScript(verificationScript_);
+    return Hash160::fromScript(getVerificationScript());
 } // namespace neocpp
 SharedPtr<Witness> Witness::fromSignature(const Bytes& signature, const Bytes& publicKey) {
     Bytes invocation = ScriptBuilder::buildInvocationScript({signature});
@@ -33,23 +52,34 @@ SharedPtr<Witness> Witness::fromMultiSignature(const std::vector<Bytes>& signatu
     return std::make_shared<Witness>(invocation, verification);
 } // namespace neocpp
 size_t Witness::getSize() const {
-    BinaryWriter writer;
-    writer.writeVarInt(invocationScript_.size());
-    writer.writeVarInt(verificationScript_.size());
-    return writer.size() + invocationScript_.size() + verificationScript_.size();
+    ByteView invocation = getInvocationScriptView();
+    ByteView verification = getVerificationScriptView();
+    return BinaryWriter::getVarSize(invocation.size()) + invocation.size() +
+           BinaryWriter::getVarSize(verification.size()) + verification.size();
 } // namespace neocpp
 void Witness::serialize(BinaryWriter& writer) const {
-    writer.writeVarBytes(invocationScript_);
-    writer.writeVarBytes(verificationScript_);
+    ByteView invocation = getInvocationScriptView();
+    ByteView verification = getVerificationScriptView();
+    writer.writeVarInt(invocation.size());
+    writer.writeBytes(invocation.data(), invocation.size());
+    writer.writeVarInt(verification.size());
+    writer.writeBytes(verification.data(), verification.size());
 } // namespace neocpp
 SharedPtr<Witness> Witness::deserialize(BinaryReader& reader) {
-    Bytes invocation = reader.readVarBytes();
-    Bytes verification = reader.readVarBytes();
-    return std::make_shared<Witness>(invocation, verification);
+    auto witness = reader.makeShared<Witness>();
+    if (reader.isBorrowed()) {
+        witness->invocationView_ = reader.readVarBytesView();
+        witness->verificationView_ = reader.readVarBytesView();
+        witness->borrowed_ = true;
+    } else {
+        witness->invocationScript_ = reader.readVarBytes();
+        witness->verificationScript_ = reader.readVarBytes();
+    }
+    return witness;
 } // namespace neocpp
 bool Witness::operator==(const Witness& other) const {
-    return invocationScript_ == other.invocationScript_ &&
-           verificationScript_ == other.verificationScript_;
+    return getInvocationScriptView() == other.getInvocationScriptView() &&
+           getVerificationScriptView() == other.getVerificationScriptView();
 } // namespace neocpp
 bool Witness::operator!=(const Witness& other) const {
     return !(*this == other);
@@ -52,10 +52,7 @@ size_t WitnessCondition::getSize() const {
             break;
         case WitnessConditionType::AND:
         case WitnessConditionType::OR:
-            size += 1; // varint size for count (assuming < 253 conditions)
-            if (conditions_.size() >= 253) {
-                size += 2; // need 3 bytes total for larger counts
-            }
+            size += BinaryWriter::getVarSize(conditions_.size());
             for (const auto& cond : conditions_) {
                 size += cond->getSize();
             }
@@ -157,7 +154,7 @@ void WitnessRule::serialize(BinaryWriter& writer) const {
     }
 } // namespace neocpp
 SharedPtr<WitnessRule> WitnessRule::deserialize(BinaryReader& reader) {
-    auto rule = std::make_shared<WitnessRule>();
+    auto rule = reader.makeShared<WitnessRule>();
     rule->action_ = static_cast<WitnessRuleAction>(reader.readUInt8());
     rule->condition_ = WitnessCondition::deserialize(reader);
     return rule;
@@ -0,0 +1,328 @@
+#include "neocpp/types/big_integer.hpp"
+#include "neocpp/exceptions.hpp"
+#include <cstring>
+
+namespace neocpp {
+
+namespace {
+
+void negate(uint64_t* limbs) {
+    uint64_t carry = 1;
+    for (int i = 0; i < 4; ++i) {
+        uint64_t inverted = ~limbs[i];
+        limbs[i] = inverted + carry;
+        carry = carry && limbs[i] == 0 ? 1 : 0;
+    }
+}
+
+/// Number of significant bits of an unsigned 256-bit value
+size_t bitLength(const uint64_t* limbs) {
+    for (int i = 3; i >= 0; --i) {
+        if (limbs[i] != 0) {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<size_t>(i) * 64 + 64 - static_cast<size_t>(__builtin_clzll(limbs[i]));
+#else
+            size_t bits = 0;
+            for (uint64_t v = limbs[i]; v != 0; v >>= 1) {
+                ++bits;
+            }
+            return static_cast<size_t>(i) * 64 + bits;
+#endif
+        }
+    }
+    return 0;
+}
+
+/// Divide an unsigned 256-bit value in place by a 32-bit divisor and return the remainder
+uint32_t divideSmall(uint64_t* limbs, uint32_t divisor) {
+    uint64_t remainder = 0;
+    for (int i = 3; i >= 0; --i) {
+        uint64_t high = (remainder << 32) | (limbs[i] >> 32);
+        uint64_t highQuotient = high / divisor;
+        remainder = high % divisor;
+        uint64_t low = (remainder << 32) | (limbs[i] & 0xFFFFFFFFULL);
+        uint64_t lowQuotient = low / divisor;
+        remainder = low % divisor;
+        limbs[i] = (highQuotient << 32) | lowQuotient;
+    }
+    return static_cast<uint32_t>(remainder);
+}
+
+/// limbs = limbs * factor + addend on an unsigned 256-bit value; false if it overflows 256 bits
+bool multiplyAddSmall(uint64_t* limbs, uint32_t factor, uint32_t addend) {
+    uint64_t carry = addend;
+    for (int i = 0; i < 4; ++i) {
+        uint64_t low = (limbs[i] & 0xFFFFFFFFULL) * factor + carry;
+        uint64_t high = (limbs[i] >> 32) * factor + (low >> 32);
+        limbs[i] = (high << 32) | (low & 0xFFFFFFFFULL);
+        carry = high >> 32;
+    }
+    return carry == 0;
+}
+
+/// Whether an unsigned magnitude fits the signed range for the given sign
+bool magnitudeInRange(const uint64_t* magnitude, bool negative) {
+    if ((magnitude[3] >> 63) == 0) {
+        return true;
+    }
+    // Only -2^255 has the top bit set
+    return negative && magnitude[3] == (1ULL << 63) && magnitude[2] == 0 && magnitude[1] == 0 && magnitude[0] == 0;
+}
+
+const char* const OVERFLOW_MESSAGE = "Integer exceeds 256 bits";
+
+} // namespace
+
+BigInteger BigInteger::fromUnsigned(uint64_t value) {
+    BigInteger result;
+    result.limbs_[0] = value;
+    return result;
+} // namespace neocpp
+BigInteger BigInteger::parse(std::string_view text) {
+    bool negative = !text.empty() && text[0] == '-';
+    std::string_view digits = negative ? text.substr(1) : text;
+    if (digits.empty()) {
+        throw IllegalArgumentException("Invalid integer: \"" + std::string(text) + "\"");
+    }
+    for (char c : digits) {
+        if (c < '0' || c > '9') {
+            throw IllegalArgumentException("Invalid integer: \"" + std::string(text) + "\"");
+        }
+    }
+
+    if (digits.size() <= 18) {
+        int64_t value = 0;
+        for (char c : digits) {
+            value = value * 10 + (c - '0');
+        }
+        return BigInteger(negative ? -value : value);
+    }
+
+    // Nine digits at a time into an unsigned magnitude
+    BigInteger result;
+    size_t position = 0;
+    while (position < digits.size()) {
+        size_t count = std::min<size_t>(9, digits.size() - position);
+        uint32_t chunk = 0;
+        uint32_t factor = 1;
+        for (size_t i = 0; i < count; ++i) {
+            chunk = chunk * 10 + static_cast<uint32_t>(digits[position + i] - '0');
+            factor *= 10;
+        }
+        if (!multiplyAddSmall(result.limbs_, factor, chunk)) {
+            throw IllegalArgumentException(OVERFLOW_MESSAGE);
+        }
+        position += count;
+    }
+    if (!magnitudeInRange(result.limbs_, negative)) {
+        throw IllegalArgumentException(OVERFLOW_MESSAGE);
+    }
+    if (negative) {
+        negate(result.limbs_);
+    }
+    return result;
+} // namespace neocpp
+BigInteger BigInteger::fromBytes(ByteView bytes) {
+    if (bytes.size() > MAX_SIZE) {
+        throw IllegalArgumentException("Integer encoding exceeds 32 bytes");
+    }
+    if (bytes.empty()) {
+        return BigInteger();
+    }
+    uint8_t buffer[MAX_SIZE];
+    std::memcpy(buffer, bytes.data(), bytes.size());
+    std::memset(buffer + bytes.size(), (bytes[bytes.size() - 1] & 0x80) ? 0xFF : 0x00, MAX_SIZE - bytes.size());
+
+    BigInteger result;
+    for (size_t i = 0; i < MAX_SIZE; ++i) {
+        result.limbs_[i / 8] |= static_cast<uint64_t>(buffer[i]) << ((i % 8) * 8);
+    }
+    return result;
+} // namespace neocpp
+BigInteger BigInteger::pow10(unsigned exponent) {
+    if (exponent > 76) {
+        throw IllegalArgumentException(OVERFLOW_MESSAGE);
+    }
+    BigInteger result(1);
+    for (; exponent >= 9; exponent -= 9) {
+        multiplyAddSmall(result.limbs_, 1000000000u, 0);
+    }
+    uint32_t factor = 1;
+    for (unsigned i = 0; i < exponent; ++i) {
+        factor *= 10;
+    }
+    multiplyAddSmall(result.limbs_, factor, 0);
+    return result;
+} // namespace neocpp
+std::string BigInteger::toString() const {
+    if (fitsInt64()) {
+        return std::to_string(static_cast<int64_t>(limbs_[0]));
+    }
+
+    uint64_t magnitude[4] = {limbs_[0], limbs_[1], limbs_[2], limbs_[3]};
+    if (isNegative()) {
+        negate(magnitude);
+    }
+
+    // Nine-digit groups, least significant first; at most 78 digits
+    uint32_t groups[9];
+    size_t count = 0;
+    while (magnitude[0] | magnitude[1] | magnitude[2] | magnitude[3]) {
+        groups[count++] = divideSmall(magnitude, 1000000000u);
+    }
+
+    std::string text = isNegative() ? "-" : "";
+    text += std::to_string(groups[count - 1]);
+    for (size_t i = count - 1; i-- > 0;) {
+        std::string group = std::to_string(groups[i]);
+        text.append(9 - group.size(), '0');
+        text += group;
+    }
+    return text;
+} // namespace neocpp
+size_t BigInteger::getByteLength() const {
+    if (isZero()) {
+        return 0;
+    }
+    // Significant bits of the value, or of its complement when negative, plus a sign bit
+    uint64_t bits[4] = {limbs_[0], limbs_[1], limbs_[2], limbs_[3]};
+    if (isNegative()) {
+        for (auto& limb : bits) {
+            limb = ~limb;
+        }
+    }
+    return bitLength(bits) / 8 + 1;
+} // namespace neocpp
+void BigInteger::writeBytes(uint8_t* out, size_t width) const {
+    if (width < getByteLength() || width > MAX_SIZE) {
+        throw IllegalArgumentException("Integer does not fit in " + std::to_string(width) + " bytes");
+    }
+    for (size_t i = 0; i < width; ++i) {
+        out[i] = static_cast<uint8_t>(limbs_[i / 8] >> ((i % 8) * 8));
+    }
+} // namespace neocpp
+Bytes BigInteger::toBytes() const {
+    Bytes bytes(getByteLength());
+    if (!bytes.empty()) {
+        writeBytes(bytes.data(), bytes.size());
+    }
+    return bytes;
+} // namespace neocpp
+int64_t BigInteger::toInt64() const {
+    if (!fitsInt64()) {
+        throw IllegalStateException("Integer does not fit in 64 bits: " + toString());
+    }
+    return static_cast<int64_t>(limbs_[0]);
+} // namespace neocpp
+int BigInteger::sign() const {
+    return isNegative() ? -1 : (isZero() ? 0 : 1);
+} // namespace neocpp
+BigInteger BigInteger::operator-() const {
+    BigInteger result = *this;
+    negate(result.limbs_);
+    if (isNegative() && result.isNegative()) {
+        throw IllegalArgumentException(OVERFLOW_MESSAGE);  // -(-2^255)
+    }
+    return result;
+} // namespace neocpp
+BigInteger BigInteger::operator+(const BigInteger& other) const {
+    BigInteger result;
+    uint64_t carry = 0;
+    for (int i = 0; i < 4; ++i) {
+        uint64_t sum = limbs_[i] + other.limbs_[i];
+        uint64_t carryOut = sum < limbs_[i] ? 1 : 0;
+        result.limbs_[i] = sum + carry;
+        carryOut |= result.limbs_[i] < sum ? 1 : 0;
+        carry = carryOut;
+    }
+    if (isNegative() == other.isNegative() && result.isNegative() != isNegative()) {
+        throw IllegalArgumentException(OVERFLOW_MESSAGE);
+    }
+    return result;
+} // namespace neocpp
+BigInteger BigInteger::operator-(const BigInteger& other) const {
+    BigInteger result;
+    uint64_t borrow = 0;
+    for (int i = 0; i < 4; ++i) {
+        uint64_t difference = limbs_[i] - other.limbs_[i];
+        uint64_t borrowOut = limbs_[i] < other.limbs_[i] ? 1 : 0;
+        borrowOut |= difference < borrow ? 1 : 0;
+        result.limbs_[i] = difference - borrow;
+        borrow = borrowOut;
+    }
+    if (isNegative() != other.isNegative() && result.isNegative() != isNegative()) {
+        throw IllegalArgumentException(OVERFLOW_MESSAGE);
+    }
+    return result;
+} // namespace neocpp
+BigInteger BigInteger::operator*(const BigInteger& other) const {
+#if defined(__GNUC__) || defined(__clang__)
+    if (fitsInt64() && other.fitsInt64()) {
+        int64_t product = 0;
+        if (!__builtin_mul_overflow(static_cast<int64_t>(limbs_[0]), static_cast<int64_t>(other.limbs_[0]), &product)) {
+            return BigInteger(product);
+        }
+    }
+#endif
+    bool negative = isNegative() != other.isNegative();
+    uint64_t a[4] = {limbs_[0], limbs_[1], limbs_[2], limbs_[3]};
+    uint64_t b[4] = {other.limbs_[0], other.limbs_[1], other.limbs_[2], other.limbs_[3]};
+    if (isNegative()) {
+        negate(a);
+    }
+    if (other.isNegative()) {
+        negate(b);
+    }
+
+    // Schoolbook multiplication on 32-bit words
+    uint32_t x[8];
+    uint32_t y[8];
+    for (int i = 0; i < 4; ++i) {
+        x[2 * i] = static_cast<uint32_t>(a[i]);
+        x[2 * i + 1] = static_cast<uint32_t>(a[i] >> 32);
+        y[2 * i] = static_cast<uint32_t>(b[i]);
+        y[2 * i + 1] = static_cast<uint32_t>(b[i] >> 32);
+    }
+    uint32_t product[16] = {};
+    for (int i = 0; i < 8; ++i) {
+        if (x[i] == 0) {
+            continue;
+        }
+        uint64_t carry = 0;
+        for (int j = 0; j < 8; ++j) {
+            uint64_t t = static_cast<uint64_t>(x[i]) * y[j] + product[i + j] + carry;
+            product[i + j] = static_cast<uint32_t>(t);
+            carry = t >> 32;
+        }
+        product[i + 8] = static_cast<uint32_t>(carry);
+    }
+    for (int i = 8; i < 16; ++i) {
+        if (product[i] != 0) {
+            throw IllegalArgumentException(OVERFLOW_MESSAGE);
+        }
+    }
+
+    BigInteger result;
+    for (int i = 0; i < 4; ++i) {
+        result.limbs_[i] = static_cast<uint64_t>(product[2 * i]) | (static_cast<uint64_t>(product[2 * i + 1]) << 32);
+    }
+    if (!magnitudeInRange(result.limbs_, negative)) {
+        throw IllegalArgumentException(OVERFLOW_MESSAGE);
+    }
+    if (negative) {
+        negate(result.limbs_);
+    }
+    return result;
+} // namespace neocpp
+bool operator<(const BigInteger& a, const BigInteger& b) {
+    if (a.limbs_[3] != b.limbs_[3]) {
+        return static_cast<int64_t>(a.limbs_[3]) < static_cast<int64_t>(b.limbs_[3]);
+    }
+    for (int i = 2; i >= 0; --i) {
+        if (a.limbs_[i] != b.limbs_[i]) {
+            return a.limbs_[i] < b.limbs_[i];
+        }
+    }
+    return false;
+} // namespace neocpp
+} // namespace neocpp
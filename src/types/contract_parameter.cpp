@@ -19,7 +19,11 @@ ContractParameter::ContractParameter(bool value) : type_(ContractParameterType::
 }
 
 // Constructor for int64_t
-ContractParameter::ContractParameter(int64_t value) : type_(ContractParameterType::INTEGER), value_(value) {
+ContractParameter::ContractParameter(int64_t value) : type_(ContractParameterType::INTEGER), value_(BigInteger(value)) {
+}
+
+// Constructor for BigInteger
+ContractParameter::ContractParameter(const BigInteger& value) : type_(ContractParameterType::INTEGER), value_(value) {
 }
 
 // Constructor for Bytes
@@ -65,6 +69,11 @@ ContractParameter ContractParameter::boolean(bool value) {
     return param;
 } // namespace neocpp
 ContractParameter ContractParameter::integer(int64_t value) {
+    ContractParameter param(ContractParameterType::INTEGER);
+    param.value_ = BigInteger(value);
+    return param;
+} // namespace neocpp
+ContractParameter ContractParameter::integer(const BigInteger& value) {
     ContractParameter param(ContractParameterType::INTEGER);
     param.value_ = value;
     return param;
@@ -116,10 +125,13 @@ bool ContractParameter::getBoolean() const {
     return std::get<bool>(value_);
 } // namespace neocpp
 int64_t ContractParameter::getInteger() const {
+    return getBigInteger().toInt64();
+} // namespace neocpp
+BigInteger ContractParameter::getBigInteger() const {
     if (type_ != ContractParameterType::INTEGER) {
         throw IllegalArgumentException("Parameter is not an integer");
     }
-    return std::get<int64_t>(value_);
+    return std::get<BigInteger>(value_);
 } // namespace neocpp
 Bytes ContractParameter::getByteArray() const {
     if (type_ != ContractParameterType::BYTE_ARRAY && type_ != ContractParameterType::SIGNATURE) {
@@ -198,7 +210,7 @@ nlohmann::json ContractParameter::toRpcJson() const {
             result["value"] = getBoolean();
             break;
         case ContractParameterType::INTEGER:
-            result["value"] = std::to_string(getInteger());
+            result["value"] = getBigInteger().toString();
             break;
         case ContractParameterType::BYTE_ARRAY:
         case ContractParameterType::SIGNATURE:
@@ -266,7 +278,7 @@ ContractParameter ContractParameter::fromRpcJson(const nlohmann::json& json) {
             return ContractParameter::boolean(json["value"].get<bool>());
         case ContractParameterType::INTEGER: {
             std::string intStr = json["value"].get<std::string>();
-            return ContractParameter::integer(std::stoll(intStr));
+            return ContractParameter::integer(BigInteger::parse(intStr));
         }
         case ContractParameterType::BYTE_ARRAY:
         case ContractParameterType::SIGNATURE:
@@ -1,6 +1,7 @@
 
 #include "neocpp/types/hash160.hpp"
 #include "neocpp/types/types.hpp"
+#include "neocpp/utils/hex.hpp"
 #include "neocpp/serialization/binary_writer.hpp"
 #include "neocpp/serialization/binary_reader.hpp"
 #include "neocpp/exceptions.hpp"
@@ -28,6 +29,10 @@ Hash160::Hash160(const Bytes& hash) {
 Hash160::Hash160(const std::array<uint8_t, NeoConstants::HASH160_SIZE>& hash) : hash_(hash) {
 } // namespace neocpp
 Hash160::Hash160(const std::string& hash) {
+    // Decode straight into the array; odd-length and wrong-size input takes the general path
+    if (Hex::decode(hash, hash_.data(), hash_.size())) {
+        return;
+    }
     Bytes bytes = ByteUtils::fromHex(hash);
     if (bytes.size() != NeoConstants::HASH160_SIZE) {
         throw IllegalArgumentException("Hash must be " + std::to_string(NeoConstants::HASH160_SIZE) +
@@ -36,7 +41,7 @@ Hash160::Hash160(const std::string& hash) {
     std::copy(bytes.begin(), bytes.end(), hash_.begin());
 } // namespace neocpp
 std::string Hash160::toString() const {
-    return ByteUtils::toHex(Bytes(hash_.begin(), hash_.end()), false);
+    return Hex::encode(hash_.data(), hash_.size());
 } // namespace neocpp
 Bytes Hash160::toArray() const {
     return Bytes(hash_.begin(), hash_.end());
@@ -50,7 +55,11 @@ std::string Hash160::toAddress() const {
     return AddressUtils::scriptHashToAddress(toArray());
 } // namespace neocpp
 Hash160 Hash160::fromAddress(const std::string& address) {
-    return Hash160(AddressUtils::addressToScriptHash(address));
+    Hash160 result;
+    if (!AddressUtils::tryAddressToScriptHash(address, result.hash_.data())) {
+        throw IllegalArgumentException("Invalid Neo address");
+    }
+    return result;
 } // namespace neocpp
 Hash160 Hash160::fromScript(const Bytes& script) {
     Bytes hash = HashUtils::sha256ThenRipemd160(script);
@@ -74,7 +83,8 @@ void Hash160::serialize(BinaryWriter& writer) const {
     writer.writeBytes(toArray());
 } // namespace neocpp
 Hash160 Hash160::deserialize(BinaryReader& reader) {
-    Bytes bytes = reader.readBytes(NeoConstants::HASH160_SIZE);
+    std::array<uint8_t, NeoConstants::HASH160_SIZE> bytes;
+    reader.readBytes(bytes.data(), bytes.size());
     // Hash is stored in big-endian internally
     return Hash160(bytes);
 } // namespace neocpp
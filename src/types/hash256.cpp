@@ -26,6 +26,9 @@ Hash256::Hash256(const Bytes& hash) {
 Hash256::Hash256(const std::array<uint8_t, NeoConstants::HASH256_SIZE>& hash) : hash_(hash) {
 } // namespace neocpp
 Hash256::Hash256(const std::string& hash) {
+    if (Hex::decode(hash, hash_.data(), hash_.size())) {
+        return;
+    }
     Bytes bytes = Hex::decode(hash);
     if (bytes.size() != NeoConstants::HASH256_SIZE) {
         throw IllegalArgumentException("Hash must be " + std::to_string(NeoConstants::HASH256_SIZE) +
@@ -34,7 +37,7 @@ Hash256::Hash256(const std::string& hash) {
     std::copy(bytes.begin(), bytes.end(), hash_.begin());
 } // namespace neocpp
 std::string Hash256::toString() const {
-    return Hex::encode(Bytes(hash_.begin(), hash_.end()));
+    return Hex::encode(hash_.data(), hash_.size());
 } // namespace neocpp
 Bytes Hash256::toArray() const {
     return Bytes(hash_.begin(), hash_.end());
@@ -52,7 +55,8 @@ void Hash256::serialize(BinaryWriter& writer) const {
     writer.writeBytes(toArray());
 } // namespace neocpp
 Hash256 Hash256::deserialize(BinaryReader& reader) {
-    Bytes bytes = reader.readBytes(NeoConstants::HASH256_SIZE);
+    std::array<uint8_t, NeoConstants::HASH256_SIZE> bytes;
+    reader.readBytes(bytes.data(), bytes.size());
     // Hash is stored in big-endian internally
     return Hash256(bytes);
 } // namespace neocpp
@@ -1,41 +1,39 @@
 
 #include "neocpp/types/types.hpp"
+#include "neocpp/utils/hex.hpp"
 #include <algorithm>
-#include <sstream>
-#include <iomanip>
 #include <cstring>
+#include <stdexcept>
 
 namespace neocpp {
 
 std::string ByteUtils::toHex(const Bytes& bytes, bool with_prefix) {
-    std::stringstream ss;
-    if (with_prefix) {
-        ss << "0x";
+    if (!with_prefix) {
+        return Hex::encode(bytes);
     }
-    for (const auto& byte : bytes) {
-        ss << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(byte);
-    }
-    return ss.str();
+    std::string result(2 + bytes.size() * 2, '\0');
+    result[0] = '0';
+    result[1] = 'x';
+    Hex::encode(bytes.data(), bytes.size(), result.data() + 2);
+    return result;
 } // namespace neocpp
 Bytes ByteUtils::fromHex(const std::string& hex) {
-    std::string cleanHex = hex;
+    std::string_view cleanHex = hex;
     // Remove 0x prefix if present
     if (cleanHex.size() >= 2 && cleanHex[0] == '0' && (cleanHex[1] == 'x' || cleanHex[1] == 'X')) {
-        cleanHex = cleanHex.substr(2);
+        cleanHex.remove_prefix(2);
     }
 
     // Ensure even length
+    std::string padded;
     if (cleanHex.length() % 2 != 0) {
-        cleanHex = "0" + cleanHex;
+        padded = "0" + std::string(cleanHex);
+        cleanHex = padded;
     }
 
-    Bytes result;
-    result.reserve(cleanHex.length() / 2);
-
-    for (size_t i = 0; i < cleanHex.length(); i += 2) {
-        std::string byteString = cleanHex.substr(i, 2);
-        uint8_t byte = static_cast<uint8_t>(std::stoul(byteString, nullptr, 16));
-        result.push_back(byte);
+    Bytes result(cleanHex.length() / 2);
+    if (!Hex::decode(cleanHex, result.data(), result.size())) {
+        throw std::invalid_argument("Invalid hex string");
     }
 
     return result;
@@ -1,54 +1,77 @@
-
 #include "neocpp/utils/address.hpp"
 #include "neocpp/utils/base58.hpp"
-#include "neocpp/crypto/hash.hpp"
+#include "neocpp/utils/parallel.hpp"
 #include "neocpp/neo_constants.hpp"
 #include "neocpp/exceptions.hpp"
-#include "neocpp/logger.hpp"
+#include <cstring>
 
 namespace neocpp {
 
+namespace {
+
+// Neo N3 addresses (version 0x35) are always 34 characters
+constexpr size_t ADDRESS_LENGTH = 34;
+
+} // namespace
+
 std::string AddressUtils::scriptHashToAddress(const Bytes& scriptHash) {
     if (scriptHash.size() != NeoConstants::HASH160_SIZE) {
         throw IllegalArgumentException("Script hash must be 20 bytes");
     }
 
-    Bytes data;
-    data.push_back(getAddressVersion());
-    data.insert(data.end(), scriptHash.begin(), scriptHash.end());
+    uint8_t data[Base58::FIXED_DATA_SIZE];
+    data[0] = getAddressVersion();
+    std::memcpy(data + 1, scriptHash.data(), NeoConstants::HASH160_SIZE);
 
-    return Base58::encodeCheck(data);
+    char address[Base58::FIXED_MAX_LENGTH];
+    return std::string(address, Base58::encodeCheckFixed(data, address));
 } // namespace neocpp
 Bytes AddressUtils::addressToScriptHash(const std::string& address) {
-    if (!isValidAddress(address)) {
+    Bytes scriptHash(NeoConstants::HASH160_SIZE);
+    if (!tryAddressToScriptHash(address, scriptHash.data())) {
         throw IllegalArgumentException("Invalid Neo address");
     }
-
-    Bytes decoded = Base58::decodeCheck(address);
-
-    if (decoded.empty() || decoded[0] != getAddressVersion()) {
-        throw IllegalArgumentException("Invalid address version");
-    }
-
-    return Bytes(decoded.begin() + 1, decoded.end());
+    return scriptHash;
 } // namespace neocpp
 bool AddressUtils::isValidAddress(const std::string& address) {
-    if (address.empty() || address.length() != 34) {
+    uint8_t scriptHash[NeoConstants::HASH160_SIZE];
+    return tryAddressToScriptHash(address, scriptHash);
+} // namespace neocpp
+bool AddressUtils::tryAddressToScriptHash(std::string_view address, uint8_t* scriptHash) {
+    if (address.length() != ADDRESS_LENGTH) {
         return false;
     }
 
-    try {
-        Bytes decoded = Base58::decodeCheck(address);
-        return !decoded.empty() &&
-               decoded.size() == 21 &&
-               decoded[0] == getAddressVersion();
-    } catch (const IllegalArgumentException& e) {
-        LOG_DEBUG(std::string("Invalid Base58 format or checksum: ") + e.what());
-        return false;
-    } catch (const std::exception& e) {
-        LOG_DEBUG(std::string("Address decoding error: ") + e.what());
+    uint8_t data[Base58::FIXED_DATA_SIZE];
+    if (!Base58::decodeCheckFixed(address, data) || data[0] != getAddressVersion()) {
         return false;
     }
+
+    std::memcpy(scriptHash, data + 1, NeoConstants::HASH160_SIZE);
+    return true;
+} // namespace neocpp
+std::vector<std::string> AddressUtils::scriptHashesToAddresses(const std::vector<Bytes>& scriptHashes,
+                                                               unsigned int threads) {
+    std::vector<std::string> addresses(scriptHashes.size());
+    Parallel::forChunks(scriptHashes.size(), threads, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            addresses[i] = scriptHashToAddress(scriptHashes[i]);
+        }
+    });
+    return addresses;
+} // namespace neocpp
+std::vector<Bytes> AddressUtils::addressesToScriptHashes(const std::vector<std::string>& addresses,
+                                                         unsigned int threads) {
+    std::vector<Bytes> scriptHashes(addresses.size());
+    Parallel::forChunks(addresses.size(), threads, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            scriptHashes[i].resize(NeoConstants::HASH160_SIZE);
+            if (!tryAddressToScriptHash(addresses[i], scriptHashes[i].data())) {
+                throw IllegalArgumentException("Invalid Neo address at index " + std::to_string(i) + ": " + addresses[i]);
+            }
+        }
+    });
+    return scriptHashes;
 } // namespace neocpp
 uint8_t AddressUtils::getAddressVersion() {
     return NeoConstants::ADDRESS_VERSION;
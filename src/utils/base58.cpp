@@ -10,11 +10,57 @@ namespace neocpp {
 const char* Base58::ALPHABET = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
 const int Base58::BASE = 58;
 
+namespace {
+
+// Digit value of each character (-1 = not in the alphabet)
+struct ReverseTable {
+    int8_t values[256];
+};
+
+constexpr ReverseTable makeReverseTable() {
+    ReverseTable table{};
+    const char alphabet[] = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+    for (int i = 0; i < 256; ++i) {
+        table.values[i] = -1;
+    }
+    for (int i = 0; i < 58; ++i) {
+        table.values[static_cast<uint8_t>(alphabet[i])] = static_cast<int8_t>(i);
+    }
+    return table;
+}
+
+constexpr ReverseTable REVERSE = makeReverseTable();
+
+// A 25-byte payload is held in seven big-endian 32-bit limbs (the first limb holds one byte)
+// and converted five Base58 digits at a time, 58^5 being the largest power that fits 32 bits.
+constexpr size_t FIXED_LIMBS = 7;
+constexpr uint32_t BASE58_POW5 = 58u * 58u * 58u * 58u * 58u;
+
+void appendChecksum(const uint8_t* data, size_t size, uint8_t* out) {
+    uint8_t hash[32];
+    HashUtils::sha256(data, size, hash);
+    HashUtils::sha256(hash, sizeof(hash), hash);
+    std::memcpy(out, hash, 4);
+}
+
+bool checksumMatches(const uint8_t* payload) {
+    uint8_t checksum[4];
+    appendChecksum(payload, Base58::FIXED_DATA_SIZE, checksum);
+    return std::memcmp(checksum, payload + Base58::FIXED_DATA_SIZE, 4) == 0;
+}
+
+} // namespace
+
 std::string Base58::encode(const Bytes& data) {
     if (data.empty()) {
         return "";
     }
 
+    if (data.size() == FIXED_PAYLOAD_SIZE) {
+        char out[FIXED_MAX_LENGTH];
+        return std::string(out, encodeFixed(data.data(), out));
+    }
+
     // Count leading zeros
     size_t zeros = 0;
     for (const auto& byte : data) {
@@ -77,13 +123,12 @@ Bytes Base58::decode(const std::string& encoded) {
     size_t length = 0;
 
     for (const auto& c : encoded) {
-        const char* p = std::strchr(ALPHABET, c);
-        if (p == nullptr) {
+        int carry = REVERSE.values[static_cast<uint8_t>(c)];
+        if (carry < 0) {
             // Return empty bytes for invalid characters instead of throwing
             return Bytes();
         }
 
-        int carry = p - ALPHABET;
         for (size_t i = 0; i < length || carry; ++i) {
             carry += BASE * buffer[i];
             buffer[i] = carry % 256;
@@ -109,12 +154,23 @@ Bytes Base58::decode(const std::string& encoded) {
     return result;
 } // namespace neocpp
 std::string Base58::encodeCheck(const Bytes& data) {
+    if (data.size() == FIXED_DATA_SIZE) {
+        char out[FIXED_MAX_LENGTH];
+        return std::string(out, encodeCheckFixed(data.data(), out));
+    }
+
     Bytes checksum = calculateChecksum(data);
     Bytes dataWithChecksum = data;
     dataWithChecksum.insert(dataWithChecksum.end(), checksum.begin(), checksum.end());
     return encode(dataWithChecksum);
 } // namespace neocpp
 Bytes Base58::decodeCheck(const std::string& encoded) {
+    // Addresses and other 21-byte bodies decode without temporaries
+    uint8_t payload[FIXED_PAYLOAD_SIZE];
+    if (encoded.size() <= FIXED_MAX_LENGTH && decodeFixed(encoded, payload)) {
+        return checksumMatches(payload) ? Bytes(payload, payload + FIXED_DATA_SIZE) : Bytes();
+    }
+
     Bytes decoded = decode(encoded);
 
     // Return empty if decode failed or too short
@@ -129,6 +185,122 @@ Bytes Base58::decodeCheck(const std::string& encoded) {
 
     return Bytes(decoded.begin(), decoded.end() - 4);
 } // namespace neocpp
+size_t Base58::encodeFixed(const uint8_t* payload, char* out) {
+    uint32_t limbs[FIXED_LIMBS];
+    limbs[0] = payload[0];
+    for (size_t i = 1; i < FIXED_LIMBS; ++i) {
+        const uint8_t* p = payload + 1 + (i - 1) * 4;
+        limbs[i] = (static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16) |
+                   (static_cast<uint32_t>(p[2]) << 8) | p[3];
+    }
+
+    // Divide by 58^5 seven times, least significant digits first
+    uint8_t digits[FIXED_MAX_LENGTH];
+    for (size_t round = FIXED_MAX_LENGTH / 5; round-- > 0;) {
+        uint64_t remainder = 0;
+        for (size_t i = 0; i < FIXED_LIMBS; ++i) {
+            uint64_t current = (remainder << 32) | limbs[i];
+            limbs[i] = static_cast<uint32_t>(current / BASE58_POW5);
+            remainder = current % BASE58_POW5;
+        }
+        for (size_t k = 5; k-- > 0;) {
+            digits[round * 5 + k] = static_cast<uint8_t>(remainder % 58);
+            remainder /= 58;
+        }
+    }
+
+    // Leading zero bytes become '1's; leading zero digits are dropped
+    size_t zeros = 0;
+    while (zeros < FIXED_PAYLOAD_SIZE && payload[zeros] == 0) {
+        ++zeros;
+    }
+    size_t first = 0;
+    while (first < FIXED_MAX_LENGTH && digits[first] == 0) {
+        ++first;
+    }
+
+    size_t length = 0;
+    for (size_t i = 0; i < zeros; ++i) {
+        out[length++] = ALPHABET[0];
+    }
+    for (size_t i = first; i < FIXED_MAX_LENGTH; ++i) {
+        out[length++] = ALPHABET[digits[i]];
+    }
+    return length;
+} // namespace neocpp
+bool Base58::decodeFixed(std::string_view encoded, uint8_t* payload) {
+    if (encoded.empty() || encoded.size() > FIXED_MAX_LENGTH) {
+        return false;
+    }
+
+    // Multiply-accumulate five characters at a time; the first chunk takes the remainder
+    uint32_t limbs[FIXED_LIMBS] = {};
+    size_t pos = 0;
+    size_t chunk = encoded.size() % 5 == 0 ? 5 : encoded.size() % 5;
+    while (pos < encoded.size()) {
+        uint32_t value = 0;
+        uint32_t multiplier = 1;
+        for (size_t k = 0; k < chunk; ++k) {
+            int digit = REVERSE.values[static_cast<uint8_t>(encoded[pos + k])];
+            if (digit < 0) {
+                return false;
+            }
+            value = value * 58 + static_cast<uint32_t>(digit);
+            multiplier *= 58;
+        }
+
+        uint64_t carry = value;
+        for (size_t i = FIXED_LIMBS; i-- > 0;) {
+            uint64_t current = static_cast<uint64_t>(limbs[i]) * multiplier + carry;
+            limbs[i] = static_cast<uint32_t>(current);
+            carry = current >> 32;
+        }
+        if (carry != 0) {
+            return false;
+        }
+
+        pos += chunk;
+        chunk = 5;
+    }
+    if (limbs[0] > 0xFF) {
+        return false;
+    }
+
+    payload[0] = static_cast<uint8_t>(limbs[0]);
+    for (size_t i = 1; i < FIXED_LIMBS; ++i) {
+        uint8_t* p = payload + 1 + (i - 1) * 4;
+        p[0] = static_cast<uint8_t>(limbs[i] >> 24);
+        p[1] = static_cast<uint8_t>(limbs[i] >> 16);
+        p[2] = static_cast<uint8_t>(limbs[i] >> 8);
+        p[3] = static_cast<uint8_t>(limbs[i]);
+    }
+
+    // decode() yields one zero byte per leading '1' followed by the number's significant bytes,
+    // so the result is 25 bytes only if both counts of leading zeros agree
+    size_t ones = 0;
+    while (ones < encoded.size() && encoded[ones] == ALPHABET[0]) {
+        ++ones;
+    }
+    size_t zeros = 0;
+    while (zeros < FIXED_PAYLOAD_SIZE && payload[zeros] == 0) {
+        ++zeros;
+    }
+    return ones == zeros;
+} // namespace neocpp
+size_t Base58::encodeCheckFixed(const uint8_t* data, char* out) {
+    uint8_t payload[FIXED_PAYLOAD_SIZE];
+    std::memcpy(payload, data, FIXED_DATA_SIZE);
+    appendChecksum(data, FIXED_DATA_SIZE, payload + FIXED_DATA_SIZE);
+    return encodeFixed(payload, out);
+} // namespace neocpp
+bool Base58::decodeCheckFixed(std::string_view encoded, uint8_t* data) {
+    uint8_t payload[FIXED_PAYLOAD_SIZE];
+    if (!decodeFixed(encoded, payload) || !checksumMatches(payload)) {
+        return false;
+    }
+    std::memcpy(data, payload, FIXED_DATA_SIZE);
+    return true;
+} // namespace neocpp
 Bytes Base58::calculateChecksum(const Bytes& data) {
     Bytes hash = HashUtils::doubleSha256(data);
     return Bytes(hash.begin(), hash.begin() + 4);
@@ -1,86 +1,348 @@
-
 #include "neocpp/utils/base64.hpp"
-#include <openssl/bio.h>
-#include <openssl/evp.h>
-#include <openssl/buffer.h>
-#include <memory>
+#include <algorithm>
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define NEOCPP_BASE64_X86 1
+#include <immintrin.h>
+#endif
 
 namespace neocpp {
 
-std::string Base64::encode(const Bytes& data) {
-    if (data.empty()) {
-        return "";
+namespace {
+
+// Two characters per 12-bit value for encoding, and 6-bit values (-1 = invalid) for decoding.
+// Decoding accepts both the standard (+/) and the URL-safe (-_) alphabet.
+struct Base64Tables {
+    char pairs[2 * 4096];
+    int8_t values[256];
+};
+
+constexpr char ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+constexpr Base64Tables makeTables() {
+    Base64Tables tables{};
+    for (int i = 0; i < 4096; ++i) {
+        tables.pairs[2 * i] = ALPHABET[i >> 6];
+        tables.pairs[2 * i + 1] = ALPHABET[i & 0x3F];
+    }
+    for (int i = 0; i < 256; ++i) {
+        tables.values[i] = -1;
+    }
+    for (int i = 0; i < 64; ++i) {
+        tables.values[static_cast<uint8_t>(ALPHABET[i])] = static_cast<int8_t>(i);
+    }
+    tables.values['-'] = 62;
+    tables.values['_'] = 63;
+    return tables;
+}
+
+constexpr Base64Tables TABLES = makeTables();
+
+// Whole 3-byte groups; size must be a multiple of 3
+void encodeScalar(const uint8_t* data, size_t size, char* out) {
+    for (size_t i = 0; i < size; i += 3, out += 4) {
+        uint32_t group = (uint32_t(data[i]) << 16) | (uint32_t(data[i + 1]) << 8) | data[i + 2];
+        std::memcpy(out, TABLES.pairs + 2 * (group >> 12), 2);
+        std::memcpy(out + 2, TABLES.pairs + 2 * (group & 0xFFF), 2);
     }
+}
 
-    BIO* bio = BIO_new(BIO_s_mem());
-    BIO* b64 = BIO_new(BIO_f_base64());
-    BIO_set_flags(b64, BIO_FLAGS_BASE64_NO_NL);
-    bio = BIO_push(b64, bio);
+// Whole 4-character groups without padding; size must be a multiple of 4
+bool decodeScalar(const char* in, size_t size, uint8_t* out) {
+    for (size_t i = 0; i < size; i += 4, out += 3) {
+        int a = TABLES.values[static_cast<uint8_t>(in[i])];
+        int b = TABLES.values[static_cast<uint8_t>(in[i + 1])];
+        int c = TABLES.values[static_cast<uint8_t>(in[i + 2])];
+        int d = TABLES.values[static_cast<uint8_t>(in[i + 3])];
+        if ((a | b | c | d) < 0) {
+            return false;
+        }
+        uint32_t group = (uint32_t(a) << 18) | (uint32_t(b) << 12) | (uint32_t(c) << 6) | uint32_t(d);
+        out[0] = static_cast<uint8_t>(group >> 16);
+        out[1] = static_cast<uint8_t>(group >> 8);
+        out[2] = static_cast<uint8_t>(group);
+    }
+    return true;
+}
 
-    BIO_write(bio, data.data(), data.size());
-    BIO_flush(bio);
+// Vectorized paths process whole blocks and return the number of input bytes (encode) or
+// characters (decode) handled. Decoding stops at the first block holding anything outside
+// the standard alphabet; the scalar code then finishes and rejects or accepts the rest.
+size_t encodeNone(const uint8_t*, size_t, char*) {
+    return 0;
+}
 
-    BUF_MEM* bufferPtr = nullptr;
-    BIO_get_mem_ptr(bio, &bufferPtr);
+size_t decodeNone(const char*, size_t, uint8_t*) {
+    return 0;
+}
 
-    std::string result(bufferPtr->data, bufferPtr->length);
-    BIO_free_all(bio);
+#ifdef NEOCPP_BASE64_X86
 
-    return result;
-} // namespace neocpp
-Bytes Base64::decode(const std::string& encoded) {
-    if (encoded.empty()) {
-        return Bytes();
+// The vector algorithms follow Muła and Lemire, "Faster Base64 Encoding and Decoding
+// using AVX2 Instructions". Encoding spreads each 3-byte group over a 32-bit lane, then
+// moves the four 6-bit fields into separate bytes with multiplies.
+__attribute__((target("ssse3")))
+inline __m128i encodeReshuffleSsse3(__m128i in) {
+    in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    __m128i t0 = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+    __m128i t1 = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+    return _mm_or_si128(t0, t1);
+}
+
+// 6-bit values to ASCII: each of the five alphabet ranges has one offset in the table
+__attribute__((target("ssse3")))
+inline __m128i encodeTranslateSsse3(__m128i in) {
+    const __m128i offsets = _mm_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0);
+    __m128i indices = _mm_subs_epu8(in, _mm_set1_epi8(51));
+    indices = _mm_sub_epi8(indices, _mm_cmpgt_epi8(in, _mm_set1_epi8(25)));
+    return _mm_add_epi8(in, _mm_shuffle_epi8(offsets, indices));
+}
+
+// ASCII to 6-bit values. A character is valid when the bit its high nibble selects in
+// HI is clear in the mask its low nibble selects in LO. Returns false on any invalid lane.
+__attribute__((target("ssse3")))
+inline bool decodeTranslateSsse3(__m128i& chars) {
+    const __m128i lo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                     0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    const __m128i hi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                                     0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m128i roll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i mask2F = _mm_set1_epi8(0x2F);
+
+    __m128i hiNibbles = _mm_and_si128(_mm_srli_epi32(chars, 4), mask2F);
+    __m128i loNibbles = _mm_and_si128(chars, mask2F);
+    __m128i invalid = _mm_and_si128(_mm_shuffle_epi8(lo, loNibbles), _mm_shuffle_epi8(hi, hiNibbles));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(invalid, _mm_setzero_si128())) != 0xFFFF) {
+        return false;
     }
+    // '/' shares its high nibble with '+', so it is moved to its own slot of ROLL
+    __m128i slash = _mm_cmpeq_epi8(chars, mask2F);
+    chars = _mm_add_epi8(chars, _mm_shuffle_epi8(roll, _mm_add_epi8(slash, hiNibbles)));
+    return true;
+}
 
-    // Validate input - length must be multiple of 4
-    if (encoded.length() % 4 != 0) {
-        return Bytes();
+// Four 6-bit values per 32-bit lane to three bytes, packed into the low 12 bytes
+__attribute__((target("ssse3")))
+inline __m128i decodeReshuffleSsse3(__m128i in) {
+    __m128i merged = _mm_maddubs_epi16(in, _mm_set1_epi32(0x01400140));
+    merged = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+    return _mm_shuffle_epi8(merged, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+}
+
+// Loads read 16 bytes and use 12, so blocks stop four bytes short of the end
+__attribute__((target("ssse3")))
+size_t encodeSsse3(const uint8_t* data, size_t size, char* out) {
+    size_t i = 0;
+    for (; i + 16 <= size; i += 12, out += 16) {
+        __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), encodeTranslateSsse3(encodeReshuffleSsse3(in)));
     }
+    return i;
+}
 
-    // Check for valid padding placement
-    size_t paddingPos = encoded.find('=');
-    if (paddingPos != std::string::npos) {
-        // Once we see padding, all characters after must also be padding
-        for (size_t i = paddingPos; i < encoded.length(); ++i) {
-            if (encoded[i] != '=') {
-                return Bytes();  // Invalid: non-padding after padding
-            }
-        }
-        // Maximum 2 padding characters allowed
-        size_t paddingCount = encoded.length() - paddingPos;
-        if (paddingCount > 2) {
-            return Bytes();  // Too many padding characters
+__attribute__((target("ssse3")))
+size_t decodeSsse3(const char* in, size_t size, uint8_t* out) {
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16, out += 12) {
+        __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        if (!decodeTranslateSsse3(chars)) {
+            return i;
         }
+        __m128i bytes = decodeReshuffleSsse3(chars);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(out), bytes);
+        uint32_t last = static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(bytes, 8)));
+        std::memcpy(out + 8, &last, 4);
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+inline __m256i encodeReshuffleAvx2(__m256i in) {
+    in = _mm256_shuffle_epi8(in, _mm256_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+                                                 10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    __m256i t0 = _mm256_mulhi_epu16(_mm256_and_si256(in, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+    __m256i t1 = _mm256_mullo_epi16(_mm256_and_si256(in, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+    return _mm256_or_si256(t0, t1);
+}
+
+__attribute__((target("avx2")))
+inline __m256i encodeTranslateAvx2(__m256i in) {
+    const __m256i offsets = _mm256_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0,
+                                             65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0);
+    __m256i indices = _mm256_subs_epu8(in, _mm256_set1_epi8(51));
+    indices = _mm256_sub_epi8(indices, _mm256_cmpgt_epi8(in, _mm256_set1_epi8(25)));
+    return _mm256_add_epi8(in, _mm256_shuffle_epi8(offsets, indices));
+}
+
+__attribute__((target("avx2")))
+inline bool decodeTranslateAvx2(__m256i& chars) {
+    const __m256i lo = _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                        0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+                                        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                        0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    const __m256i hi = _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                                        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+                                        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                                        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m256i roll = _mm256_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+                                          0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i mask2F = _mm256_set1_epi8(0x2F);
+
+    __m256i hiNibbles = _mm256_and_si256(_mm256_srli_epi32(chars, 4), mask2F);
+    __m256i loNibbles = _mm256_and_si256(chars, mask2F);
+    if (!_mm256_testz_si256(_mm256_shuffle_epi8(lo, loNibbles), _mm256_shuffle_epi8(hi, hiNibbles))) {
+        return false;
+    }
+    __m256i slash = _mm256_cmpeq_epi8(chars, mask2F);
+    chars = _mm256_add_epi8(chars, _mm256_shuffle_epi8(roll, _mm256_add_epi8(slash, hiNibbles)));
+    return true;
+}
+
+// Each 128-bit lane yields 12 bytes; permutevar8x32 joins them into the low 24
+__attribute__((target("avx2")))
+inline __m256i decodeReshuffleAvx2(__m256i in) {
+    __m256i merged = _mm256_maddubs_epi16(in, _mm256_set1_epi32(0x01400140));
+    merged = _mm256_madd_epi16(merged, _mm256_set1_epi32(0x00011000));
+    merged = _mm256_shuffle_epi8(merged, _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                                          2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+    return _mm256_permutevar8x32_epi32(merged, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+}
+
+// Lanes are loaded from data and data + 12 so each holds four whole groups
+__attribute__((target("avx2")))
+size_t encodeAvx2(const uint8_t* data, size_t size, char* out) {
+    size_t i = 0;
+    for (; i + 28 <= size; i += 24, out += 32) {
+        __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 12));
+        __m256i in = _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), encodeTranslateAvx2(encodeReshuffleAvx2(in)));
     }
+    return i + encodeSsse3(data + i, size - i, out);
+}
 
-    // Check for invalid characters
-    for (char c : encoded) {
-        if (!( (c >= 'A' && c <= 'Z') ||
-               (c >= 'a' && c <= 'z') ||
-               (c >= '0' && c <= '9') ||
-               c == '+' || c == '/' || c == '=' ||
-               c == '-' || c == '_' )) {
-            return Bytes();  // Invalid character
+// Stores write exactly 24 bytes so the output buffer needs no slack
+__attribute__((target("avx2")))
+size_t decodeAvx2(const char* in, size_t size, uint8_t* out) {
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32, out += 24) {
+        __m256i chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        if (!decodeTranslateAvx2(chars)) {
+            return i;
         }
+        __m256i bytes = decodeReshuffleAvx2(chars);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm256_castsi256_si128(bytes));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(out + 16), _mm256_extracti128_si256(bytes, 1));
     }
+    return i + decodeSsse3(in + i, size - i, out);
+}
 
-    BIO* bio = BIO_new_mem_buf(encoded.data(), encoded.length());
-    BIO* b64 = BIO_new(BIO_f_base64());
-    BIO_set_flags(b64, BIO_FLAGS_BASE64_NO_NL);
-    bio = BIO_push(b64, bio);
+#endif // NEOCPP_BASE64_X86
 
-    Bytes result(encoded.length());
-    int decodedLength = BIO_read(bio, result.data(), encoded.length());
-    BIO_free_all(bio);
+struct Base64Codec {
+    size_t (*encode)(const uint8_t*, size_t, char*);
+    size_t (*decode)(const char*, size_t, uint8_t*);
+    const char* name;
+};
 
-    if (decodedLength < 0) {
-        return Bytes();
+Base64Codec selectCodec() {
+#ifdef NEOCPP_BASE64_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return {encodeAvx2, decodeAvx2, "avx2"};
     }
+    if (__builtin_cpu_supports("ssse3")) {
+        return {encodeSsse3, decodeSsse3, "ssse3"};
+    }
+#endif
+    return {encodeNone, decodeNone, "scalar"};
+}
+
+const Base64Codec& codec() {
+    static const Base64Codec selected = selectCodec();
+    return selected;
+}
+
+} // namespace
 
-    result.resize(decodedLength);
+std::string Base64::encode(const Bytes& data) {
+    return encode(data.data(), data.size());
+} // namespace neocpp
+std::string Base64::encode(const uint8_t* data, size_t size) {
+    std::string result(encodedLength(size), '\0');
+    encode(data, size, result.data());
     return result;
 } // namespace neocpp
+void Base64::encode(const uint8_t* data, size_t size, char* out) {
+    size_t done = codec().encode(data, size, out);
+    size_t whole = size - size % 3;
+    encodeScalar(data + done, whole - done, out + done / 3 * 4);
+    out += whole / 3 * 4;
+
+    // Final partial group with padding
+    size_t rest = size - whole;
+    if (rest > 0) {
+        uint32_t group = uint32_t(data[whole]) << 16;
+        if (rest == 2) {
+            group |= uint32_t(data[whole + 1]) << 8;
+        }
+        out[0] = ALPHABET[group >> 18];
+        out[1] = ALPHABET[(group >> 12) & 0x3F];
+        out[2] = rest == 2 ? ALPHABET[(group >> 6) & 0x3F] : '=';
+        out[3] = '=';
+    }
+} // namespace neocpp
+Bytes Base64::decode(const std::string& encoded) {
+    Bytes result(maxDecodedLength(encoded.size()));
+    size_t written = 0;
+    if (!decode(encoded, result.data(), written)) {
+        // Return empty for invalid input
+        return Bytes();
+    }
+    result.resize(written);
+    return result;
+} // namespace neocpp
+bool Base64::decode(std::string_view encoded, uint8_t* out, size_t& written) {
+    written = 0;
+    if (encoded.empty()) {
+        return true;
+    }
+
+    // Length must be a multiple of 4
+    if (encoded.size() % 4 != 0) {
+        return false;
+    }
+
+    // Everything but the last group has no padding
+    size_t body = encoded.size() - 4;
+    size_t done = codec().decode(encoded.data(), body, out);
+    if (!decodeScalar(encoded.data() + done, body - done, out + done / 4 * 3)) {
+        return false;
+    }
+    out += body / 4 * 3;
+
+    // The last group may end with one or two '='
+    const char* last = encoded.data() + body;
+    int a = TABLES.values[static_cast<uint8_t>(last[0])];
+    int b = TABLES.values[static_cast<uint8_t>(last[1])];
+    int c = last[2] == '=' && last[3] == '=' ? 0 : TABLES.values[static_cast<uint8_t>(last[2])];
+    int d = last[3] == '=' ? 0 : TABLES.values[static_cast<uint8_t>(last[3])];
+    if ((a | b | c | d) < 0) {
+        return false;
+    }
+    uint32_t group = (uint32_t(a) << 18) | (uint32_t(b) << 12) | (uint32_t(c) << 6) | uint32_t(d);
+    size_t size = last[3] != '=' ? 3 : last[2] != '=' ? 2 : 1;
+    out[0] = static_cast<uint8_t>(group >> 16);
+    if (size > 1) {
+        out[1] = static_cast<uint8_t>(group >> 8);
+    }
+    if (size > 2) {
+        out[2] = static_cast<uint8_t>(group);
+    }
+    written = body / 4 * 3 + size;
+    return true;
+} // namespace neocpp
 bool Base64::isValid(const std::string& str) {
     if (str.empty()) {
         return true;
@@ -91,32 +353,68 @@ bool Base64::isValid(const std::string& str) {
         return false;
     }
 
-    for (char c : str) {
-        if (!((c >= 'A' && c <= 'Z') ||
-              (c >= 'a' && c <= 'z') ||
-              (c >= '0' && c <= '9') ||
-              c == '+' || c == '/' || c == '=' ||
-              c == '-' || c == '_')) {  // URL-safe characters
-            return false;
-        }
-    }
-
-    // Check padding
-    size_t paddingStart = str.find('=');
-    if (paddingStart != std::string::npos) {
-        // Padding can only be at the end
-        for (size_t i = paddingStart; i < str.length(); ++i) {
-            if (str[i] != '=') {
-                return false;
-            }
+    // Only the last one or two characters may be padding
+    size_t size = str.length();
+    size_t padding = str[size - 1] != '=' ? 0 : str[size - 2] != '=' ? 1 : 2;
+    return std::all_of(str.begin(), str.end() - padding, [](char c) {
+        return TABLES.values[static_cast<uint8_t>(c)] >= 0;
+    });
+} // namespace neocpp
+const char* Base64::getImplementation() {
+    return codec().name;
+} // namespace neocpp
+Base64Encoder::Base64Encoder(std::string& out) : out_(out) {
+} // namespace neocpp
+void Base64Encoder::update(const uint8_t* data, size_t size) {
+    // Complete a group carried over from the previous update
+    if (pendingSize_ > 0) {
+        while (pendingSize_ < 3 && size > 0) {
+            pending_[pendingSize_++] = *data++;
+            --size;
         }
-        // Check valid padding amount (max 2 '=' at end)
-        size_t paddingCount = str.length() - paddingStart;
-        if (paddingCount > 2) {
-            return false;
+        if (pendingSize_ < 3) {
+            return;
         }
+        size_t offset = out_.size();
+        out_.resize(offset + 4);
+        encodeScalar(pending_, 3, &out_[offset]);
+        pendingSize_ = 0;
     }
 
-    return true;
+    size_t whole = size - size % 3;
+    if (whole > 0) {
+        size_t offset = out_.size();
+        out_.resize(offset + Base64::encodedLength(whole));
+        Base64::encode(data, whole, &out_[offset]);
+    }
+    for (size_t i = whole; i < size; ++i) {
+        pending_[pendingSize_++] = data[i];
+    }
+} // namespace neocpp
+void Base64Encoder::finish() {
+    if (pendingSize_ > 0) {
+        size_t offset = out_.size();
+        out_.resize(offset + 4);
+        Base64::encode(pending_, pendingSize_, &out_[offset]);
+        pendingSize_ = 0;
+    }
+} // namespace neocpp
+Base64OutputStream::Base64OutputStream(std::string& out) : std::ostream(nullptr), buffer_(out) {
+    rdbuf(&buffer_);
+} // namespace neocpp
+void Base64OutputStream::finish() {
+    buffer_.finish();
+} // namespace neocpp
+Base64OutputStream::Buffer::int_type Base64OutputStream::Buffer::overflow(int_type ch) {
+    if (traits_type::eq_int_type(ch, traits_type::eof())) {
+        return traits_type::not_eof(ch);
+    }
+    uint8_t byte = static_cast<uint8_t>(traits_type::to_char_type(ch));
+    encoder_.update(&byte, 1);
+    return ch;
+} // namespace neocpp
+std::streamsize Base64OutputStream::Buffer::xsputn(const char* data, std::streamsize size) {
+    encoder_.update(reinterpret_cast<const uint8_t*>(data), static_cast<size_t>(size));
+    return size;
 } // namespace neocpp
 } // namespace neocpp
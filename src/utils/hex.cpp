@@ -1,68 +1,286 @@
-
 #include "neocpp/utils/hex.hpp"
-#include <sstream>
-#include <iomanip>
 #include <algorithm>
-#include <stdexcept>
+#include <cstdint>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define NEOCPP_HEX_X86 1
+#include <immintrin.h>
+#endif
 
 namespace neocpp {
 
-std::string Hex::encode(const Bytes& data, bool uppercase) {
-    std::stringstream ss;
-    ss << std::hex << std::setfill('0');
+namespace {
+
+// Two characters per byte value for encoding, and nibble values (-1 = invalid) for decoding
+struct HexTables {
+    char lower[512];
+    char upper[512];
+    int8_t values[256];
+};
+
+constexpr HexTables makeTables() {
+    HexTables tables{};
+    const char lowerDigits[] = "0123456789abcdef";
+    const char upperDigits[] = "0123456789ABCDEF";
+    for (int i = 0; i < 256; ++i) {
+        tables.lower[2 * i] = lowerDigits[i >> 4];
+        tables.lower[2 * i + 1] = lowerDigits[i & 0x0F];
+        tables.upper[2 * i] = upperDigits[i >> 4];
+        tables.upper[2 * i + 1] = upperDigits[i & 0x0F];
+        tables.values[i] = -1;
+    }
+    for (int i = 0; i < 10; ++i) {
+        tables.values['0' + i] = static_cast<int8_t>(i);
+    }
+    for (int i = 0; i < 6; ++i) {
+        tables.values['a' + i] = static_cast<int8_t>(10 + i);
+        tables.values['A' + i] = static_cast<int8_t>(10 + i);
+    }
+    return tables;
+}
+
+constexpr HexTables TABLES = makeTables();
+
+// Marks an invalid character in a vectorized decode
+constexpr size_t INVALID = static_cast<size_t>(-1);
+
+void encodeScalar(const uint8_t* data, size_t size, char* out, bool uppercase) {
+    const char* table = uppercase ? TABLES.upper : TABLES.lower;
+    for (size_t i = 0; i < size; ++i) {
+        const char* pair = table + 2 * data[i];
+        out[2 * i] = pair[0];
+        out[2 * i + 1] = pair[1];
+    }
+}
+
+bool decodeScalar(const char* hex, size_t size, uint8_t* out) {
+    for (size_t i = 0; i < size; ++i) {
+        int hi = TABLES.values[static_cast<uint8_t>(hex[2 * i])];
+        int lo = TABLES.values[static_cast<uint8_t>(hex[2 * i + 1])];
+        if ((hi | lo) < 0) {
+            return false;
+        }
+        out[i] = static_cast<uint8_t>((hi << 4) | lo);
+    }
+    return true;
+}
 
-    if (uppercase) {
-        ss << std::uppercase;
+// Vectorized paths process whole blocks and return the number of bytes handled;
+// the caller finishes the tail with the scalar code.
+size_t encodeNone(const uint8_t*, size_t, char*, bool) {
+    return 0;
+}
+
+size_t decodeNone(const char*, size_t, uint8_t*) {
+    return 0;
+}
+
+#ifdef NEOCPP_HEX_X86
+
+// Nibbles 0..15 to ASCII: '0' + n, plus the distance to 'a' or 'A' for n > 9
+inline __m128i nibblesToAsciiSse2(__m128i nibbles, __m128i alphaOffset) {
+    __m128i ascii = _mm_add_epi8(nibbles, _mm_set1_epi8('0'));
+    __m128i isAlpha = _mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9));
+    return _mm_add_epi8(ascii, _mm_and_si128(isAlpha, alphaOffset));
+}
+
+// ASCII to nibbles; clears lanes of valid for characters that are not hex digits.
+// Range checks use unsigned min: x is in [0, limit] iff min(x, limit) == x.
+inline __m128i asciiToNibblesSse2(__m128i chars, __m128i& valid) {
+    __m128i digit = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+    __m128i isDigit = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+    __m128i alpha = _mm_sub_epi8(_mm_or_si128(chars, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    __m128i isAlpha = _mm_cmpeq_epi8(_mm_min_epu8(alpha, _mm_set1_epi8(5)), alpha);
+    valid = _mm_and_si128(valid, _mm_or_si128(isDigit, isAlpha));
+    return _mm_or_si128(_mm_and_si128(isDigit, digit),
+                        _mm_and_si128(isAlpha, _mm_add_epi8(alpha, _mm_set1_epi8(10))));
+}
+
+// Pairs of nibbles (high first) to one byte per 16-bit lane
+inline __m128i joinNibblesSse2(__m128i nibbles) {
+    __m128i hi = _mm_and_si128(nibbles, _mm_set1_epi16(0x00FF));
+    __m128i lo = _mm_srli_epi16(nibbles, 8);
+    return _mm_or_si128(_mm_slli_epi16(hi, 4), lo);
+}
+
+size_t encodeSse2(const uint8_t* data, size_t size, char* out, bool uppercase) {
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    const __m128i offset = _mm_set1_epi8(uppercase ? 'A' - '0' - 10 : 'a' - '0' - 10);
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        __m128i hi = _mm_and_si128(_mm_srli_epi16(in, 4), mask);
+        __m128i lo = _mm_and_si128(in, mask);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * i),
+                         nibblesToAsciiSse2(_mm_unpacklo_epi8(hi, lo), offset));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * i + 16),
+                         nibblesToAsciiSse2(_mm_unpackhi_epi8(hi, lo), offset));
     }
+    return i;
+}
 
-    for (const auto& byte : data) {
-        ss << std::setw(2) << static_cast<int>(byte);
+size_t decodeSse2(const char* hex, size_t size, uint8_t* out) {
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        __m128i valid = _mm_set1_epi8(-1);
+        __m128i first = asciiToNibblesSse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(hex + 2 * i)), valid);
+        __m128i second = asciiToNibblesSse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(hex + 2 * i + 16)), valid);
+        if (_mm_movemask_epi8(valid) != 0xFFFF) {
+            return INVALID;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                         _mm_packus_epi16(joinNibblesSse2(first), joinNibblesSse2(second)));
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+inline __m256i nibblesToAsciiAvx2(__m256i nibbles, __m256i alphaOffset) {
+    __m256i ascii = _mm256_add_epi8(nibbles, _mm256_set1_epi8('0'));
+    __m256i isAlpha = _mm256_cmpgt_epi8(nibbles, _mm256_set1_epi8(9));
+    return _mm256_add_epi8(ascii, _mm256_and_si256(isAlpha, alphaOffset));
+}
+
+__attribute__((target("avx2")))
+inline __m256i asciiToNibblesAvx2(__m256i chars, __m256i& valid) {
+    __m256i digit = _mm256_sub_epi8(chars, _mm256_set1_epi8('0'));
+    __m256i isDigit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+    __m256i alpha = _mm256_sub_epi8(_mm256_or_si256(chars, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+    __m256i isAlpha = _mm256_cmpeq_epi8(_mm256_min_epu8(alpha, _mm256_set1_epi8(5)), alpha);
+    valid = _mm256_and_si256(valid, _mm256_or_si256(isDigit, isAlpha));
+    return _mm256_or_si256(_mm256_and_si256(isDigit, digit),
+                           _mm256_and_si256(isAlpha, _mm256_add_epi8(alpha, _mm256_set1_epi8(10))));
+}
+
+__attribute__((target("avx2")))
+inline __m256i joinNibblesAvx2(__m256i nibbles) {
+    __m256i hi = _mm256_and_si256(nibbles, _mm256_set1_epi16(0x00FF));
+    __m256i lo = _mm256_srli_epi16(nibbles, 8);
+    return _mm256_or_si256(_mm256_slli_epi16(hi, 4), lo);
+}
+
+// AVX2 unpack and pack work within 128-bit lanes, so results are put back in order with
+// permute2x128 (encode) and permute4x64 (decode).
+__attribute__((target("avx2")))
+size_t encodeAvx2(const uint8_t* data, size_t size, char* out, bool uppercase) {
+    const __m256i mask = _mm256_set1_epi8(0x0F);
+    const __m256i offset = _mm256_set1_epi8(uppercase ? 'A' - '0' - 10 : 'a' - '0' - 10);
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        __m256i hi = _mm256_and_si256(_mm256_srli_epi16(in, 4), mask);
+        __m256i lo = _mm256_and_si256(in, mask);
+        __m256i first = nibblesToAsciiAvx2(_mm256_unpacklo_epi8(hi, lo), offset);
+        __m256i second = nibblesToAsciiAvx2(_mm256_unpackhi_epi8(hi, lo), offset);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 2 * i), _mm256_permute2x128_si256(first, second, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 2 * i + 32), _mm256_permute2x128_si256(first, second, 0x31));
+    }
+    return i + encodeSse2(data + i, size - i, out + 2 * i, uppercase);
+}
+
+__attribute__((target("avx2")))
+size_t decodeAvx2(const char* hex, size_t size, uint8_t* out) {
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        __m256i valid = _mm256_set1_epi8(-1);
+        __m256i first = asciiToNibblesAvx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(hex + 2 * i)), valid);
+        __m256i second = asciiToNibblesAvx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(hex + 2 * i + 32)), valid);
+        if (_mm256_movemask_epi8(valid) != -1) {
+            return INVALID;
+        }
+        __m256i packed = _mm256_packus_epi16(joinNibblesAvx2(first), joinNibblesAvx2(second));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_permute4x64_epi64(packed, 0xD8));
     }
+    size_t tail = decodeSse2(hex + 2 * i, size - i, out + i);
+    return tail == INVALID ? INVALID : i + tail;
+}
 
-    return ss.str();
+#endif // NEOCPP_HEX_X86
+
+struct HexCodec {
+    size_t (*encode)(const uint8_t*, size_t, char*, bool);
+    size_t (*decode)(const char*, size_t, uint8_t*);
+    const char* name;
+};
+
+HexCodec selectCodec() {
+#ifdef NEOCPP_HEX_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return {encodeAvx2, decodeAvx2, "avx2"};
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return {encodeSse2, decodeSse2, "sse2"};
+    }
+#endif
+    return {encodeNone, decodeNone, "scalar"};
+}
+
+const HexCodec& codec() {
+    static const HexCodec selected = selectCodec();
+    return selected;
+}
+
+std::string_view stripPrefix(std::string_view hex) {
+    if (hex.size() >= 2 && hex[0] == '0' && (hex[1] == 'x' || hex[1] == 'X')) {
+        hex.remove_prefix(2);
+    }
+    return hex;
+}
+
+bool decodeRaw(std::string_view hex, uint8_t* out) {
+    size_t size = hex.size() / 2;
+    size_t done = codec().decode(hex.data(), size, out);
+    if (done == INVALID) {
+        return false;
+    }
+    return decodeScalar(hex.data() + 2 * done, size - done, out + done);
+}
+
+} // namespace
+
+std::string Hex::encode(const Bytes& data, bool uppercase) {
+    return encode(data.data(), data.size(), uppercase);
+} // namespace neocpp
+std::string Hex::encode(const uint8_t* data, size_t size, bool uppercase) {
+    std::string result(size * 2, '\0');
+    encode(data, size, result.data(), uppercase);
+    return result;
+} // namespace neocpp
+void Hex::encode(const uint8_t* data, size_t size, char* out, bool uppercase) {
+    size_t done = codec().encode(data, size, out, uppercase);
+    encodeScalar(data + done, size - done, out + 2 * done, uppercase);
 } // namespace neocpp
 Bytes Hex::decode(const std::string& hex) {
-    std::string cleanHex = withoutPrefix(hex);
+    std::string_view cleanHex = stripPrefix(hex);
 
     // Return empty for odd-length strings
     if (cleanHex.length() % 2 != 0) {
         return Bytes();
     }
 
-    Bytes result;
-    result.reserve(cleanHex.length() / 2);
-
-    for (size_t i = 0; i < cleanHex.length(); i += 2) {
-        std::string byteString = cleanHex.substr(i, 2);
-
-        // Validate that both characters are valid hex
-        for (char c : byteString) {
-            if (!((c >= '0' && c <= '9') ||
-                  (c >= 'a' && c <= 'f') ||
-                  (c >= 'A' && c <= 'F'))) {
-                // Return empty for invalid hex characters
-                return Bytes();
-            }
-        }
-
-        uint8_t byte = static_cast<uint8_t>(std::stoul(byteString, nullptr, 16));
-        result.push_back(byte);
+    Bytes result(cleanHex.length() / 2);
+    if (!decodeRaw(cleanHex, result.data())) {
+        // Return empty for invalid hex characters
+        return Bytes();
     }
 
     return result;
 } // namespace neocpp
+bool Hex::decode(std::string_view hex, uint8_t* out, size_t size) {
+    std::string_view cleanHex = stripPrefix(hex);
+    if (cleanHex.length() != size * 2) {
+        return false;
+    }
+    return decodeRaw(cleanHex, out);
+} // namespace neocpp
 bool Hex::isValid(const std::string& str) {
     // Special case: just "0x" or "0X" with no data is invalid
     if (str == "0x" || str == "0X") {
         return false;
     }
 
-    std::string cleanStr = withoutPrefix(str);
-
-    if (cleanStr.empty()) {
-        // Empty string (no prefix) is valid, but "0x" alone is not
-        return str.empty() || (str != "0x" && str != "0X");
-    }
+    std::string_view cleanStr = stripPrefix(str);
 
     // Check for odd length (invalid hex must have even number of characters)
     if (cleanStr.length() % 2 != 0) {
@@ -71,9 +289,7 @@ bool Hex::isValid(const std::string& str) {
 
     // Check all characters are valid hex
     return std::all_of(cleanStr.begin(), cleanStr.end(), [](char c) {
-        return (c >= '0' && c <= '9') ||
-               (c >= 'a' && c <= 'f') ||
-               (c >= 'A' && c <= 'F');
+        return TABLES.values[static_cast<uint8_t>(c)] >= 0;
     });
 } // namespace neocpp
 std::string Hex::withPrefix(const std::string& hex) {
@@ -88,4 +304,7 @@ std::string Hex::withoutPrefix(const std::string& hex) {
     }
     return hex;
 } // namespace neocpp
+const char* Hex::getImplementation() {
+    return codec().name;
+} // namespace neocpp
 } // namespace neocpp
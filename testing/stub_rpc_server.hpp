@@ -0,0 +1,229 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <nlohmann/json.hpp>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace neocpp {
+namespace test {
+
+/// Minimal local JSON-RPC node stub served over HTTP on 127.0.0.1.
+///
+/// Every HTTP request is answered after a configurable delay, which makes round trips
+/// visible in latency tests. Batched JSON-RPC requests are answered element by element.
+class StubRpcServer {
+public:
+    /// Produces the `result` of one JSON-RPC call; throw to answer with an error
+    using Handler = std::function<nlohmann::json(const std::string& method, const nlohmann::json& params)>;
+
+    explicit StubRpcServer(Handler handler, std::chrono::milliseconds delay = std::chrono::milliseconds(0))
+        : handler_(std::move(handler)), delayMs_(delay.count()) {
+        listenFd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (listenFd_ < 0) {
+            throw std::runtime_error("StubRpcServer: socket() failed");
+        }
+        int enable = 1;
+        ::setsockopt(listenFd_, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = 0;
+        socklen_t length = sizeof(addr);
+        if (::bind(listenFd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+            ::listen(listenFd_, 512) != 0 ||
+            ::getsockname(listenFd_, reinterpret_cast<sockaddr*>(&addr), &length) != 0) {
+            ::close(listenFd_);
+            throw std::runtime_error("StubRpcServer: cannot listen on loopback");
+        }
+        port_ = ntohs(addr.sin_port);
+        acceptThread_ = std::thread([this]() { acceptLoop(); });
+    }
+
+    ~StubRpcServer() {
+        running_ = false;
+        if (acceptThread_.joinable()) {
+            acceptThread_.join();
+        }
+        ::close(listenFd_);
+        std::unique_lock<std::mutex> lock(connectionsMutex_);
+        connectionsDone_.wait(lock, [this]() { return openConnections_ == 0; });
+    }
+
+    StubRpcServer(const StubRpcServer&) = delete;
+    StubRpcServer& operator=(const StubRpcServer&) = delete;
+
+    /// URL to pass to NeoRpcClient
+    std::string getUrl() const { return "http://127.0.0.1:" + std::to_string(port_); }
+
+    /// Number of JSON-RPC calls answered (each batch element counts)
+    int getCallCount() const { return callCount_; }
+
+    /// Number of HTTP requests answered
+    int getHttpRequestCount() const { return httpCount_; }
+
+    /// Highest number of HTTP requests that were in flight at the same time
+    int getPeakConcurrency() const { return peakInFlight_; }
+
+    /// Number of calls answered for one method
+    int getCallCount(const std::string& method) const {
+        std::lock_guard<std::mutex> lock(methodsMutex_);
+        auto it = methodCounts_.find(method);
+        return it == methodCounts_.end() ? 0 : it->second;
+    }
+
+    void setDelay(std::chrono::milliseconds delay) { delayMs_ = delay.count(); }
+
+private:
+    Handler handler_;
+    std::atomic<long long> delayMs_;
+    int listenFd_ = -1;
+    uint16_t port_ = 0;
+    std::atomic<bool> running_{true};
+    std::thread acceptThread_;
+
+    std::atomic<int> callCount_{0};
+    std::atomic<int> httpCount_{0};
+    std::atomic<int> inFlight_{0};
+    std::atomic<int> peakInFlight_{0};
+    mutable std::mutex methodsMutex_;
+    std::map<std::string, int> methodCounts_;
+
+    std::mutex connectionsMutex_;
+    std::condition_variable connectionsDone_;
+    int openConnections_ = 0;
+
+    void acceptLoop() {
+        while (running_) {
+            pollfd pfd{listenFd_, POLLIN, 0};
+            if (::poll(&pfd, 1, 20) <= 0) {
+                continue;
+            }
+            int fd = ::accept(listenFd_, nullptr, nullptr);
+            if (fd < 0) {
+                continue;
+            }
+            {
+                std::lock_guard<std::mutex> lock(connectionsMutex_);
+                ++openConnections_;
+            }
+            std::thread([this, fd]() {
+                serve(fd);
+                ::close(fd);
+                std::lock_guard<std::mutex> lock(connectionsMutex_);
+                if (--openConnections_ == 0) {
+                    connectionsDone_.notify_all();
+                }
+            }).detach();
+        }
+    }
+
+    static bool sendAll(int fd, const std::string& data) {
+        size_t sent = 0;
+        while (sent < data.size()) {
+            ssize_t n = ::send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+            if (n <= 0) {
+                return false;
+            }
+            sent += static_cast<size_t>(n);
+        }
+        return true;
+    }
+
+    static std::string lower(std::string text) {
+        std::transform(text.begin(), text.end(), text.begin(), [](unsigned char c) { return std::tolower(c); });
+        return text;
+    }
+
+    void serve(int fd) {
+        std::string data;
+        char buffer[8192];
+        size_t headerEnd = std::string::npos;
+        while ((headerEnd = data.find("\r\n\r\n")) == std::string::npos) {
+            ssize_t n = ::recv(fd, buffer, sizeof(buffer), 0);
+            if (n <= 0) {
+                return;
+            }
+            data.append(buffer, static_cast<size_t>(n));
+        }
+
+        std::string headers = lower(data.substr(0, headerEnd));
+        size_t contentLength = 0;
+        size_t pos = headers.find("content-length:");
+        if (pos != std::string::npos) {
+            contentLength = std::stoul(headers.substr(pos + 15));
+        }
+        if (headers.find("expect: 100-continue") != std::string::npos) {
+            sendAll(fd, "HTTP/1.1 100 Continue\r\n\r\n");
+        }
+
+        std::string body = data.substr(headerEnd + 4);
+        while (body.size() < contentLength) {
+            ssize_t n = ::recv(fd, buffer, sizeof(buffer), 0);
+            if (n <= 0) {
+                return;
+            }
+            body.append(buffer, static_cast<size_t>(n));
+        }
+
+        int active = ++inFlight_;
+        int peak = peakInFlight_;
+        while (active > peak && !peakInFlight_.compare_exchange_weak(peak, active)) {
+        }
+
+        nlohmann::json request = nlohmann::json::parse(body, nullptr, false);
+        nlohmann::json response;
+        if (request.is_discarded()) {
+            response = {{"jsonrpc", "2.0"}, {"id", nullptr}, {"error", {{"code", -32700}, {"message", "Parse error"}}}};
+        } else if (request.is_array()) {
+            response = nlohmann::json::array();
+            for (const auto& call : request) {
+                response.push_back(answer(call));
+            }
+        } else {
+            response = answer(request);
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(delayMs_.load()));
+        --inFlight_;
+        ++httpCount_;
+
+        std::string payload = response.dump();
+        sendAll(fd, "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: " +
+                    std::to_string(payload.size()) + "\r\nConnection: close\r\n\r\n" + payload);
+    }
+
+    nlohmann::json answer(const nlohmann::json& call) {
+        nlohmann::json response = {{"jsonrpc", "2.0"}, {"id", call.value("id", nlohmann::json())}};
+        std::string method = call.value("method", "");
+        ++callCount_;
+        {
+            std::lock_guard<std::mutex> lock(methodsMutex_);
+            ++methodCounts_[method];
+        }
+        try {
+            response["result"] = handler_(method, call.value("params", nlohmann::json::array()));
+        } catch (const std::exception& e) {
+            response["error"] = {{"code", -32603}, {"message", e.what()}};
+        }
+        return response;
+    }
+};
+
+} // namespace test
+} // namespace neocpp
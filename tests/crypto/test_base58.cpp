@@ -140,4 +140,45 @@ TEST_CASE("Base58 Tests", "[crypto]") {
         REQUIRE(encoded2[0] == '1');
         REQUIRE(encoded2[1] == '1'); // Two leading zeros become "11"
     }
-}
\ No newline at end of file
+
+    SECTION("Fixed-width 25-byte payloads") {
+        // Payloads with 0..25 leading zero bytes, checked against the generic decoder
+        for (size_t zeros = 0; zeros <= Base58::FIXED_PAYLOAD_SIZE; ++zeros) {
+            Bytes payload(Base58::FIXED_PAYLOAD_SIZE, 0x00);
+            for (size_t i = zeros; i < payload.size(); ++i) {
+                payload[i] = static_cast<uint8_t>(0xFF - i * 11);
+            }
+
+            char out[Base58::FIXED_MAX_LENGTH];
+            std::string encoded(out, Base58::encodeFixed(payload.data(), out));
+            REQUIRE(Base58::decode(encoded) == payload);
+            REQUIRE(Base58::encode(payload) == encoded);
+
+            uint8_t decoded[Base58::FIXED_PAYLOAD_SIZE];
+            REQUIRE(Base58::decodeFixed(encoded, decoded));
+            REQUIRE(Bytes(decoded, decoded + sizeof(decoded)) == payload);
+        }
+
+        // Strings that decode to other sizes, or are not Base58, are rejected
+        uint8_t decoded[Base58::FIXED_PAYLOAD_SIZE];
+        REQUIRE_FALSE(Base58::decodeFixed(Base58::encode(Bytes(24, 0xAB)), decoded));
+        REQUIRE_FALSE(Base58::decodeFixed(Base58::encode(Bytes(26, 0x01)), decoded));
+        REQUIRE_FALSE(Base58::decodeFixed("1" + Base58::encode(Bytes(25, 0x01)), decoded));
+        REQUIRE_FALSE(Base58::decodeFixed("zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz", decoded));
+        REQUIRE_FALSE(Base58::decodeFixed("NZNos2WqTbu5oCgyfss9kUJgBXJqhuYAa0", decoded));
+        REQUIRE_FALSE(Base58::decodeFixed("", decoded));
+
+        // Checked variant
+        Bytes data(Base58::FIXED_DATA_SIZE, 0x35);
+        char out[Base58::FIXED_MAX_LENGTH];
+        std::string encoded(out, Base58::encodeCheckFixed(data.data(), out));
+        REQUIRE(encoded == Base58::encodeCheck(data));
+        REQUIRE(Base58::decodeCheck(encoded) == data);
+        uint8_t body[Base58::FIXED_DATA_SIZE];
+        REQUIRE(Base58::decodeCheckFixed(encoded, body));
+        REQUIRE(Bytes(body, body + sizeof(body)) == data);
+        encoded[5] = encoded[5] == 'a' ? 'b' : 'a';
+        REQUIRE_FALSE(Base58::decodeCheckFixed(encoded, body));
+        REQUIRE(Base58::decodeCheck(encoded).empty());
+    }
+}
@@ -1,6 +1,8 @@
 #include <catch2/catch_test_macros.hpp>
 #include "neocpp/utils/base64.hpp"
 #include "neocpp/utils/hex.hpp"
+#include "neocpp/serialization/binary_writer.hpp"
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -139,4 +141,105 @@ TEST_CASE("Base64 Tests", "[crypto]") {
         REQUIRE(threeByteEncoded == "QUJD");
         REQUIRE(Base64::decode(threeByteEncoded) == threeByteInput);
     }
-}
\ No newline at end of file
+
+    SECTION("Vectorized paths match a bitwise reference") {
+        const char* alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        auto reference = [&](const Bytes& data) {
+            std::string result;
+            for (size_t bit = 0; bit < data.size() * 8; bit += 6) {
+                int value = 0;
+                for (size_t i = bit; i < bit + 6; ++i) {
+                    int b = i < data.size() * 8 ? (data[i / 8] >> (7 - i % 8)) & 1 : 0;
+                    value = (value << 1) | b;
+                }
+                result += alphabet[value];
+            }
+            while (result.size() % 4 != 0) {
+                result += '=';
+            }
+            return result;
+        };
+
+        // Sizes around every block boundary of the SSSE3 and AVX2 loops
+        for (size_t size = 0; size < 200; ++size) {
+            Bytes data(size);
+            for (size_t i = 0; i < size; ++i) {
+                data[i] = static_cast<uint8_t>(i * 167 + size * 13 + 5);
+            }
+            std::string expected = reference(data);
+            REQUIRE(Base64::encode(data) == expected);
+            REQUIRE(Base64::encodedLength(size) == expected.size());
+
+            Bytes decoded(Base64::maxDecodedLength(expected.size()));
+            size_t written = 0;
+            REQUIRE(Base64::decode(expected, decoded.data(), written));
+            REQUIRE(written == size);
+            decoded.resize(written);
+            REQUIRE(decoded == data);
+        }
+    }
+
+    SECTION("Invalid characters are rejected at any position") {
+        Bytes data(150);
+        for (size_t i = 0; i < data.size(); ++i) {
+            data[i] = static_cast<uint8_t>(i * 31);
+        }
+        std::string encoded = Base64::encode(data);
+        for (size_t i = 0; i < encoded.size(); ++i) {
+            for (char bad : {'!', '=', '\x80', ' '}) {
+                std::string corrupted = encoded;
+                corrupted[i] = bad;
+                if (bad == '=' && i >= encoded.size() - 2) {
+                    continue;
+                }
+                REQUIRE(Base64::decode(corrupted).empty());
+            }
+        }
+        REQUIRE(Base64::decode("Zg=A").empty());
+    }
+
+    SECTION("URL-safe alphabet decodes like the standard one") {
+        Bytes data(120);
+        for (size_t i = 0; i < data.size(); ++i) {
+            data[i] = static_cast<uint8_t>(0xF8 + i);
+        }
+        std::string encoded = Base64::encode(data);
+        std::string urlSafe = encoded;
+        std::replace(urlSafe.begin(), urlSafe.end(), '+', '-');
+        std::replace(urlSafe.begin(), urlSafe.end(), '/', '_');
+        REQUIRE(urlSafe != encoded);
+        REQUIRE(Base64::decode(urlSafe) == data);
+    }
+
+    SECTION("Streaming encoder") {
+        Bytes data(100);
+        for (size_t i = 0; i < data.size(); ++i) {
+            data[i] = static_cast<uint8_t>(i * 7 + 3);
+        }
+
+        // Any chunking produces the one-shot encoding
+        for (size_t chunk : {size_t(1), size_t(2), size_t(4), size_t(5), size_t(33)}) {
+            std::string out = "prefix:";
+            Base64Encoder encoder(out);
+            for (size_t i = 0; i < data.size(); i += chunk) {
+                encoder.update(data.data() + i, std::min(chunk, data.size() - i));
+            }
+            encoder.finish();
+            REQUIRE(out == "prefix:" + Base64::encode(data));
+        }
+
+        // BinaryWriter output lands in the string as Base64
+        std::string body = "[\"";
+        Base64OutputStream stream(body);
+        BinaryWriter writer(stream);
+        writer.writeUInt32(0x01020304);
+        writer.writeVarBytes(data);
+        stream.finish();
+        body += "\"]";
+
+        BinaryWriter expected;
+        expected.writeUInt32(0x01020304);
+        expected.writeVarBytes(data);
+        REQUIRE(body == "[\"" + Base64::encode(expected.toArray()) + "\"]");
+    }
+}
@@ -0,0 +1,99 @@
+#include <catch2/catch_test_macros.hpp>
+#include "neocpp/crypto/bip32_ec_key_pair.hpp"
+#include "neocpp/types/hash160.hpp"
+#include "neocpp/utils/hex.hpp"
+#include "neocpp/exceptions.hpp"
+
+using namespace neocpp;
+
+TEST_CASE("Bip32ECKeyPair Tests", "[crypto]") {
+
+    auto master = Bip32ECKeyPair::fromSeed(Hex::decode("000102030405060708090a0b0c0d0e0f"));
+
+    SECTION("Parse derivation path") {
+        auto indices = Bip32ECKeyPair::parsePath("m/44'/888'/0'/0/7");
+        REQUIRE(indices.size() == 5);
+        REQUIRE(indices[0] == (44u | 0x80000000u));
+        REQUIRE(indices[1] == (888u | 0x80000000u));
+        REQUIRE(indices[2] == 0x80000000u);
+        REQUIRE(indices[3] == 0u);
+        REQUIRE(indices[4] == 7u);
+
+        REQUIRE(Bip32ECKeyPair::parsePath("m").empty());
+        REQUIRE_THROWS_AS(Bip32ECKeyPair::parsePath("44'/0"), IllegalArgumentException);
+        REQUIRE_THROWS_AS(Bip32ECKeyPair::parsePath("m/abc"), IllegalArgumentException);
+        REQUIRE_THROWS_AS(Bip32ECKeyPair::parsePath("m/4\xd9\xa4"), IllegalArgumentException);
+        REQUIRE_THROWS_AS(Bip32ECKeyPair::parsePath("m/2147483648"), IllegalArgumentException);
+    }
+
+    SECTION("Cached path derivation matches step-by-step derivation") {
+        auto account = master->deriveChild(44, true)->deriveChild(888, true)->deriveChild(0, true)->deriveChild(0);
+        for (uint32_t i = 0; i < 3; ++i) {
+            auto expected = account->deriveChild(i);
+            auto derived = master->derivePath("m/44'/888'/0'/0/" + std::to_string(i));
+            REQUIRE(derived->getPrivateKey()->getBytes() == expected->getPrivateKey()->getBytes());
+            REQUIRE(derived->getChainCode() == expected->getChainCode());
+            REQUIRE(derived->getDepth() == 5);
+        }
+
+        master->clearDerivationCache();
+        auto again = master->derivePath("m/44'/888'/0'/0/1");
+        REQUIRE(again->getPrivateKey()->getBytes() == account->deriveChild(1)->getPrivateKey()->getBytes());
+    }
+
+    SECTION("Public derivation matches private derivation") {
+        auto account = master->derivePath("m/44'/888'/0'/0");
+        auto xpub = account->getExtendedPublicKey();
+
+        for (uint32_t i : {0u, 1u, 1000u}) {
+            auto privateChild = account->deriveChild(i);
+            auto publicChild = xpub->deriveChild(i);
+            REQUIRE(publicChild->getEncodedPublicKey() == privateChild->getPublicKey()->getEncoded());
+            REQUIRE(publicChild->getChainCode() == privateChild->getChainCode());
+            REQUIRE(publicChild->getParentFingerprint() == privateChild->getParentFingerprint());
+            REQUIRE(publicChild->getAddress() == privateChild->getAddress());
+        }
+
+        REQUIRE(xpub->derivePath("M/3/4")->getEncodedPublicKey() ==
+                account->derivePath("m/3/4")->getPublicKey()->getEncoded());
+    }
+
+    SECTION("Extended public key round trip") {
+        auto account = master->derivePath("m/44'/888'/0'");
+        std::string encoded = account->toExtendedPublicKey();
+        auto imported = Bip32ExtendedPublicKey::fromExtendedPublicKey(encoded);
+
+        REQUIRE(imported->getEncodedPublicKey() == account->getPublicKey()->getEncoded());
+        REQUIRE(imported->getChainCode() == account->getChainCode());
+        REQUIRE(imported->getDepth() == account->getDepth());
+        REQUIRE(imported->getChildNumber() == account->getChildNumber());
+        REQUIRE(imported->toExtendedPublicKey() == encoded);
+
+        REQUIRE_THROWS_AS(Bip32ExtendedPublicKey::fromExtendedPublicKey(account->toExtendedPrivateKey()),
+                          IllegalArgumentException);
+    }
+
+    SECTION("Hardened derivation from extended public key throws") {
+        auto xpub = master->getExtendedPublicKey();
+        REQUIRE_THROWS_AS(xpub->deriveChild(0x80000000u), IllegalArgumentException);
+        REQUIRE_THROWS_AS(xpub->derivePath("M/0'"), IllegalArgumentException);
+    }
+
+    SECTION("Batch derivation matches single derivation") {
+        auto xpub = master->derivePath("m/44'/888'/0'/0")->getExtendedPublicKey();
+
+        auto hashes = xpub->deriveScriptHashes(10, 25, 3);
+        auto addresses = xpub->deriveAddresses(10, 25, 2);
+        REQUIRE(hashes.size() == 25);
+        REQUIRE(addresses.size() == 25);
+
+        for (uint32_t i = 0; i < 25; ++i) {
+            auto child = xpub->deriveChild(10 + i);
+            REQUIRE(hashes[i] == Hash160::fromPublicKey(child->getEncodedPublicKey()));
+            REQUIRE(addresses[i] == child->getPublicKey()->getAddress());
+        }
+
+        REQUIRE(xpub->deriveScriptHashes(0, 0).empty());
+        REQUIRE_THROWS_AS(xpub->deriveScriptHashes(0x7FFFFFFFu, 2), IllegalArgumentException);
+    }
+}
@@ -0,0 +1,91 @@
+#include <catch2/catch_test_macros.hpp>
+#include "neocpp/crypto/bip39.hpp"
+#include "neocpp/utils/hex.hpp"
+#include "neocpp/exceptions.hpp"
+
+using namespace neocpp;
+
+TEST_CASE("Bip39 Tests", "[crypto]") {
+
+    SECTION("Word index lookup") {
+        const auto& words = Bip39::getWordList();
+        REQUIRE(words.size() == 2048);
+        REQUIRE(Bip39::getWordIndex("abandon") == 0);
+        REQUIRE(Bip39::getWordIndex("ability") == 1);
+        for (int i : {2, 57, 103, 1000, 2047}) {
+            REQUIRE(Bip39::getWordIndex(words[i]) == i);
+        }
+        REQUIRE(Bip39::getWordIndex("notaword") == -1);
+        REQUIRE(Bip39::getWordIndex("") == -1);
+    }
+
+    SECTION("Entropy round trip for all strengths") {
+        for (size_t bytes : {16u, 20u, 24u, 28u, 32u}) {
+            Bytes entropy(bytes);
+            for (size_t i = 0; i < bytes; ++i) {
+                entropy[i] = static_cast<uint8_t>(i * 37 + 11);
+            }
+
+            std::string mnemonic = Bip39::generateMnemonic(entropy);
+            REQUIRE(Bip39::splitMnemonic(mnemonic).size() == bytes * 3 / 4);
+            REQUIRE(Bip39::validateMnemonic(mnemonic));
+            REQUIRE(Bip39::mnemonicToEntropy(mnemonic) == entropy);
+        }
+    }
+
+    SECTION("All-zero entropy maps to the first word") {
+        std::string mnemonic = Bip39::generateMnemonic(Bytes(16, 0));
+        REQUIRE(mnemonic.rfind("abandon abandon abandon", 0) == 0);
+        REQUIRE(Bip39::mnemonicToEntropy(mnemonic) == Bytes(16, 0));
+    }
+
+    SECTION("Invalid mnemonics are rejected") {
+        std::string mnemonic = Bip39::generateMnemonic(Hex::decode("00112233445566778899aabbccddeeff"));
+        auto words = Bip39::splitMnemonic(mnemonic);
+
+        // Swapping the last word breaks the checksum
+        auto tampered = words;
+        tampered.back() = tampered.back() == "abandon" ? "ability" : "abandon";
+        std::string tamperedMnemonic = Bip39::joinWords(tampered);
+        REQUIRE_FALSE(Bip39::validateMnemonic(tamperedMnemonic));
+        REQUIRE_THROWS_AS(Bip39::mnemonicToEntropy(tamperedMnemonic), IllegalArgumentException);
+
+        REQUIRE_FALSE(Bip39::validateMnemonic(""));
+        REQUIRE_FALSE(Bip39::validateMnemonic(mnemonic + " "));
+        REQUIRE_FALSE(Bip39::validateMnemonic("  " + mnemonic));
+        REQUIRE_FALSE(Bip39::validateMnemonic(Bip39::joinWords({words.begin(), words.begin() + 9})));
+        REQUIRE_FALSE(Bip39::validateMnemonic(mnemonic + " notaword"));
+        REQUIRE_THROWS_AS(Bip39::mnemonicToEntropy("abandon notaword abandon"), IllegalArgumentException);
+
+        // Entropy recovery tolerates irregular whitespace
+        std::string spaced = "  " + words[0];
+        for (size_t i = 1; i < words.size(); ++i) {
+            spaced += "\t " + words[i];
+        }
+        REQUIRE(Bip39::mnemonicToEntropy(spaced) == Hex::decode("00112233445566778899aabbccddeeff"));
+    }
+
+    SECTION("Batch seed derivation matches single derivation") {
+        std::vector<std::string> mnemonics;
+        for (uint8_t i = 0; i < 6; ++i) {
+            mnemonics.push_back(Bip39::generateMnemonic(Bytes(16, i)));
+        }
+
+        auto seeds = Bip39::mnemonicToSeedBatch(mnemonics, "TREZOR", 3);
+        REQUIRE(seeds.size() == mnemonics.size());
+        for (size_t i = 0; i < mnemonics.size(); ++i) {
+            REQUIRE(seeds[i].size() == 64);
+            REQUIRE(seeds[i] == Bip39::mnemonicToSeed(mnemonics[i], "TREZOR"));
+        }
+
+        REQUIRE(Bip39::mnemonicToSeedBatch({}).empty());
+    }
+
+    SECTION("Known PBKDF2 seed vector") {
+        // BIP39 reference vector for the all-zero 128-bit entropy mnemonic
+        std::string mnemonic = "abandon abandon abandon abandon abandon abandon "
+                               "abandon abandon abandon abandon abandon about";
+        REQUIRE(Hex::encode(Bip39::mnemonicToSeed(mnemonic, "TREZOR")) ==
+                "c55257c360c07c72029aebc1b53c05ed0362ada38ead3e3e9efa3708e53495531f09a6987599d18264c1e1c92f2cf141630c7a3c4ab7c81b2f001698e7463b04");
+    }
+}
@@ -0,0 +1,196 @@
+#include <catch2/catch_test_macros.hpp>
+#include "neocpp/logger.hpp"
+#include "neocpp/log_sink.hpp"
+#include "neocpp/exceptions.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace neocpp;
+
+namespace {
+
+/// Collects records; optionally holds the writer until released
+class CollectingSink : public LogSink {
+public:
+    void write(const LogRecord& record) override {
+        std::unique_lock<std::mutex> lock(mutex_);
+        released_.wait(lock, [this]() { return open_; });
+        records.push_back(record);
+    }
+
+    void hold() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        open_ = false;
+    }
+
+    void release() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            open_ = true;
+        }
+        released_.notify_all();
+    }
+
+    std::vector<LogRecord> records;
+
+private:
+    std::mutex mutex_;
+    std::condition_variable released_;
+    bool open_ = true;
+};
+
+} // namespace
+
+TEST_CASE("Log Sink Tests", "[logger]") {
+    auto originalLevel = Logger::getLevel();
+    Logger::setLevel(LogLevel::INFO);
+    auto sink = std::make_shared<CollectingSink>();
+    Logger::setSinks({sink});
+
+    SECTION("Formatting with structured fields") {
+        LogRecord record;
+        record.level = LogLevel::WARN;
+        record.time = std::chrono::system_clock::now();
+        record.message = "Block callback error";
+        record.fields = {{"block", "42"}, {"error", "connection \"refused\""}, {"empty", ""}};
+        record.file = "/src/protocol/block_polling.cpp";
+        record.line = 7;
+
+        std::string line = LogSink::format(record);
+        REQUIRE(line.find("[WARN ] [block_polling.cpp:7] Block callback error block=42 "
+                          "error=\"connection \\\"refused\\\"\" empty=\"\"") != std::string::npos);
+        REQUIRE(LogSink::format(record, true).rfind("\033[33m", 0) == 0);
+    }
+
+    SECTION("Synchronous sinks receive fields") {
+        NEOCPP_LOG_FIELDS(LogLevel::INFO, "sync", {"key", "value"});
+        NEOCPP_LOG_FIELDS(LogLevel::DEBUG, "filtered", {"key", "value"});
+        REQUIRE(sink->records.size() == 1);
+        REQUIRE(sink->records[0].message == "sync");
+        REQUIRE(sink->records[0].fields == LogFields{{"key", "value"}});
+        REQUIRE(sink->records[0].line > 0);
+    }
+
+    SECTION("Asynchronous writer keeps per-thread order") {
+        Logger::startAsync();
+        REQUIRE(Logger::isAsync());
+        REQUIRE_THROWS_AS(Logger::startAsync(), IllegalStateException);
+
+        const int threadCount = 4;
+        const int perThread = 500;
+        std::vector<std::thread> threads;
+        for (int t = 0; t < threadCount; ++t) {
+            threads.emplace_back([t]() {
+                for (int i = 0; i < perThread; ++i) {
+                    NEOCPP_LOG_FIELDS(LogLevel::INFO, "async", {"thread", std::to_string(t)}, {"i", std::to_string(i)});
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        Logger::flush();
+        REQUIRE(sink->records.size() == threadCount * perThread);
+
+        std::map<std::string, int> next;
+        for (const auto& record : sink->records) {
+            int& expected = next[record.fields[0].second];
+            REQUIRE(record.fields[1].second == std::to_string(expected));
+            ++expected;
+        }
+        Logger::stopAsync();
+        REQUIRE_FALSE(Logger::isAsync());
+    }
+
+    SECTION("Drop policy counts and reports discarded records") {
+        uint64_t droppedBefore = Logger::getDroppedCount();
+        sink->hold();
+        Logger::startAsync({4, LogOverflowPolicy::DROP});
+        for (int i = 0; i < 100; ++i) {
+            LOG_INFO("burst");
+        }
+        uint64_t dropped = Logger::getDroppedCount() - droppedBefore;
+        REQUIRE(dropped > 0);
+        sink->release();
+        Logger::stopAsync();
+
+        size_t written = 0;
+        bool reported = false;
+        for (const auto& record : sink->records) {
+            if (record.message == "burst") {
+                ++written;
+            } else if (record.level == LogLevel::WARN && !record.fields.empty() && record.fields[0].first == "dropped") {
+                reported = true;
+            }
+        }
+        REQUIRE(written + dropped == 100);
+        REQUIRE(reported);
+    }
+
+    SECTION("Block policy loses nothing") {
+        uint64_t droppedBefore = Logger::getDroppedCount();
+        Logger::startAsync({2, LogOverflowPolicy::BLOCK});
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([]() {
+                for (int i = 0; i < 200; ++i) {
+                    LOG_INFO("blocking");
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        Logger::stopAsync();
+        REQUIRE(sink->records.size() == 800);
+        REQUIRE(Logger::getDroppedCount() == droppedBefore);
+    }
+
+    SECTION("Rotating file sink") {
+        std::string path = "/tmp/neocpp_test_log_sink.log";
+        for (const auto& file : {path, path + ".1", path + ".2", path + ".3"}) {
+            std::remove(file.c_str());
+        }
+        {
+            auto fileSink = std::make_shared<RotatingFileLogSink>(path, 300, 2);
+            Logger::setSinks({fileSink});
+            for (int i = 0; i < 40; ++i) {
+                NEOCPP_LOG_FIELDS(LogLevel::INFO, "rotating", {"i", std::to_string(i)});
+            }
+            fileSink->flush();
+            Logger::setSinks({});
+        }
+
+        std::ifstream current(path);
+        std::string firstLine;
+        REQUIRE(std::getline(current, firstLine));
+        REQUIRE(firstLine.find("rotating") != std::string::npos);
+        REQUIRE(std::ifstream(path + ".1").good());
+        REQUIRE(std::ifstream(path + ".2").good());
+        REQUIRE_FALSE(std::ifstream(path + ".3").good());
+
+        std::ifstream last(path);
+        last.seekg(0, std::ios::end);
+        REQUIRE(static_cast<size_t>(last.tellg()) <= 300);
+
+        for (const auto& file : {path, path + ".1", path + ".2"}) {
+            std::remove(file.c_str());
+        }
+        REQUIRE_THROWS_AS(RotatingFileLogSink("/nonexistent-dir/neocpp.log"), RuntimeException);
+    }
+
+    SECTION("Invalid options") {
+        REQUIRE_THROWS_AS(Logger::startAsync({0, LogOverflowPolicy::DROP}), IllegalArgumentException);
+        REQUIRE_THROWS_AS(Logger::addSink(nullptr), IllegalArgumentException);
+    }
+
+    Logger::stopAsync();
+    Logger::setSinks({});
+    Logger::setLevel(originalLevel);
+}
@@ -93,4 +93,38 @@ TEST_CASE("Logger", "[logger]") {
         
         Logger::setLevel(originalLevel);
     }
-}
\ No newline at end of file
+
+    SECTION("Macros check the level before building the message") {
+        auto originalLevel = Logger::getLevel();
+        int evaluated = 0;
+        auto message = [&]() {
+            ++evaluated;
+            return std::string("lazy message");
+        };
+
+        Logger::setLevel(LogLevel::ERROR);
+        REQUIRE_FALSE(Logger::isEnabled(LogLevel::DEBUG));
+        REQUIRE(Logger::isEnabled(LogLevel::FATAL));
+        LOG_DEBUG(message());
+        LOG_WARN(message());
+        REQUIRE(evaluated == 0);
+
+        // Capture stdout to check the formatted line
+        std::ostringstream captured;
+        auto* original = std::cout.rdbuf(captured.rdbuf());
+        Logger::setColorEnabled(false);
+        Logger::setLevel(LogLevel::DEBUG);
+        LOG_DEBUG(message());
+        std::cout.rdbuf(original);
+        Logger::setColorEnabled(true);
+        REQUIRE(evaluated == 1);
+        std::string line = captured.str();
+        REQUIRE(line.find("[DEBUG] [test_logger.cpp:") != std::string::npos);
+        REQUIRE(line.size() > 20);
+        REQUIRE(line.compare(line.size() - 13, 13, "lazy message\n") == 0);
+
+        Logger::setLevel(LogLevel::OFF);
+        REQUIRE_FALSE(Logger::isEnabled(LogLevel::FATAL));
+        Logger::setLevel(originalLevel);
+    }
+}
@@ -0,0 +1,148 @@
+#include <catch2/catch_test_macros.hpp>
+#include "neocpp/script/script_template.hpp"
+#include "neocpp/script/script_builder.hpp"
+#include "neocpp/types/contract_parameter.hpp"
+#include "neocpp/types/hash160.hpp"
+#include "neocpp/types/hash256.hpp"
+#include "neocpp/crypto/ec_key_pair.hpp"
+#include "neocpp/exceptions.hpp"
+#include <string>
+
+using namespace neocpp;
+
+TEST_CASE("ScriptTemplate Tests", "[script]") {
+
+    using Argument = ScriptTemplate::Argument;
+    using SlotType = ScriptTemplate::SlotType;
+
+    Hash160 token("d2a4cff31913016155e38e474a2c06d08be276cf");
+    Hash160 from("23ba2703c53263e8d6e522dc32203339dcd8eee9");
+    Hash160 to("969a77db482f74ce27105f760efa139223431394");
+
+    SECTION("Instances match ScriptBuilder output") {
+        auto transfer = ScriptTemplate::contractCall(token, "transfer", {
+            Argument::slot("from", SlotType::HASH160),
+            Argument::slot("to", SlotType::HASH160),
+            Argument::slot("amount", SlotType::INTEGER),
+            Argument::slot("data", SlotType::STRING)
+        });
+        REQUIRE(transfer.getSlots().size() == 4);
+
+        auto values = transfer.newValues();
+        Bytes script;
+        const int64_t amounts[] = {-1, 0, 16, 17, -128, 127, 128, -32769, 32767, 65536,
+                                   2147483647LL, 2147483648LL, -1099511627776LL};
+        const size_t dataLengths[] = {0, 1, 75, 76, 255, 256, 70000};
+        for (int64_t amount : amounts) {
+            for (size_t length : dataLengths) {
+                std::string data(length, 'x');
+                values.setHash160(transfer.getSlotIndex("from"), from)
+                      .setHash160(transfer.getSlotIndex("to"), to)
+                      .setInteger(transfer.getSlotIndex("amount"), amount)
+                      .setString(transfer.getSlotIndex("data"), data);
+                transfer.instantiate(values, script);
+
+                ScriptBuilder builder;
+                builder.callContract(token, "transfer", {
+                    ContractParameter::hash160(from),
+                    ContractParameter::hash160(to),
+                    ContractParameter::integer(amount),
+                    ContractParameter::string(data)
+                });
+                REQUIRE(script == builder.toArray());
+            }
+        }
+    }
+
+    SECTION("All slot types and constants") {
+        auto keyPair = ECKeyPair::generate();
+        Bytes key = keyPair.getPublicKey()->getEncoded();
+        Hash256 hash("0xb804a98220c69ab4674bc7b5b0bb0a4e4b6e8d5e5f3c4b1e3a7d6c8b9e0f1a2b");
+        Bytes blob = {0x01, 0x02, 0x03};
+
+        ScriptTemplate tpl;
+        tpl.pushSlot("flag", SlotType::BOOLEAN)
+           .pushSlot("key", SlotType::PUBLIC_KEY)
+           .push(ContractParameter::integer(42))
+           .pushSlot("hash", SlotType::HASH256)
+           .pushSlot("blob", SlotType::BYTE_ARRAY)
+           .emit(OpCode::DROP)
+           .pushSlot("flag", SlotType::BOOLEAN);
+        REQUIRE(tpl.getSlots().size() == 4);
+
+        auto values = tpl.newValues();
+        values.set("flag", ContractParameter::boolean(true))
+              .set("key", ContractParameter::publicKey(keyPair.getPublicKey()))
+              .set("hash", ContractParameter::hash256(hash))
+              .set("blob", ContractParameter::byteArray(blob));
+
+        ScriptBuilder builder;
+        builder.pushBool(true)
+               .pushData(key)
+               .pushInteger(42)
+               .pushData(hash.toLittleEndianArray())
+               .pushData(blob)
+               .emit(OpCode::DROP)
+               .pushBool(true);
+        REQUIRE(tpl.instantiate(values) == builder.toArray());
+    }
+
+    SECTION("Contract hash slot and appended templates") {
+        ScriptTemplate batch;
+        batch.callContract("token", "transfer", {
+                 Argument::constant(ContractParameter::hash160(from)),
+                 Argument::slot("to", SlotType::HASH160),
+                 Argument::slot("amount", SlotType::INTEGER),
+                 Argument::null()})
+             .emit(OpCode::ASSERT);
+        batch.append(ScriptTemplate::contractCall(token, "balanceOf", {Argument::slot("to", SlotType::HASH160)}));
+        REQUIRE(batch.getSlots().size() == 3);
+
+        auto values = batch.newValues();
+        values.setHash160(batch.getSlotIndex("token"), token)
+              .setHash160(batch.getSlotIndex("to"), to)
+              .setInteger(batch.getSlotIndex("amount"), 1000);
+
+        ScriptBuilder builder;
+        builder.pushNull()
+               .pushInteger(1000)
+               .pushData(to.toLittleEndianArray())
+               .pushData(from.toLittleEndianArray())
+               .callContract(token, "transfer", {})
+               .emit(OpCode::ASSERT)
+               .callContract(token, "balanceOf", {ContractParameter::hash160(to)});
+        REQUIRE(batch.instantiate(values) == builder.toArray());
+    }
+
+    SECTION("Buffers are reused") {
+        auto tpl = ScriptTemplate::contractCall(token, "balanceOf", {Argument::slot("account", SlotType::HASH160)});
+        auto values = tpl.newValues();
+        values.setHash160(0, from);
+
+        Bytes script;
+        tpl.instantiate(values, script);
+        const uint8_t* buffer = script.data();
+        values.setHash160(0, to);
+        tpl.instantiate(values, script);
+        REQUIRE(script.data() == buffer);
+        REQUIRE(script == ScriptBuilder().callContract(token, "balanceOf", {ContractParameter::hash160(to)}).toArray());
+    }
+
+    SECTION("Invalid use is rejected") {
+        ScriptTemplate tpl;
+        tpl.pushSlot("amount", SlotType::INTEGER);
+        REQUIRE_THROWS_AS(tpl.pushSlot("amount", SlotType::STRING), IllegalArgumentException);
+        REQUIRE_THROWS_AS(tpl.pushSlot("", SlotType::STRING), IllegalArgumentException);
+        REQUIRE_THROWS_AS(tpl.getSlotIndex("missing"), IllegalArgumentException);
+
+        auto values = tpl.newValues();
+        REQUIRE_THROWS_AS(tpl.instantiate(values), IllegalStateException);
+        REQUIRE_THROWS_AS(values.setString(0, "1"), IllegalArgumentException);
+        REQUIRE_THROWS_AS(values.setInteger(1, 1), IllegalArgumentException);
+
+        ScriptTemplate other;
+        other.pushSlot("amount", SlotType::INTEGER);
+        values.setInteger(0, 5);
+        REQUIRE_THROWS_AS(other.instantiate(values), IllegalArgumentException);
+    }
+}
@@ -0,0 +1,97 @@
+#include <catch2/catch_test_macros.hpp>
+#include "neocpp/transaction/transaction.hpp"
+#include "neocpp/transaction/transaction_attribute.hpp"
+#include "neocpp/transaction/signer.hpp"
+#include "neocpp/transaction/witness.hpp"
+#include "neocpp/transaction/witness_rule.hpp"
+#include "neocpp/contract/nef_file.hpp"
+#include "neocpp/types/hash160.hpp"
+#include "neocpp/types/hash256.hpp"
+
+using namespace neocpp;
+
+namespace {
+    template<typename T>
+    void requireSizeMatchesSerialization(const T& value) {
+        BinaryWriter writer;
+        value.serialize(writer);
+        REQUIRE(value.getSize() == writer.size());
+        REQUIRE(value.toArray() == writer.toArray());
+    }
+}
+
+TEST_CASE("NeoSerializable Size Tests", "[serialization]") {
+
+    Hash160 account("23ba2703c53263e8d6e522dc32203339dcd8eee9");
+    Hash160 contract("d2a4cff31913016155e38e474a2c06d08be276cf");
+
+    SECTION("Witness conditions and rules") {
+        requireSizeMatchesSerialization(*WitnessCondition::boolean(true));
+        requireSizeMatchesSerialization(*WitnessCondition::calledByEntry());
+        requireSizeMatchesSerialization(*WitnessCondition::scriptHash(contract));
+        requireSizeMatchesSerialization(*WitnessCondition::notCondition(WitnessCondition::calledByEntry()));
+
+        // 300 conditions need a three-byte count
+        std::vector<SharedPtr<WitnessCondition>> conditions;
+        for (int i = 0; i < 300; ++i) {
+            conditions.push_back(WitnessCondition::boolean(i % 2 == 0));
+        }
+        requireSizeMatchesSerialization(*WitnessCondition::andCondition(conditions));
+        requireSizeMatchesSerialization(*WitnessCondition::orCondition(conditions));
+        requireSizeMatchesSerialization(WitnessRule(WitnessRuleAction::ALLOW, WitnessCondition::andCondition(conditions)));
+    }
+
+    SECTION("Signers with every scope") {
+        requireSizeMatchesSerialization(Signer(account, WitnessScope::CALLED_BY_ENTRY));
+        requireSizeMatchesSerialization(Signer(account, WitnessScope::GLOBAL));
+
+        auto scopes = static_cast<WitnessScope>(0x10 | 0x20 | 0x40);
+        Signer signer(account, scopes);
+        for (int i = 0; i < 16; ++i) {
+            signer.addAllowedContract(contract);
+            signer.addAllowedGroup(Bytes(33, static_cast<uint8_t>(0x02 + (i % 2))));
+            signer.addRule(std::make_shared<WitnessRule>(WitnessRuleAction::DENY, WitnessCondition::scriptHash(contract)));
+        }
+        requireSizeMatchesSerialization(signer);
+    }
+
+    SECTION("Witnesses") {
+        requireSizeMatchesSerialization(Witness(Bytes(), Bytes()));
+        requireSizeMatchesSerialization(Witness(Bytes(66, 0x01), Bytes(40, 0x02)));
+        requireSizeMatchesSerialization(Witness(Bytes(300, 0x01), Bytes(70000, 0x02)));
+    }
+
+    SECTION("Attributes") {
+        requireSizeMatchesSerialization(HighPriorityAttribute());
+        requireSizeMatchesSerialization(NotValidBeforeAttribute(12345));
+        requireSizeMatchesSerialization(ConflictsAttribute(Hash256("0xb804a98220c69ab4674bc7b5b0bb0a4e4b6e8d5e5f3c4b1e3a7d6c8b9e0f1a2b")));
+        requireSizeMatchesSerialization(OracleResponseAttribute(7, 0, Bytes(10, 0xAA)));
+        requireSizeMatchesSerialization(OracleResponseAttribute(7, 0, Bytes(0x10000, 0xAA)));
+    }
+
+    SECTION("NEF files") {
+        requireSizeMatchesSerialization(NefFile(Bytes{0x11, 0x40}));
+        requireSizeMatchesSerialization(NefFile(Bytes(1000, 0x21)));
+    }
+
+    SECTION("Transactions") {
+        Transaction transaction;
+        requireSizeMatchesSerialization(transaction);
+
+        transaction.setScript(Bytes(300, 0x21));
+        transaction.addSigner(std::make_shared<Signer>(account));
+        auto custom = std::make_shared<Signer>(contract, WitnessScope::CUSTOM_CONTRACTS);
+        custom->addAllowedContract(account);
+        transaction.addSigner(custom);
+        transaction.addAttribute(std::make_shared<HighPriorityAttribute>());
+        transaction.addAttribute(std::make_shared<NotValidBeforeAttribute>(10));
+        transaction.addWitness(std::make_shared<Witness>(Bytes(66, 0x0C), Bytes(40, 0x0C)));
+        transaction.addWitness(std::make_shared<Witness>(Bytes(66, 0x0C), Bytes(300, 0x0C)));
+        requireSizeMatchesSerialization(transaction);
+
+        BinaryWriter unsignedWriter;
+        transaction.serializeUnsigned(unsignedWriter);
+        REQUIRE(transaction.getUnsignedSize() == unsignedWriter.size());
+        REQUIRE(transaction.getHashData() == unsignedWriter.toArray());
+    }
+}
@@ -0,0 +1,163 @@
+#include <catch2/catch_test_macros.hpp>
+#include "neocpp/transaction/contract_parameters_context.hpp"
+#include "neocpp/transaction/transaction.hpp"
+#include "neocpp/transaction/signer.hpp"
+#include "neocpp/transaction/witness.hpp"
+#include "neocpp/transaction/network_fee_calculator.hpp"
+#include "neocpp/wallet/account.hpp"
+#include "neocpp/crypto/ec_key_pair.hpp"
+#include "neocpp/crypto/ecdsa_signature.hpp"
+#include "neocpp/script/script_builder.hpp"
+#include "neocpp/utils/hex.hpp"
+#include "neocpp/exceptions.hpp"
+#include <algorithm>
+
+using namespace neocpp;
+
+TEST_CASE("ContractParametersContext Tests", "[transaction]") {
+
+    // A 2-of-3 multi-sig account plus a single-sig co-signer
+    std::vector<SharedPtr<Account>> owners = {Account::create(), Account::create(), Account::create()};
+    std::vector<Bytes> keys;
+    for (const auto& owner : owners) {
+        keys.push_back(owner->getKeyPair()->getPublicKey()->getEncoded());
+    }
+    Bytes multiSigScript = ScriptBuilder::buildMultiSigVerificationScript(keys, 2);
+    Hash160 multiSigHash = Hash160::fromScript(multiSigScript);
+    auto payer = Account::create();
+
+    auto transaction = std::make_shared<Transaction>();
+    transaction->setNonce(1);
+    transaction->setValidUntilBlock(1000);
+    transaction->setScript(Bytes{0x11, 0x40});
+    transaction->addSigner(std::make_shared<Signer>(payer->getScriptHash()));
+    transaction->addSigner(std::make_shared<Signer>(multiSigHash));
+    Bytes hash = transaction->getHash().toArray();
+
+    auto newContext = [&]() {
+        auto context = std::make_shared<ContractParametersContext>(transaction);
+        context->setVerificationScript(multiSigScript);
+        return context;
+    };
+
+    SECTION("Signatures follow public key order and merge across parties") {
+        auto first = newContext();
+        auto second = newContext();
+        REQUIRE(first->sign(owners[2]));
+        REQUIRE(second->sign(owners[0]));
+        REQUIRE(second->sign(payer));
+        REQUIRE_FALSE(first->isComplete(multiSigHash));
+
+        // Exchange via the binary format
+        auto received = ContractParametersContext::fromArray(second->toArray());
+        REQUIRE(first->merge(*received) == 2);
+        REQUIRE(first->merge(*received) == 0);
+        REQUIRE(first->isComplete());
+
+        auto witness = first->getWitness(multiSigHash);
+        REQUIRE(witness->getVerificationScript() == multiSigScript);
+        const Bytes& invocation = witness->getInvocationScript();
+        REQUIRE(invocation.size() == 2 * 65);
+
+        int threshold = 0;
+        std::vector<Bytes> scriptKeys;
+        REQUIRE(NetworkFeeCalculator::isMultiSigContract(multiSigScript, threshold, scriptKeys));
+        std::vector<Bytes> signedKeys = {keys[0], keys[2]};
+        std::sort(signedKeys.begin(), signedKeys.end(), [&](const Bytes& a, const Bytes& b) {
+            return std::find(scriptKeys.begin(), scriptKeys.end(), a) < std::find(scriptKeys.begin(), scriptKeys.end(), b);
+        });
+        for (size_t i = 0; i < signedKeys.size(); ++i) {
+            Bytes signature(invocation.begin() + i * 65 + 1, invocation.begin() + (i + 1) * 65);
+            REQUIRE(ECPublicKey(signedKeys[i]).verifyHash(hash, std::make_shared<ECDSASignature>(signature)));
+        }
+
+        auto witnesses = first->getWitnesses();
+        REQUIRE(witnesses.size() == 2);
+        REQUIRE(Hash160::fromScript(witnesses[0]->getVerificationScript()) == payer->getScriptHash());
+    }
+
+    SECTION("Signatures are verified on insertion") {
+        auto context = newContext();
+        Bytes signature = owners[1]->signHash(hash);
+
+        REQUIRE_THROWS_AS(context->addSignature(multiSigHash, keys[1], Bytes(64, 0x01)), IllegalArgumentException);
+        REQUIRE_THROWS_AS(context->addSignature(multiSigHash, keys[0], signature), IllegalArgumentException);
+        Bytes outsider = payer->getKeyPair()->getPublicKey()->getEncoded();
+        REQUIRE_THROWS_AS(context->addSignature(multiSigHash, outsider, payer->signHash(hash)), IllegalArgumentException);
+        REQUIRE_THROWS_AS(context->addSignature(Hash160::ZERO, keys[1], signature), IllegalArgumentException);
+
+        REQUIRE(context->addSignature(multiSigHash, keys[1], signature));
+        REQUIRE_FALSE(context->addSignature(multiSigHash, keys[1], signature));
+
+        // A batch with one bad signature adds nothing
+        context->setThreads(2);
+        std::vector<PendingSignature> batch = {
+            {multiSigHash, keys[0], owners[0]->signHash(hash)},
+            {multiSigHash, keys[2], Bytes(64, 0x02)},
+        };
+        REQUIRE_THROWS_AS(context->addSignatures(batch), IllegalArgumentException);
+        REQUIRE_FALSE(context->isComplete(multiSigHash));
+        batch.pop_back();
+        REQUIRE(context->addSignatures(batch) == 1);
+        REQUIRE(context->isComplete(multiSigHash));
+    }
+
+    SECTION("JSON and binary round-trip") {
+        auto context = newContext();
+        context->sign(owners[1]);
+        context->sign(payer);
+
+        auto fromJson = ContractParametersContext::fromJson(context->toJson());
+        REQUIRE(fromJson->toArray() == context->toArray());
+        REQUIRE(fromJson->getWitness(multiSigHash)->toArray() == context->getWitness(multiSigHash)->toArray());
+
+        // Scripts must belong to a signer and hash to the key they are filed under
+        nlohmann::json swapped = context->toJson();
+        swapped["verificationScripts"][multiSigHash.toString()] = Hex::encode(payer->getVerificationScript());
+        REQUIRE_THROWS_AS(ContractParametersContext::fromJson(swapped), DeserializationException);
+        auto outsider = Account::create();
+        nlohmann::json unknown = context->toJson();
+        unknown["verificationScripts"][outsider->getScriptHash().toString()] = Hex::encode(outsider->getVerificationScript());
+        REQUIRE_THROWS_AS(ContractParametersContext::fromJson(unknown), DeserializationException);
+        REQUIRE_THROWS_AS(context->addSignature(outsider, outsider->signHash(hash)), IllegalArgumentException);
+
+        Bytes encoded = context->toArray();
+        auto decoded = ContractParametersContext::fromArray(encoded);
+        REQUIRE(decoded->getTransaction()->getHash() == transaction->getHash());
+        REQUIRE(decoded->toArray() == encoded);
+
+        Bytes trailing = encoded;
+        trailing.push_back(0x00);
+        REQUIRE_THROWS_AS(ContractParametersContext::fromArray(trailing), DeserializationException);
+        Bytes badVersion = encoded;
+        badVersion[0] = 0x7F;
+        REQUIRE_THROWS_AS(ContractParametersContext::fromArray(badVersion), DeserializationException);
+    }
+
+    SECTION("A merge with a bad signature leaves the context unchanged") {
+        // Signatures made before the transaction changed no longer verify
+        auto changing = std::make_shared<Transaction>(*transaction);
+        ContractParametersContext other(changing);
+        other.setVerificationScript(multiSigScript);
+        REQUIRE(other.sign(owners[0]));
+        REQUIRE(other.sign(payer));
+        changing->setNonce(2);
+
+        ContractParametersContext target(changing);
+        Bytes before = target.toArray();
+        REQUIRE_THROWS_AS(target.merge(other), IllegalArgumentException);
+        REQUIRE(target.toArray() == before);
+        REQUIRE(target.getWitnesses().empty());
+        REQUIRE_FALSE(target.isComplete(multiSigHash));
+    }
+
+    SECTION("Contexts for different transactions do not merge") {
+        auto other = std::make_shared<Transaction>();
+        other->setNonce(2);
+        other->setScript(Bytes{0x11, 0x40});
+        other->addSigner(std::make_shared<Signer>(multiSigHash));
+        ContractParametersContext otherContext(other);
+        REQUIRE_THROWS_AS(newContext()->merge(otherContext), IllegalArgumentException);
+        REQUIRE_THROWS_AS(newContext()->setVerificationScript(Bytes{0x40}), IllegalArgumentException);
+    }
+}
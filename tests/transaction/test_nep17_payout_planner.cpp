@@ -0,0 +1,142 @@
+#include <catch2/catch_test_macros.hpp>
+#include "stub_rpc_server.hpp"
+#include "neocpp/transaction/nep17_payout_planner.hpp"
+#include "neocpp/transaction/network_fee_calculator.hpp"
+#include "neocpp/transaction/transaction.hpp"
+#include "neocpp/contract/gas_token.hpp"
+#include "neocpp/contract/neo_token.hpp"
+#include "neocpp/protocol/neo_rpc_client.hpp"
+#include "neocpp/wallet/account.hpp"
+#include "neocpp/neo_constants.hpp"
+#include "neocpp/exceptions.hpp"
+#include <algorithm>
+#include <atomic>
+
+using namespace neocpp;
+
+#ifdef HAVE_CURL
+
+TEST_CASE("Nep17PayoutPlanner Tests", "[transaction]") {
+
+    const int64_t transferFee = 997770;
+    std::atomic<bool> fault{false};
+    std::atomic<int64_t> packedFee{0};
+    test::StubRpcServer server([&](const std::string& method, const nlohmann::json& params) -> nlohmann::json {
+        auto integer = [](const std::string& value) {
+            return nlohmann::json{{"state", "HALT"}, {"gasconsumed", "0"},
+                                  {"stack", {{{"type", "Integer"}, {"value", value}}}}};
+        };
+        if (method == "getblockcount") {
+            return 500;
+        }
+        if (method == "invokescript") {
+            // Scripts of more than one transfer cost packedFee when it is set
+            bool packed = params[0].get<std::string>().size() > 200;
+            int64_t fee = packed && packedFee != 0 ? packedFee.load() : transferFee;
+            return {{"script", params[0]}, {"state", fault ? "FAULT" : "HALT"},
+                    {"gasconsumed", std::to_string(fee)}, {"stack", nlohmann::json::array()}};
+        }
+        if (method == "invokefunction") {
+            std::string name = params[1].get<std::string>();
+            if (name == "getFeePerByte") return integer("1000");
+            if (name == "getExecFeeFactor") return integer("30");
+        }
+        throw std::runtime_error("Method not stubbed: " + method);
+    });
+
+    auto client = std::make_shared<NeoRpcClient>(server.getUrl());
+    auto sender = Account::create();
+    Nep17PayoutPlanner planner(client, sender);
+
+    const size_t count = 3000;
+    for (size_t i = 0; i < count; ++i) {
+        const Hash160& token = i % 3 == 0 ? NeoToken::SCRIPT_HASH : GasToken::SCRIPT_HASH;
+        Bytes recipient(20, static_cast<uint8_t>(i));
+        recipient[0] = static_cast<uint8_t>(i >> 8);
+        planner.addTransfer(token, Hash160(recipient), static_cast<int64_t>(i + 1));
+    }
+
+    SECTION("Transfers are packed under the size limit") {
+        planner.setFirstNonce(7);
+        auto batches = planner.build();
+
+        REQUIRE(batches.size() > 1);
+        REQUIRE(batches.size() < count / 100);
+
+        // One simulation per token and per transaction, plus block count and policy values
+        REQUIRE(server.getCallCount("invokescript") == 2 + static_cast<int>(batches.size()));
+        REQUIRE(server.getCallCount() == 5 + static_cast<int>(batches.size()));
+
+        size_t next = 0;
+        uint32_t nonce = 7;
+        for (const auto& batch : batches) {
+            const auto& tx = batch.transaction;
+            REQUIRE(batch.firstTransfer == next);
+            next += batch.transferCount;
+
+            REQUIRE(tx->getNonce() == nonce++);
+            REQUIRE(tx->getValidUntilBlock() == 600);
+            REQUIRE(tx->getSystemFee() == transferFee * static_cast<int64_t>(batch.transferCount));
+            REQUIRE(tx->getWitnesses().size() == 1);
+            REQUIRE(tx->getSize() <= static_cast<size_t>(NeoConstants::MAX_TRANSACTION_SIZE));
+            REQUIRE(tx->getNetworkFee() ==
+                    NetworkFeeCalculator(1000, 30).calculate(*tx, {sender->getVerificationScript()}));
+        }
+        REQUIRE(next == count);
+
+        // Greedy packing leaves no room for another transfer (amount pushes differ by a few bytes)
+        const auto& first = batches.front().transaction;
+        size_t transferSize = first->getScript().size() / batches.front().transferCount;
+        REQUIRE(first->getSize() + transferSize + 3 > static_cast<size_t>(NeoConstants::MAX_TRANSACTION_SIZE));
+    }
+
+    SECTION("Transfers are packed under the system fee budget") {
+        planner.setMaxSystemFee(transferFee * 25);
+        auto batches = planner.plan();
+
+        REQUIRE(batches.size() == count / 25);
+        for (const auto& batch : batches) {
+            REQUIRE(batch.transferCount == 25);
+            REQUIRE(batch.transaction->getSystemFee() <= planner.getMaxSystemFee());
+            REQUIRE(batch.transaction->getWitnesses().empty());
+        }
+        REQUIRE(batches[1].transaction->getNonce() == batches[0].transaction->getNonce() + 1);
+    }
+
+    SECTION("Packed transactions are charged their simulated fee when it is higher") {
+        planner.setMaxSystemFee(transferFee * 25);
+        packedFee = transferFee * 20;
+        auto batches = planner.plan();
+        REQUIRE(batches.front().transaction->getSystemFee() == transferFee * 25);
+
+        // Recipients that cost more than the templates, e.g. contracts, are charged in full
+        packedFee = transferFee * 25 + 1;
+        REQUIRE_THROWS_AS(planner.plan(), TransactionException);
+        planner.setMaxSystemFee(transferFee * 30);
+        batches = planner.plan();
+        for (const auto& batch : batches) {
+            REQUIRE(batch.transaction->getSystemFee() == std::max(transferFee * 25 + 1,
+                                                                  transferFee * static_cast<int64_t>(batch.transferCount)));
+        }
+    }
+
+    SECTION("Invalid plans are rejected") {
+        REQUIRE_THROWS_AS(planner.setMaxSystemFee(0), IllegalArgumentException);
+        REQUIRE_THROWS_AS(planner.setMaxTransactionSize(NeoConstants::MAX_TRANSACTION_SIZE + 1), IllegalArgumentException);
+        REQUIRE_THROWS_AS(planner.addTransfer(GasToken::SCRIPT_HASH, sender->getScriptHash(), -1), IllegalArgumentException);
+        REQUIRE_THROWS_AS(planner.getTransferFee(Hash160::ZERO), IllegalArgumentException);
+
+        planner.setMaxSystemFee(transferFee - 1);
+        REQUIRE_THROWS_AS(planner.plan(), TransactionException);
+
+        Nep17PayoutPlanner emptyPlanner(client, sender);
+        REQUIRE_THROWS_AS(emptyPlanner.plan(), IllegalStateException);
+
+        fault = true;
+        Nep17PayoutPlanner faulting(client, sender);
+        faulting.addTransfer(GasToken::SCRIPT_HASH, sender->getScriptHash(), 1);
+        REQUIRE_THROWS_AS(faulting.plan(), IllegalStateException);
+    }
+}
+
+#endif
@@ -0,0 +1,105 @@
+#include <catch2/catch_test_macros.hpp>
+#include "neocpp/transaction/network_fee_calculator.hpp"
+#include "neocpp/transaction/transaction.hpp"
+#include "neocpp/transaction/signer.hpp"
+#include "neocpp/transaction/witness.hpp"
+#include "neocpp/transaction/witness_scope.hpp"
+#include "neocpp/transaction/transaction_attribute.hpp"
+#include "neocpp/crypto/ec_key_pair.hpp"
+#include "neocpp/script/script_builder.hpp"
+#include "neocpp/types/hash160.hpp"
+#include "neocpp/types/hash256.hpp"
+#include "neocpp/exceptions.hpp"
+
+using namespace neocpp;
+
+TEST_CASE("NetworkFeeCalculator Tests", "[transaction]") {
+
+    std::vector<Bytes> publicKeys;
+    for (int i = 0; i < 3; ++i) {
+        publicKeys.push_back(ECKeyPair::generate().getPublicKey()->getEncoded());
+    }
+    Bytes singleSig = ScriptBuilder::buildVerificationScript(publicKeys[0]);
+    Bytes multiSig = ScriptBuilder::buildMultiSigVerificationScript(publicKeys, 2);
+
+    auto makeTransaction = [](const Bytes& verificationScript) {
+        Transaction tx;
+        tx.setNonce(42);
+        tx.setValidUntilBlock(1000);
+        tx.setScript(Bytes{0x11, 0x40});
+        tx.addSigner(std::make_shared<Signer>(Hash160::fromScript(verificationScript), WitnessScope::CALLED_BY_ENTRY));
+        return tx;
+    };
+
+    SECTION("Recognise standard verification scripts") {
+        int m = 0;
+        int n = 0;
+        REQUIRE(NetworkFeeCalculator::isSignatureContract(singleSig));
+        REQUIRE_FALSE(NetworkFeeCalculator::isMultiSigContract(singleSig, m, n));
+
+        REQUIRE(NetworkFeeCalculator::isMultiSigContract(multiSig, m, n));
+        REQUIRE(m == 2);
+        REQUIRE(n == 3);
+        REQUIRE_FALSE(NetworkFeeCalculator::isSignatureContract(multiSig));
+
+        Bytes oneOfOne = ScriptBuilder::buildMultiSigVerificationScript({publicKeys[0]}, 1);
+        REQUIRE(NetworkFeeCalculator::isMultiSigContract(oneOfOne, m, n));
+        REQUIRE(m == 1);
+        REQUIRE(n == 1);
+
+        Bytes truncated(singleSig.begin(), singleSig.end() - 1);
+        REQUIRE_FALSE(NetworkFeeCalculator::canPrice(truncated));
+        REQUIRE_FALSE(NetworkFeeCalculator::canPrice(Bytes{0x11, 0x40}));
+        REQUIRE_FALSE(NetworkFeeCalculator::canPrice(Bytes()));
+    }
+
+    SECTION("Verification costs match the node's pricing") {
+        // 0.00983520 GAS for a single-signature witness under the default policy
+        REQUIRE(NetworkFeeCalculator::signatureContractCost() * NetworkFeeCalculator::DEFAULT_EXEC_FEE_FACTOR == 983520);
+        REQUIRE(NetworkFeeCalculator::multiSignatureContractCost(2, 3) ==
+                8 * 5 + 2 + 3 * NetworkFeeCalculator::CHECK_SIG_PRICE);
+    }
+
+    SECTION("Single-sig fee equals size and execution cost of the signed transaction") {
+        NetworkFeeCalculator calculator;
+        Transaction tx = makeTransaction(singleSig);
+        int64_t fee = calculator.calculate(tx, {singleSig});
+
+        tx.addWitness(Witness::fromSignature(Bytes(64, 0xAB), publicKeys[0]));
+        int64_t expected = static_cast<int64_t>(tx.getSize()) * NetworkFeeCalculator::DEFAULT_FEE_PER_BYTE +
+                           NetworkFeeCalculator::signatureContractCost() * NetworkFeeCalculator::DEFAULT_EXEC_FEE_FACTOR;
+        REQUIRE(fee == expected);
+    }
+
+    SECTION("Multi-sig fee equals size and execution cost of the signed transaction") {
+        NetworkFeeCalculator calculator(2000, 10);
+        Transaction tx = makeTransaction(multiSig);
+        int64_t fee = calculator.calculate(tx, {multiSig});
+
+        tx.addWitness(Witness::fromMultiSignature({Bytes(64, 1), Bytes(64, 2)}, publicKeys, 2));
+        int64_t expected = static_cast<int64_t>(tx.getSize()) * 2000 +
+                           NetworkFeeCalculator::multiSignatureContractCost(2, 3) * 10;
+        REQUIRE(fee == expected);
+    }
+
+    SECTION("Non-standard scripts are not priced locally") {
+        NetworkFeeCalculator calculator;
+        Transaction tx = makeTransaction(singleSig);
+        REQUIRE_THROWS_AS(calculator.calculate(tx, {singleSig, Bytes{0x11, 0x40}}), IllegalArgumentException);
+        REQUIRE_THROWS_AS(NetworkFeeCalculator::invocationScriptSize(Bytes{0x11}), IllegalArgumentException);
+        REQUIRE_THROWS_AS(NetworkFeeCalculator(-1, 30), IllegalArgumentException);
+        REQUIRE_THROWS_AS(NetworkFeeCalculator::fromClient(nullptr), IllegalStateException);
+    }
+
+    SECTION("Attributes with a policy fee are not priced locally") {
+        NetworkFeeCalculator calculator;
+        Transaction tx = makeTransaction(singleSig);
+        tx.addAttribute(std::make_shared<HighPriorityAttribute>());
+        REQUIRE(NetworkFeeCalculator::canPriceAttributes(tx));
+        REQUIRE(calculator.calculate(tx, {singleSig}) > 0);
+
+        tx.addAttribute(std::make_shared<ConflictsAttribute>(Hash256()));
+        REQUIRE_FALSE(NetworkFeeCalculator::canPriceAttributes(tx));
+        REQUIRE_THROWS_AS(calculator.calculate(tx, {singleSig}), IllegalArgumentException);
+    }
+}
@@ -3,6 +3,7 @@
 #include "neocpp/transaction/transaction_builder.hpp"
 #include "neocpp/transaction/signer.hpp"
 #include "neocpp/transaction/witness.hpp"
+#include "neocpp/transaction/witness_rule.hpp"
 #include "neocpp/crypto/ec_key_pair.hpp"
 #include "neocpp/crypto/ecdsa_signature.hpp"
 #include "neocpp/wallet/account.hpp"
@@ -12,9 +13,30 @@
 #include "neocpp/utils/hex.hpp"
 #include "neocpp/transaction/witness_scope.hpp"
 #include <nlohmann/json.hpp>
+#include <memory_resource>
+#include <thread>
+#include <vector>
 
 using namespace neocpp;
 
+namespace {
+    /// Memory resource that counts what is allocated from it
+    class CountingResource : public std::pmr::memory_resource {
+    public:
+        size_t allocations = 0;
+
+    private:
+        void* do_allocate(size_t bytes, size_t alignment) override {
+            ++allocations;
+            return arena_.allocate(bytes, alignment);
+        }
+        void do_deallocate(void*, size_t, size_t) override {}
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+        std::pmr::monotonic_buffer_resource arena_;
+    };
+}
+
 TEST_CASE("Transaction Tests", "[transaction]") {
     
     SECTION("Create empty transaction") {
@@ -146,7 +168,67 @@ TEST_CASE("Transaction Tests", "[transaction]") {
         REQUIRE(deserialized->getScript() == tx.getScript());
         REQUIRE(deserialized->getSigners().size() == tx.getSigners().size());
     }
+
+    SECTION("Deserialize transaction from a borrowed buffer") {
+        auto account = Account::create();
+        Transaction tx;
+        tx.setScript(Bytes(300, 0x21));
+        tx.addSigner(std::make_shared<Signer>(account->getScriptHash(), WitnessScope::CALLED_BY_ENTRY));
+        tx.sign(account);
+        Bytes serialized = tx.toArray();
+
+        auto reader = BinaryReader::borrow(serialized);
+        auto deserialized = Transaction::deserialize(reader);
+        const uint8_t* begin = serialized.data();
+        const uint8_t* end = begin + serialized.size();
+        REQUIRE(deserialized->getScriptView().data() > begin);
+        REQUIRE(deserialized->getScriptView().data() < end);
+        REQUIRE(deserialized->getWitnesses()[0]->isBorrowed());
+
+        REQUIRE(deserialized->getSize() == serialized.size());
+        REQUIRE(deserialized->getHash() == tx.getHash());
+        REQUIRE(deserialized->toArray() == serialized);
+
+        // Concurrent getters on a shared transaction all see the same copy
+        std::vector<const Bytes*> scripts(8);
+        std::vector<std::thread> readers;
+        for (size_t i = 0; i < scripts.size(); ++i) {
+            readers.emplace_back([&, i]() { scripts[i] = &deserialized->getScript(); });
+        }
+        for (auto& thread : readers) {
+            thread.join();
+        }
+        for (const Bytes* script : scripts) {
+            REQUIRE(script == scripts[0]);
+        }
+        REQUIRE(deserialized->getScript() == tx.getScript());
+        REQUIRE(deserialized->getScriptView().data() > begin);
+    }
     
+    SECTION("Deserialize transaction into a memory resource") {
+        auto account = Account::create();
+        Transaction tx;
+        tx.setScript(Bytes{0x11, 0x40});
+        auto signer = std::make_shared<Signer>(account->getScriptHash(), WitnessScope::WITNESS_RULES);
+        signer->addRule(std::make_shared<WitnessRule>(WitnessRuleAction::ALLOW, WitnessCondition::calledByEntry()));
+        tx.addSigner(signer);
+        tx.sign(account);
+        Bytes serialized = tx.toArray();
+
+        CountingResource arena;
+        {
+            auto reader = BinaryReader::borrow(serialized);
+            reader.setMemoryResource(&arena);
+            REQUIRE(reader.getMemoryResource() == &arena);
+            auto deserialized = Transaction::deserialize(reader);
+
+            // Transaction, signer, witness rule and witness
+            REQUIRE(arena.allocations == 4);
+            REQUIRE(deserialized->toArray() == serialized);
+            REQUIRE(deserialized->getHash() == tx.getHash());
+        }
+    }
+
     SECTION("Sign transaction manually") {
         Transaction tx;
         tx.setVersion(0);
@@ -254,6 +336,51 @@ TEST_CASE("Transaction Tests", "[transaction]") {
         }
     }
 
+    SECTION("Signer and witness ordering with many signers") {
+        TransactionBuilder builder;
+        std::vector<SharedPtr<Account>> accounts;
+        for (int i = 0; i < 12; ++i) {
+            accounts.push_back(Account::create());
+            auto scope = i % 3 == 0 ? WitnessScope::GLOBAL : WitnessScope::CALLED_BY_ENTRY;
+            builder.addSigner(std::make_shared<Signer>(accounts.back()->getScriptHash(), scope));
+        }
+        for (auto it = accounts.rbegin(); it != accounts.rend(); ++it) {
+            builder.addWitness(Witness::fromSignature(Bytes(64, 0x01), (*it)->getKeyPair()->getPublicKey()->getEncoded()));
+        }
+
+        builder.sortSignersAndWitnesses();
+
+        auto tx = builder.getTransaction();
+        const auto& signers = tx->getSigners();
+        const auto& witnesses = tx->getWitnesses();
+        REQUIRE(signers.size() == 12);
+        REQUIRE(witnesses.size() == 12);
+
+        for (size_t i = 1; i < signers.size(); ++i) {
+            const auto& previous = signers[i - 1];
+            const auto& current = signers[i];
+            REQUIRE(previous->getScopes() <= current->getScopes());
+            if (previous->getScopes() == current->getScopes()) {
+                REQUIRE(previous->getAccount().toString() < current->getAccount().toString());
+            }
+        }
+        for (size_t i = 0; i < signers.size(); ++i) {
+            REQUIRE(Hash160::fromScript(witnesses[i]->getVerificationScript()) == signers[i]->getAccount());
+        }
+
+        // Witnesses are left alone unless every signer has one
+        TransactionBuilder partial;
+        partial.addSigner(std::make_shared<Signer>(accounts[0]->getScriptHash()));
+        partial.addSigner(std::make_shared<Signer>(accounts[1]->getScriptHash()));
+        auto contractWitness = std::make_shared<Witness>(Bytes{0x0C, 0x00}, Bytes{});
+        auto accountWitness = Witness::fromSignature(Bytes(64, 0x02), accounts[0]->getKeyPair()->getPublicKey()->getEncoded());
+        partial.addWitness(contractWitness);
+        partial.addWitness(accountWitness);
+        partial.sortSignersAndWitnesses();
+        REQUIRE(partial.getTransaction()->getWitnesses()[0] == contractWitness);
+        REQUIRE(partial.getTransaction()->getWitnesses()[1] == accountWitness);
+    }
+
     SECTION("Signer JSON serialization") {
         Hash160 account1("23ba2703c53263e8d6e522dc32203339dcd8eee9");
         Hash160 account2("e707714512577b42f9a011f8b31b4e9afc96e196");
@@ -0,0 +1,121 @@
+#include <catch2/catch_test_macros.hpp>
+#include "neocpp/transaction/transaction.hpp"
+#include "neocpp/transaction/transaction_attribute.hpp"
+#include "neocpp/transaction/signer.hpp"
+#include "neocpp/serialization/binary_writer.hpp"
+#include "neocpp/serialization/binary_reader.hpp"
+#include "neocpp/types/hash160.hpp"
+#include "neocpp/types/hash256.hpp"
+#include "neocpp/exceptions.hpp"
+
+using namespace neocpp;
+
+namespace {
+    template<typename T>
+    SharedPtr<T> roundTrip(const TransactionAttribute& attribute) {
+        BinaryReader reader(attribute.toArray());
+        auto result = std::dynamic_pointer_cast<T>(TransactionAttribute::deserialize(reader));
+        REQUIRE(result);
+        REQUIRE_FALSE(reader.hasMore());
+        return result;
+    }
+}
+
+TEST_CASE("TransactionAttribute Tests", "[transaction]") {
+
+    Hash160 account("23ba2703c53263e8d6e522dc32203339dcd8eee9");
+    Hash256 conflict("0xb804a98220c69ab4674bc7b5b0bb0a4e4b6e8d5e5f3c4b1e3a7d6c8b9e0f1a2b");
+    Hash256 otherConflict("0x0102030405060708091011121314151617181920212223242526272829303132");
+
+    SECTION("Typed attributes round-trip") {
+        auto oracle = roundTrip<OracleResponseAttribute>(OracleResponseAttribute(42, 0, Bytes{0x7B, 0x7D}));
+        REQUIRE(oracle->getId() == 42);
+        REQUIRE(oracle->getCode() == 0);
+        REQUIRE(oracle->getResult() == Bytes{0x7B, 0x7D});
+
+        REQUIRE(roundTrip<NotValidBeforeAttribute>(NotValidBeforeAttribute(123456))->getHeight() == 123456);
+        REQUIRE(roundTrip<ConflictsAttribute>(ConflictsAttribute(conflict))->getHash() == conflict);
+        REQUIRE(roundTrip<HighPriorityAttribute>(HighPriorityAttribute())->getType() == TransactionAttributeType::HIGH_PRIORITY);
+    }
+
+    SECTION("Transactions keep their attributes and hash") {
+        Transaction tx;
+        tx.setNonce(7);
+        tx.setValidUntilBlock(5000);
+        tx.setScript(Bytes{0x11, 0x40});
+        tx.addSigner(std::make_shared<Signer>(account));
+        tx.addAttribute(std::make_shared<HighPriorityAttribute>());
+        tx.addAttribute(std::make_shared<OracleResponseAttribute>(9, 0, Bytes(300, 0x61)));
+        tx.addAttribute(std::make_shared<NotValidBeforeAttribute>(4000));
+        tx.addAttribute(std::make_shared<ConflictsAttribute>(conflict));
+        tx.addAttribute(std::make_shared<ConflictsAttribute>(otherConflict));
+        Bytes serialized = tx.toArray();
+
+        BinaryReader reader(serialized);
+        auto deserialized = Transaction::deserialize(reader);
+        REQUIRE(deserialized->getHash() == tx.getHash());
+        REQUIRE(deserialized->toArray() == serialized);
+
+        const auto& attributes = deserialized->getAttributes();
+        REQUIRE(attributes.size() == 5);
+        REQUIRE(attributes[0]->getType() == TransactionAttributeType::HIGH_PRIORITY);
+        auto oracle = std::dynamic_pointer_cast<OracleResponseAttribute>(attributes[1]);
+        REQUIRE(oracle);
+        REQUIRE(oracle->getId() == 9);
+        REQUIRE(oracle->getResult() == Bytes(300, 0x61));
+        auto notValidBefore = std::dynamic_pointer_cast<NotValidBeforeAttribute>(attributes[2]);
+        REQUIRE(notValidBefore);
+        REQUIRE(notValidBefore->getHeight() == 4000);
+        REQUIRE(std::dynamic_pointer_cast<ConflictsAttribute>(attributes[3])->getHash() == conflict);
+        REQUIRE(std::dynamic_pointer_cast<ConflictsAttribute>(attributes[4])->getHash() == otherConflict);
+    }
+
+    SECTION("Invalid attributes are rejected") {
+        auto deserialize = [&](const std::vector<SharedPtr<TransactionAttribute>>& attributes) {
+            Transaction tx;
+            tx.setScript(Bytes{0x11, 0x40});
+            tx.addSigner(std::make_shared<Signer>(account));
+            for (const auto& attribute : attributes) {
+                tx.addAttribute(attribute);
+            }
+            BinaryReader reader(tx.toArray());
+            return Transaction::deserialize(reader);
+        };
+
+        REQUIRE_THROWS_AS(deserialize({std::make_shared<NotValidBeforeAttribute>(1),
+                                       std::make_shared<NotValidBeforeAttribute>(2)}), DeserializationException);
+        REQUIRE_THROWS_AS(deserialize({std::make_shared<HighPriorityAttribute>(),
+                                       std::make_shared<HighPriorityAttribute>()}), DeserializationException);
+
+        // Signers and attributes share the limit of 16
+        std::vector<SharedPtr<TransactionAttribute>> conflicts;
+        for (int i = 0; i < NeoConstants::MAX_TRANSACTION_ATTRIBUTES; ++i) {
+            conflicts.push_back(std::make_shared<ConflictsAttribute>(conflict));
+        }
+        REQUIRE_THROWS_AS(deserialize(conflicts), DeserializationException);
+        conflicts.pop_back();
+        REQUIRE(deserialize(conflicts)->getAttributes().size() == 15);
+
+        // Hostile counts are rejected before anything is reserved
+        Bytes header(25, 0x00);
+        Bytes hugeSigners = header;
+        hugeSigners.insert(hugeSigners.end(), 9, 0xFF);
+        BinaryReader hugeSignerReader(hugeSigners);
+        REQUIRE_THROWS_AS(Transaction::deserialize(hugeSignerReader), DeserializationException);
+        Bytes hugeAttributes = header;
+        hugeAttributes.push_back(0x01);
+        hugeAttributes.insert(hugeAttributes.end(), 20, 0x00);
+        hugeAttributes.push_back(static_cast<uint8_t>(WitnessScope::CALLED_BY_ENTRY));
+        hugeAttributes.insert(hugeAttributes.end(), 9, 0xFF);  // wraps to 0 when added to the signer count
+        BinaryReader hugeAttributeReader(hugeAttributes);
+        REQUIRE_THROWS_AS(Transaction::deserialize(hugeAttributeReader), DeserializationException);
+
+        BinaryReader tooLarge(OracleResponseAttribute(1, 0, Bytes(0x10000, 0x00)).toArray());
+        REQUIRE_THROWS_AS(TransactionAttribute::deserialize(tooLarge), DeserializationException);
+        BinaryReader errorWithResult(OracleResponseAttribute(1, 0x14, Bytes{0x01}).toArray());
+        REQUIRE_THROWS_AS(TransactionAttribute::deserialize(errorWithResult), DeserializationException);
+
+        BinaryReader unknown(Bytes{0x7F});
+        REQUIRE_THROWS_AS(TransactionAttribute::deserialize(unknown), DeserializationException);
+    }
+}
@@ -0,0 +1,101 @@
+#include <catch2/catch_test_macros.hpp>
+#include "stub_rpc_server.hpp"
+#include "neocpp/transaction/transaction_builder.hpp"
+#include "neocpp/transaction/transaction.hpp"
+#include "neocpp/transaction/network_fee_calculator.hpp"
+#include "neocpp/transaction/transaction_attribute.hpp"
+#include "neocpp/protocol/neo_rpc_client.hpp"
+#include "neocpp/wallet/account.hpp"
+#include "neocpp/crypto/ec_key_pair.hpp"
+#include "neocpp/utils/hex.hpp"
+#include "neocpp/exceptions.hpp"
+#include <chrono>
+
+using namespace neocpp;
+
+#ifdef HAVE_CURL
+
+TEST_CASE("TransactionBuilder RPC Latency Tests", "[transaction]") {
+
+    const auto delay = std::chrono::milliseconds(150);
+    auto account = Account::create();
+    std::string committeeKey = Hex::encode(account->getKeyPair()->getPublicKey()->getEncoded());
+
+    test::StubRpcServer server([&](const std::string& method, const nlohmann::json& params) -> nlohmann::json {
+        auto integer = [](const std::string& value) {
+            return nlohmann::json{{"state", "HALT"}, {"gasconsumed", "0"},
+                                  {"stack", {{{"type", "Integer"}, {"value", value}}}}};
+        };
+        if (method == "getblockcount") {
+            return 1000;
+        }
+        if (method == "getcommittee") {
+            return nlohmann::json::array({committeeKey});
+        }
+        if (method == "invokescript") {
+            return {{"script", params[0]}, {"state", "HALT"}, {"gasconsumed", "1007390"}, {"stack", nlohmann::json::array()}};
+        }
+        if (method == "calculatenetworkfee") {
+            return {{"networkfee", 1234567}};
+        }
+        if (method == "invokefunction") {
+            std::string name = params[1].get<std::string>();
+            if (name == "getFeePerByte") return integer("1000");
+            if (name == "getExecFeeFactor") return integer("30");
+            if (name == "balanceOf") return integer("5000000000");
+        }
+        throw std::runtime_error("Method not stubbed: " + method);
+    }, delay);
+
+    auto client = std::make_shared<NeoRpcClient>(server.getUrl());
+
+    auto build = [&]() {
+        TransactionBuilder builder(client);
+        builder.setScript(Bytes{0x11, 0x40})
+               .addSigner(account)
+               .setHighPriority(true)
+               .throwIfSenderCannotCoverFees(std::make_shared<IllegalStateException>("Insufficient GAS"));
+
+        return builder.getUnsignedTransaction();
+    };
+
+    SECTION("Independent phases overlap") {
+        auto tx = build();
+
+        // Block count, committee, invokescript, fee per byte, exec fee factor and balanceOf
+        REQUIRE(server.getCallCount() == 6);
+        REQUIRE(server.getCallCount("calculatenetworkfee") == 0);
+        REQUIRE(server.getPeakConcurrency() >= 4);
+
+        REQUIRE(tx->getValidUntilBlock() == 1100);
+        REQUIRE(tx->getSystemFee() == 1007390);
+        REQUIRE(tx->getNetworkFee() ==
+                NetworkFeeCalculator(1000, 30).calculate(*tx, {account->getVerificationScript()}));
+
+        // Chain state is cached per client, so a second build only simulates the script
+        auto second = build();
+        REQUIRE(server.getCallCount() == 7);
+        REQUIRE(server.getCallCount("invokescript") == 2);
+        REQUIRE(second->getNetworkFee() == tx->getNetworkFee());
+    }
+
+    SECTION("Attributes with a policy fee are priced by the node") {
+        TransactionBuilder builder(client);
+        builder.setScript(Bytes{0x11, 0x40}).addSigner(account);
+        builder.getTransaction()->addAttribute(std::make_shared<ConflictsAttribute>(Hash256()));
+        auto tx = builder.getUnsignedTransaction();
+        REQUIRE(server.getCallCount("calculatenetworkfee") == 1);
+        REQUIRE(tx->getNetworkFee() == 1234567);
+    }
+
+    SECTION("Errors from concurrent phases are reported") {
+        TransactionBuilder builder(client);
+        builder.setScript(Bytes{0x11, 0x40})
+               .addSigner(account)
+               .throwIfSenderCannotCoverFees(std::make_shared<IllegalStateException>("Insufficient GAS"))
+               .setAdditionalSystemFee(6000000000);
+        REQUIRE_THROWS_AS(builder.getUnsignedTransaction(), std::exception);
+    }
+}
+
+#endif
@@ -0,0 +1,166 @@
+#include <catch2/catch_test_macros.hpp>
+#include "stub_rpc_server.hpp"
+#include "neocpp/transaction/transaction.hpp"
+#include "neocpp/transaction/transaction_attribute.hpp"
+#include "neocpp/transaction/signer.hpp"
+#include "neocpp/transaction/witness.hpp"
+#include "neocpp/protocol/neo_rpc_client.hpp"
+#include "neocpp/serialization/binary_writer.hpp"
+#include "neocpp/wallet/account.hpp"
+#include "neocpp/utils/base64.hpp"
+#include <functional>
+
+using namespace neocpp;
+
+namespace {
+    /// Attribute that counts how often the witness-free part of a transaction is written
+    class CountingAttribute : public HighPriorityAttribute {
+    public:
+        mutable int serializations = 0;
+
+    protected:
+        void serializeWithoutType(BinaryWriter& writer) const override {
+            ++serializations;
+            HighPriorityAttribute::serializeWithoutType(writer);
+        }
+    };
+
+    /// Witness that counts how often it is written
+    class CountingWitness : public Witness {
+    public:
+        mutable int serializations = 0;
+
+        CountingWitness() : Witness(Bytes(66, 0x0C), Bytes(40, 0x0C)) {}
+
+        void serialize(BinaryWriter& writer) const override {
+            ++serializations;
+            Witness::serialize(writer);
+        }
+    };
+
+    Bytes reference(const Transaction& transaction) {
+        BinaryWriter writer;
+        transaction.serialize(writer);
+        return writer.toArray();
+    }
+}
+
+TEST_CASE("Transaction Cache Tests", "[transaction]") {
+
+    auto account = Account::create();
+    auto attribute = std::make_shared<CountingAttribute>();
+
+    Transaction tx;
+    tx.setScript(Bytes{0x11, 0x40});
+    tx.setValidUntilBlock(1000);
+    tx.addSigner(std::make_shared<Signer>(account->getScriptHash()));
+    tx.addAttribute(attribute);
+
+    SECTION("A built transaction is serialized once") {
+        tx.getHash();
+        tx.sign(account);
+        for (int i = 0; i < 3; ++i) {
+            (void)tx.getHash();
+            (void)tx.getTxId();
+            (void)tx.getSize();
+            (void)tx.getUnsignedSize();
+            (void)tx.getHashData();
+            (void)tx.getBytes();
+            (void)tx.toArray();
+            (void)tx.toBase64();
+        }
+        REQUIRE(attribute->serializations == 1);
+
+        int before = attribute->serializations;
+        Bytes expected = reference(tx);
+        attribute->serializations = before;
+        REQUIRE(tx.getBytes() == expected);
+        REQUIRE(tx.toBase64() == Base64::encode(expected));
+        REQUIRE(tx.getSize() == expected.size());
+    }
+
+    SECTION("Witness changes keep the hash data") {
+        Hash256 hash = tx.getHash();
+        auto witness = std::make_shared<CountingWitness>();
+        tx.addWitness(witness);
+        (void)tx.getBytes();
+
+        auto second = std::make_shared<CountingWitness>();
+        tx.addWitness(second);
+        (void)tx.toBase64();
+        (void)tx.getBytes();
+        REQUIRE(attribute->serializations == 1);
+        REQUIRE(witness->serializations == 2);
+        REQUIRE(second->serializations == 1);
+        REQUIRE(tx.getHash() == hash);
+        REQUIRE(tx.getBytes() == reference(tx));
+
+        tx.clearWitnesses();
+        REQUIRE(tx.getBytes() == reference(tx));
+        REQUIRE(tx.getHash() == hash);
+    }
+
+    SECTION("Every mutator invalidates") {
+        auto check = [&](const std::function<void()>& mutate) {
+            Hash256 hash = tx.getHash();
+            (void)tx.toBase64();
+            int before = attribute->serializations;
+            mutate();
+            Bytes expected = reference(tx);
+            attribute->serializations = before;
+            REQUIRE(tx.getBytes() == expected);
+            REQUIRE(tx.toBase64() == Base64::encode(expected));
+            REQUIRE(tx.getHash() != hash);
+            REQUIRE(attribute->serializations == before + 1);
+        };
+
+        check([&]() { tx.setVersion(1); });
+        check([&]() { tx.setNonce(tx.getNonce() + 1); });
+        check([&]() { tx.setSystemFee(100); });
+        check([&]() { tx.setNetworkFee(200); });
+        check([&]() { tx.setValidUntilBlock(2000); });
+        check([&]() { tx.setScript(Bytes{0x11, 0x41}); });
+        check([&]() { tx.addSigner(std::make_shared<Signer>(Account::create()->getScriptHash())); });
+        check([&]() { tx.addAttribute(std::make_shared<NotValidBeforeAttribute>(5)); });
+        check([&]() { tx.clearSigners(); });
+
+        auto signer = std::make_shared<Signer>(account->getScriptHash(), WitnessScope::CUSTOM_CONTRACTS);
+        tx.addSigner(signer);
+        check([&]() {
+            signer->addAllowedContract(account->getScriptHash());
+            tx.invalidateCache();
+        });
+    }
+}
+
+#ifdef HAVE_CURL
+
+TEST_CASE("Transaction Cache RPC Tests", "[transaction]") {
+
+    std::vector<std::string> sent;
+    test::StubRpcServer server([&](const std::string& method, const nlohmann::json& params) -> nlohmann::json {
+        sent.push_back(params[0].get<std::string>());
+        if (method == "calculatenetworkfee") {
+            return {{"networkfee", 123}};
+        }
+        return {{"hash", "0x0000000000000000000000000000000000000000000000000000000000000001"}};
+    });
+    auto client = std::make_shared<NeoRpcClient>(server.getUrl());
+
+    auto account = Account::create();
+    auto attribute = std::make_shared<CountingAttribute>();
+    auto tx = std::make_shared<Transaction>();
+    tx->setScript(Bytes{0x11, 0x40});
+    tx->addSigner(std::make_shared<Signer>(account->getScriptHash()));
+    tx->addAttribute(attribute);
+    tx->sign(account);
+
+    client->calculateNetworkFee(tx);
+    client->sendRawTransaction(tx);
+    client->sendRawTransaction(tx);
+    REQUIRE(attribute->serializations == 1);
+    REQUIRE(sent.size() == 3);
+    REQUIRE(sent[1] == tx->toBase64());
+}
+
+#endif
@@ -157,6 +157,31 @@ TEST_CASE("Witness Tests", "[transaction]") {
         REQUIRE(*deserialized == original);
     }
     
+    SECTION("Deserialization from a borrowed buffer keeps views") {
+        Witness original(Bytes(66, 0x0C), Bytes(40, 0x21));
+        Bytes serialized = original.toArray();
+
+        auto reader = BinaryReader::borrow(serialized);
+        auto deserialized = Witness::deserialize(reader);
+        REQUIRE(deserialized->isBorrowed());
+        REQUIRE(deserialized->getInvocationScriptView().data() == serialized.data() + 1);
+        REQUIRE(deserialized->getSize() == original.getSize());
+        REQUIRE(deserialized->toArray() == serialized);
+        REQUIRE(*deserialized == original);
+
+        // Getters copy the scripts out once
+        REQUIRE(deserialized->getVerificationScript() == original.getVerificationScript());
+        REQUIRE(&deserialized->getVerificationScript() == &deserialized->getVerificationScript());
+        REQUIRE(deserialized->getInvocationScriptView().data() == serialized.data() + 1);
+        REQUIRE(deserialized->getScriptHash() == original.getScriptHash());
+
+        // Setters take ownership
+        deserialized->setInvocationScript(Bytes(66, 0x0D));
+        REQUIRE_FALSE(deserialized->isBorrowed());
+        REQUIRE(deserialized->getVerificationScript() == original.getVerificationScript());
+        REQUIRE(deserialized->getInvocationScript() == Bytes(66, 0x0D));
+    }
+
     SECTION("Serialization with empty scripts") {
         Witness original({}, {});
         
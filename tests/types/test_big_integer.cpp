@@ -0,0 +1,157 @@
+#include <catch2/catch_test_macros.hpp>
+#include "neocpp/types/big_integer.hpp"
+#include "neocpp/types/contract_parameter.hpp"
+#include "neocpp/protocol/stack_item.hpp"
+#include "neocpp/protocol/stack_item_arena.hpp"
+#include "neocpp/script/script_builder.hpp"
+#include "neocpp/script/op_code.hpp"
+#include "neocpp/utils/hex.hpp"
+#include "neocpp/exceptions.hpp"
+#include <limits>
+#include <string>
+
+using namespace neocpp;
+
+namespace {
+
+const std::string MAX_VALUE = "57896044618658097711785492504343953926634992332820282019728792003956564819967";
+const std::string MIN_VALUE = "-57896044618658097711785492504343953926634992332820282019728792003956564819968";
+
+} // namespace
+
+TEST_CASE("BigInteger Tests", "[types]") {
+
+    SECTION("Values that fit in 64 bits") {
+        BigInteger zero;
+        REQUIRE(zero.isZero());
+        REQUIRE(zero.sign() == 0);
+        REQUIRE(zero.toString() == "0");
+        REQUIRE(zero.toBytes().empty());
+
+        BigInteger negative(-42);
+        REQUIRE(negative.isNegative());
+        REQUIRE(negative.fitsInt64());
+        REQUIRE(negative.toInt64() == -42);
+        REQUIRE(negative.toString() == "-42");
+        REQUIRE(BigInteger::parse("-42") == negative);
+
+        BigInteger min(std::numeric_limits<int64_t>::min());
+        REQUIRE(min.toString() == "-9223372036854775808");
+        REQUIRE(BigInteger::parse("-9223372036854775808") == min);
+        REQUIRE(BigInteger::fromUnsigned(42) == BigInteger(42));
+    }
+
+    SECTION("Parse and format beyond 64 bits") {
+        BigInteger big = BigInteger::parse("1000000000000000000000000000");
+        REQUIRE_FALSE(big.fitsInt64());
+        REQUIRE(big == BigInteger::pow10(27));
+        REQUIRE(big.toString() == "1000000000000000000000000000");
+        REQUIRE_THROWS_AS(big.toInt64(), IllegalStateException);
+
+        REQUIRE(BigInteger::parse("9223372036854775808").toString() == "9223372036854775808");
+        REQUIRE(BigInteger::fromUnsigned(std::numeric_limits<uint64_t>::max()).toString() == "18446744073709551615");
+        REQUIRE(BigInteger::parse(MAX_VALUE).toString() == MAX_VALUE);
+        REQUIRE(BigInteger::parse(MIN_VALUE).toString() == MIN_VALUE);
+        REQUIRE(BigInteger::parse("-000000000000000000000042") == BigInteger(-42));
+
+        REQUIRE_THROWS_AS(BigInteger::parse(""), IllegalArgumentException);
+        REQUIRE_THROWS_AS(BigInteger::parse("-"), IllegalArgumentException);
+        REQUIRE_THROWS_AS(BigInteger::parse("12x"), IllegalArgumentException);
+        REQUIRE_THROWS_AS(BigInteger::parse("57896044618658097711785492504343953926634992332820282019728792003956564819968"),
+                          IllegalArgumentException);
+        REQUIRE_THROWS_AS(BigInteger::pow10(77), IllegalArgumentException);
+    }
+
+    SECTION("NeoVM byte encoding") {
+        REQUIRE(Hex::encode(BigInteger(127).toBytes()) == "7f");
+        REQUIRE(Hex::encode(BigInteger(128).toBytes()) == "8000");
+        REQUIRE(Hex::encode(BigInteger(-1).toBytes()) == "ff");
+        REQUIRE(Hex::encode(BigInteger(-128).toBytes()) == "80");
+        REQUIRE(Hex::encode(BigInteger(-129).toBytes()) == "7fff");
+
+        BigInteger twoTo64 = BigInteger::parse("18446744073709551616");
+        REQUIRE(Hex::encode(twoTo64.toBytes()) == "000000000000000001");
+        REQUIRE(Hex::encode((-twoTo64).toBytes()) == "0000000000000000ff");
+        REQUIRE(BigInteger::fromBytes(twoTo64.toBytes()) == twoTo64);
+        REQUIRE(BigInteger::fromBytes(Hex::decode("ff")) == BigInteger(-1));
+        REQUIRE(BigInteger::fromBytes(Bytes()).isZero());
+
+        BigInteger max = BigInteger::parse(MAX_VALUE);
+        REQUIRE(max.getByteLength() == 32);
+        REQUIRE(BigInteger::fromBytes(max.toBytes()) == max);
+        REQUIRE_THROWS_AS(BigInteger::fromBytes(Bytes(33, 0)), IllegalArgumentException);
+    }
+
+    SECTION("Arithmetic and comparison") {
+        BigInteger supply = BigInteger(100000000) * BigInteger::pow10(18);
+        REQUIRE(supply.toString() == "100000000000000000000000000");
+        REQUIRE((supply - supply).isZero());
+        REQUIRE(supply + BigInteger(-1) == BigInteger::parse("99999999999999999999999999"));
+        REQUIRE(BigInteger(-3) * supply == BigInteger::parse("-300000000000000000000000000"));
+        REQUIRE(BigInteger(std::numeric_limits<int64_t>::max()) + BigInteger(1) == BigInteger::parse("9223372036854775808"));
+
+        REQUIRE(BigInteger(-1) < BigInteger(0));
+        REQUIRE(BigInteger::parse(MIN_VALUE) < BigInteger(std::numeric_limits<int64_t>::min()));
+        REQUIRE(supply > BigInteger(std::numeric_limits<int64_t>::max()));
+        REQUIRE(-supply < BigInteger(-1));
+
+        BigInteger max = BigInteger::parse(MAX_VALUE);
+        BigInteger min = BigInteger::parse(MIN_VALUE);
+        REQUIRE_THROWS_AS(max + BigInteger(1), IllegalArgumentException);
+        REQUIRE_THROWS_AS(min - BigInteger(1), IllegalArgumentException);
+        REQUIRE_THROWS_AS(-min, IllegalArgumentException);
+        REQUIRE_THROWS_AS(max * BigInteger(2), IllegalArgumentException);
+        REQUIRE(min == -max - BigInteger(1));
+    }
+
+    SECTION("Stack items and contract parameters") {
+        std::string value = "123456789012345678901234567890";
+        StackItemPtr item = StackItem::fromJson({{"type", "Integer"}, {"value", value}});
+        REQUIRE(item->getBigInteger().toString() == value);
+        REQUIRE(item->toJson()["value"] == value);
+        REQUIRE(item->getBoolean());
+        REQUIRE_THROWS_AS(item->getInteger(), IllegalStateException);
+        REQUIRE(StackItem::fromJson({{"type", "Integer"}, {"value", "7"}})->getInteger() == 7);
+        REQUIRE_THROWS_AS(StackItem::fromJson({{"type", "Integer"}, {"value", "1e5"}}), DeserializationException);
+
+        StackItemArena arena;
+        StackItemView view = arena.add(nlohmann::json{{"type", "Integer"}, {"value", value}});
+        REQUIRE(view.getBigInteger().toString() == value);
+        REQUIRE(view.getBoolean());
+        REQUIRE_THROWS_AS(view.getInteger(), IllegalStateException);
+        REQUIRE(view.toJson()["value"] == value);
+        REQUIRE(view.toStackItem()->getBigInteger() == item->getBigInteger());
+        REQUIRE(arena.add(*item).getBigInteger() == item->getBigInteger());
+
+        ContractParameter parameter = ContractParameter::integer(BigInteger::parse(value));
+        REQUIRE(parameter.toRpcJson()["value"] == value);
+        REQUIRE(ContractParameter::fromRpcJson(parameter.toRpcJson()) == parameter);
+        REQUIRE_THROWS_AS(parameter.getInteger(), IllegalStateException);
+        REQUIRE(ContractParameter::integer(int64_t(5)) == ContractParameter::integer(BigInteger(5)));
+        REQUIRE(ContractParameter::integer(int64_t(5)) < ContractParameter::integer(BigInteger::parse(value)));
+    }
+
+    SECTION("ScriptBuilder pushes wide integers") {
+        ScriptBuilder small;
+        small.pushInteger(BigInteger(1000));
+        REQUIRE(small.toArray() == ScriptBuilder().pushInteger(int64_t(1000)).toArray());
+
+        ScriptBuilder wide;
+        wide.pushInteger(BigInteger::parse("18446744073709551616"));
+        REQUIRE(Hex::encode(wide.toArray()) == "04" "00000000000000000100000000000000");
+
+        ScriptBuilder negative;
+        negative.pushInteger(-BigInteger::parse("18446744073709551616"));
+        REQUIRE(Hex::encode(negative.toArray()) == "04" "0000000000000000ffffffffffffffff");
+
+        ScriptBuilder widest;
+        widest.pushInteger(BigInteger::parse(MAX_VALUE));
+        REQUIRE(widest.toArray().size() == 33);
+        REQUIRE(widest.toArray()[0] == OpCodeHelper::toByte(OpCode::PUSHINT256));
+        REQUIRE(Hex::encode(widest.toArray()).substr(2) == std::string(62, 'f') + "7f");
+
+        ScriptBuilder fromParameter;
+        fromParameter.pushContractParameter(ContractParameter::integer(BigInteger::pow10(30)));
+        REQUIRE(fromParameter.toArray()[0] == OpCodeHelper::toByte(OpCode::PUSHINT128));
+    }
+}
@@ -0,0 +1,188 @@
+#include <catch2/catch_test_macros.hpp>
+#include "stub_rpc_server.hpp"
+#include "neocpp/protocol/chain_state_cache.hpp"
+#include "neocpp/protocol/neo_rpc_client.hpp"
+#include "neocpp/protocol/core/polling/block_polling.hpp"
+#include "neocpp/contract/policy_contract.hpp"
+#include "neocpp/contract/neo_token.hpp"
+#include "neocpp/transaction/network_fee_calculator.hpp"
+#include "neocpp/types/hash160.hpp"
+#include "neocpp/exceptions.hpp"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace neocpp;
+
+#ifdef HAVE_CURL
+
+TEST_CASE("chain_state_cache tests", "[chain_state_cache]") {
+
+    std::atomic<uint32_t> blockCount{1000};
+    test::StubRpcServer server([&](const std::string& method, const nlohmann::json& params) -> nlohmann::json {
+        auto integer = [](const std::string& value) {
+            return nlohmann::json{{"state", "HALT"}, {"stack", {{{"type", "Integer"}, {"value", value}}}}};
+        };
+        if (method == "getblockcount") {
+            return blockCount.load();
+        }
+        if (method == "getcommittee") {
+            return nlohmann::json::array({"02b3622bf4017bdfe317c58aed5f4c753f206b7db896046fa7d774bbc4bf7f8dc2"});
+        }
+        if (method == "invokefunction") {
+            std::string name = params[1].get<std::string>();
+            if (name == "getFeePerByte") return integer("1000");
+            if (name == "getExecFeeFactor") return integer("30");
+            if (name == "balanceOf") return integer("123456789");
+        }
+        throw std::runtime_error("Method not stubbed: " + method);
+    });
+
+    auto client = std::make_shared<NeoRpcClient>(server.getUrl());
+    auto cache = std::make_shared<ChainStateCache>(client);
+
+    SECTION("Repeated lookups are served from the cache") {
+        REQUIRE(cache->getFeePerByte() == 1000);
+        REQUIRE(cache->getFeePerByte() == 1000);
+        REQUIRE(cache->getExecFeeFactor() == 30);
+        REQUIRE(cache->getCommittee().size() == 1);
+        REQUIRE(cache->getCommittee().size() == 1);
+        REQUIRE(cache->getBlockCount() == 1000);
+
+        Hash160 account("0x23ba2703c53263e8d6e522dc32203339dcd8eee9");
+        REQUIRE(cache->getGasBalance(account) == 123456789);
+        REQUIRE(cache->getGasBalance(account) == 123456789);
+
+        REQUIRE(server.getCallCount() == 5);
+        REQUIRE(cache->getStats(ChainStateEntry::FEE_PER_BYTE).hits == 1);
+        REQUIRE(cache->getStats(ChainStateEntry::FEE_PER_BYTE).misses == 1);
+        REQUIRE(cache->getStats().hits == 3);
+        REQUIRE(cache->getStats().misses == 5);
+        REQUIRE(cache->getStats().getHitRate() == 3.0 / 8.0);
+
+        cache->resetStats();
+        REQUIRE(cache->getStats().misses == 0);
+        REQUIRE(cache->getStats().getHitRate() == 0.0);
+    }
+
+    SECTION("New blocks invalidate block-scoped values") {
+        Hash160 account("0x23ba2703c53263e8d6e522dc32203339dcd8eee9");
+        cache->onNewBlock(42);
+        (void)cache->getFeePerByte();
+        (void)cache->getCommittee();
+        (void)cache->getGasBalance(account);
+        REQUIRE(server.getCallCount() == 3);
+
+        // The block count is taken from the block index, without a round trip
+        REQUIRE(cache->getBlockCount() == 43);
+        REQUIRE(server.getCallCount("getblockcount") == 0);
+
+        // Same committee epoch (42 and 43 are both in epoch 2): only the committee survives
+        cache->onNewBlock(43);
+        (void)cache->getFeePerByte();
+        (void)cache->getCommittee();
+        (void)cache->getGasBalance(account);
+        REQUIRE(server.getCallCount("getcommittee") == 1);
+        REQUIRE(server.getCallCount() == 5);
+
+        // Older blocks are ignored
+        cache->onNewBlock(40);
+        (void)cache->getFeePerByte();
+        REQUIRE(server.getCallCount() == 5);
+
+        // Crossing into epoch 3 refreshes the committee
+        cache->onNewBlock(63);
+        (void)cache->getCommittee();
+        REQUIRE(server.getCallCount("getcommittee") == 2);
+    }
+
+    SECTION("Values expire after the maximum age") {
+        auto shortLived = std::make_shared<ChainStateCache>(client, std::chrono::milliseconds(0));
+        (void)shortLived->getFeePerByte();
+        (void)shortLived->getFeePerByte();
+        REQUIRE(server.getCallCount() == 2);
+        REQUIRE(shortLived->getStats().hits == 0);
+    }
+
+    SECTION("Shared across threads") {
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 8; ++t) {
+            threads.emplace_back([&]() {
+                for (int i = 0; i < 50; ++i) {
+                    REQUIRE(cache->getExecFeeFactor() == 30);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        auto stats = cache->getStats(ChainStateEntry::EXEC_FEE_FACTOR);
+        REQUIRE(stats.hits + stats.misses == 400);
+        REQUIRE(static_cast<int>(stats.misses) == server.getCallCount());
+        REQUIRE(stats.getHitRate() > 0.9);
+    }
+
+    SECTION("Contracts and builders share the per-client cache") {
+        REQUIRE(ChainStateCache::forClient(client) == ChainStateCache::forClient(client));
+        REQUIRE(ChainStateCache::forClient(client) != ChainStateCache::forClient(std::make_shared<NeoRpcClient>(server.getUrl())));
+
+        PolicyContract policy(client);
+        NeoToken neo(client);
+        REQUIRE(policy.getFeePerByte() == 1000);
+        REQUIRE(policy.getFeePerByte() == 1000);
+        REQUIRE(neo.getCommittee() == neo.getCommittee());
+        REQUIRE(server.getCallCount() == 2);
+    }
+
+    SECTION("Clearing the fee calculator cache drops the shared policy values") {
+        auto shared = ChainStateCache::forClient(client);
+        REQUIRE(NetworkFeeCalculator::fromClient(client)->getFeePerByte() == 1000);
+        REQUIRE(shared->getBlockCount() == 1000);
+        REQUIRE(server.getCallCount() == 3);
+
+        NetworkFeeCalculator::clearCache();
+        REQUIRE(shared->getBlockCount() == 1000);
+        REQUIRE(server.getCallCount() == 3);
+        REQUIRE(NetworkFeeCalculator::fromClient(client)->getExecFeeFactor() == 30);
+        REQUIRE(server.getCallCount() == 5);
+    }
+
+    SECTION("Caches do not keep their client alive") {
+        auto shortLived = std::make_shared<NeoRpcClient>(server.getUrl());
+        std::weak_ptr<NeoRpcClient> weakClient = shortLived;
+        auto shared = ChainStateCache::forClient(shortLived);
+        REQUIRE(shared->getBlockCount() == 1000);
+
+        shortLived.reset();
+        REQUIRE(weakClient.expired());
+        REQUIRE(shared->getBlockCount() == 1000);
+        shared->invalidateAll();
+        REQUIRE_THROWS_AS(shared->getBlockCount(), IllegalStateException);
+
+        // The registry drops the destroyed client's cache
+        std::weak_ptr<ChainStateCache> weakCache = shared;
+        shared.reset();
+        (void)ChainStateCache::forClient(client);
+        REQUIRE(weakCache.expired());
+    }
+
+    SECTION("Block polling drives invalidation") {
+        blockCount = 50;
+        BlockPolling polling(client, std::chrono::milliseconds(10));
+        cache->subscribeTo(polling);
+        polling.start();
+        for (int i = 0; i < 200 && polling.getLastBlockIndex() != 49; ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        polling.stop();
+
+        REQUIRE(cache->getBlockCount() == 50);
+        REQUIRE(cache->getStats(ChainStateEntry::BLOCK_COUNT).misses == 0);
+
+        ChainStateCache unowned(client);
+        REQUIRE_THROWS_AS(unowned.subscribeTo(polling), IllegalStateException);
+    }
+}
+
+#endif
@@ -0,0 +1,209 @@
+#include <catch2/catch_test_macros.hpp>
+#include "stub_rpc_server.hpp"
+#include "neocpp/protocol/rpc_response_cache.hpp"
+#include "neocpp/protocol/response_types_impl.hpp"
+#include "neocpp/protocol/neo_rpc_client.hpp"
+#include "neocpp/types/hash256.hpp"
+#include "neocpp/exceptions.hpp"
+#include <atomic>
+#include <filesystem>
+#include <string>
+
+using namespace neocpp;
+
+namespace {
+
+const char* const BLOCK_HASH = "0x1f4d1defa46faa5e7b9b8d3f79a06bec777d7c26c4aa5f6f5899a291daa87c15";
+const char* const NEXT_HASH = "0x3d0e7f4a8f4e5b1b4f2ff3d3c9e6a2b6c4d7e8f9a0b1c2d3e4f5a6b7c8d9e0f1";
+const char* const TX_HASH = "0x8b1b1cd5b8b9e6e2a1f5c2fd5ab4b1a4d6ffb5ce24fd4fa1b1f1c2e5d6a7b8c9";
+const char* const ENDPOINT = "http://localhost:10332";
+
+std::string temporaryDirectory(const std::string& name) {
+    auto path = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove_all(path);
+    return path.string();
+}
+
+} // namespace
+
+TEST_CASE("rpc_response_cache tests", "[rpc_response_cache]") {
+
+    SECTION("Least recently used entries are evicted by size") {
+        std::string body(100, 'x');
+        size_t entrySize = RpcResponseCache::makeKey(ENDPOINT, "getblock", {1}).size() + body.size();
+        RpcResponseCache cache(3 * entrySize);
+
+        for (int i = 1; i <= 3; ++i) {
+            cache.put(RpcResponseCache::makeKey(ENDPOINT, "getblock", {i}), body);
+        }
+        std::string found;
+        REQUIRE(cache.get(RpcResponseCache::makeKey(ENDPOINT, "getblock", {1}), found));
+        REQUIRE(found == body);
+
+        // Block 2 is now the least recently used
+        cache.put(RpcResponseCache::makeKey(ENDPOINT, "getblock", {4}), body);
+        REQUIRE_FALSE(cache.get(RpcResponseCache::makeKey(ENDPOINT, "getblock", {2}), found));
+        REQUIRE(cache.get(RpcResponseCache::makeKey(ENDPOINT, "getblock", {1}), found));
+        REQUIRE(cache.get(RpcResponseCache::makeKey(ENDPOINT, "getblock", {3}), found));
+
+        auto stats = cache.getStats();
+        REQUIRE(stats.entryCount == 3);
+        REQUIRE(stats.byteCount == 3 * entrySize);
+        REQUIRE(stats.insertions == 4);
+        REQUIRE(stats.evictions == 1);
+        REQUIRE(stats.hits == 3);
+        REQUIRE(stats.misses == 1);
+        REQUIRE(stats.getHitRate() == 0.75);
+
+        // Larger than the whole budget: not kept
+        cache.put("big", std::string(4 * entrySize, 'y'));
+        REQUIRE_FALSE(cache.get("big", found));
+        REQUIRE(cache.getStats().entryCount == 3);
+
+        cache.clear();
+        cache.resetStats();
+        REQUIRE(cache.getStats().entryCount == 0);
+        REQUIRE(cache.getStats().byteCount == 0);
+        REQUIRE(cache.getStats().hits == 0);
+    }
+
+    SECTION("Entries persist in the on-disk store") {
+        std::string directory = temporaryDirectory("neocpp_rpc_response_cache_test");
+        std::string key = RpcResponseCache::makeKey(ENDPOINT, "getapplicationlog", {TX_HASH});
+        std::string body = "{\"jsonrpc\":\"2.0\",\"id\":1,\"result\":{\"txid\":\"x\"}}\n";
+        {
+            RpcResponseCache cache(1024, directory);
+            cache.put(key, body);
+        }
+
+        RpcResponseCache reopened(1024, directory);
+        std::string found;
+        REQUIRE(reopened.get(key, found));
+        REQUIRE(found == body);
+        REQUIRE(reopened.get(key, found));
+        REQUIRE(reopened.getStats().hits == 2);
+        REQUIRE(reopened.getStats().diskHits == 1);
+
+        // Evicted from memory, still on disk
+        RpcResponseCache tiny(1, directory);
+        REQUIRE(tiny.get(key, found));
+        REQUIRE(found == body);
+        REQUIRE(tiny.getStats().entryCount == 0);
+
+        reopened.clear(true);
+        REQUIRE_FALSE(reopened.get(key, found));
+        std::filesystem::remove_all(directory);
+    }
+}
+
+#ifdef HAVE_CURL
+
+TEST_CASE("rpc_response_cache client tests", "[rpc_response_cache]") {
+
+    std::atomic<bool> tip{false};
+    test::StubRpcServer server([&](const std::string& method, const nlohmann::json& params) -> nlohmann::json {
+        if (method == "getblock") {
+            nlohmann::json block = {{"hash", BLOCK_HASH}, {"index", 100}, {"confirmations", 3}};
+            if (!tip) {
+                block["nextblockhash"] = NEXT_HASH;
+            }
+            return block;
+        }
+        if (method == "getblockhash") {
+            return BLOCK_HASH;
+        }
+        if (method == "getrawtransaction") {
+            nlohmann::json transaction = {{"hash", TX_HASH}, {"size", 252}};
+            if (params[0] == Hash256(BLOCK_HASH).toString()) {
+                transaction["blockhash"] = BLOCK_HASH;
+            }
+            return transaction;
+        }
+        if (method == "getapplicationlog") {
+            if (params[0] == Hash256(BLOCK_HASH).toString()) {
+                throw std::runtime_error("Unknown transaction");
+            }
+            return {{"txid", TX_HASH}, {"executions", nlohmann::json::array()}};
+        }
+        throw std::runtime_error("Method not stubbed: " + method);
+    });
+
+    auto client = std::make_shared<NeoRpcClient>(server.getUrl());
+    auto cache = std::make_shared<RpcResponseCache>();
+    client->setResponseCache(cache);
+
+    SECTION("Final results are fetched once") {
+        REQUIRE(client->getBlock(100)->getIndex() == 100);
+        REQUIRE(client->getBlock(100)->getHash() == Hash256(BLOCK_HASH));
+        REQUIRE(client->getBlockHash(100) == Hash256(BLOCK_HASH));
+        REQUIRE(client->getBlockHash(100) == Hash256(BLOCK_HASH));
+        REQUIRE(client->getApplicationLog(Hash256(TX_HASH))->getTxId() == TX_HASH);
+        REQUIRE(client->getApplicationLog(Hash256(TX_HASH))->getTxId() == TX_HASH);
+        REQUIRE(client->getRawTransaction(Hash256(TX_HASH), false)->getHash() == Hash256(TX_HASH));
+        REQUIRE(client->getRawTransaction(Hash256(TX_HASH), false)->getHash() == Hash256(TX_HASH));
+
+        REQUIRE(server.getCallCount() == 4);
+        REQUIRE(cache->getStats().hits == 4);
+        REQUIRE(cache->getStats().misses == 4);
+        REQUIRE(cache->getStats().entryCount == 4);
+
+        // Same block by index with other parameters is another entry
+        REQUIRE(client->getBlock(100, false)->getIndex() == 100);
+        REQUIRE(server.getCallCount() == 5);
+    }
+
+    SECTION("Results that can still change are not stored") {
+        tip = true;
+        REQUIRE_FALSE(client->getBlock(100)->hasNextBlockHash());
+        REQUIRE_FALSE(client->getBlock(100)->hasNextBlockHash());
+        REQUIRE(server.getCallCount() == 2);
+
+        tip = false;
+        REQUIRE(client->getBlock(100)->hasNextBlockHash());
+        REQUIRE(client->getBlock(100)->hasNextBlockHash());
+        REQUIRE(server.getCallCount() == 3);
+
+        // Unconfirmed verbose transaction, then a confirmed one
+        REQUIRE(client->getRawTransaction(Hash256(TX_HASH))->getBlockHash() == Hash256());
+        REQUIRE(client->getRawTransaction(Hash256(TX_HASH))->getBlockHash() == Hash256());
+        REQUIRE(client->getRawTransaction(Hash256(BLOCK_HASH))->getBlockHash() == Hash256(BLOCK_HASH));
+        REQUIRE(client->getRawTransaction(Hash256(BLOCK_HASH))->getBlockHash() == Hash256(BLOCK_HASH));
+        REQUIRE(server.getCallCount() == 6);
+
+        // Errors are not stored
+        REQUIRE_THROWS_AS(client->getApplicationLog(Hash256(BLOCK_HASH)), RpcException);
+        REQUIRE_THROWS_AS(client->getApplicationLog(Hash256(BLOCK_HASH)), RpcException);
+        REQUIRE(server.getCallCount() == 8);
+    }
+
+    SECTION("Clients of different nodes do not share entries") {
+        test::StubRpcServer other([](const std::string& method, const nlohmann::json& params) -> nlohmann::json {
+            if (method == "getblock") {
+                return {{"hash", NEXT_HASH}, {"index", params[0]}, {"nextblockhash", BLOCK_HASH}};
+            }
+            throw std::runtime_error("Method not stubbed: " + method);
+        });
+        auto otherClient = std::make_shared<NeoRpcClient>(other.getUrl());
+        otherClient->setResponseCache(cache);
+
+        REQUIRE(client->getBlock(100)->getHash() == Hash256(BLOCK_HASH));
+        REQUIRE(otherClient->getBlock(100)->getHash() == Hash256(NEXT_HASH));
+        REQUIRE(otherClient->getBlock(100)->getHash() == Hash256(NEXT_HASH));
+        REQUIRE(client->getBlock(100)->getHash() == Hash256(BLOCK_HASH));
+        REQUIRE(server.getCallCount() == 1);
+        REQUIRE(other.getCallCount() == 1);
+        REQUIRE(cache->getStats().entryCount == 2);
+        REQUIRE(RpcResponseCache::makeKey(server.getUrl(), "getblock", {100}) !=
+                RpcResponseCache::makeKey(other.getUrl(), "getblock", {100}));
+    }
+
+    SECTION("Without a cache every call reaches the node") {
+        client->setResponseCache(nullptr);
+        REQUIRE(client->getBlock(100)->getIndex() == 100);
+        REQUIRE(client->getBlock(100)->getIndex() == 100);
+        REQUIRE(server.getCallCount() == 2);
+        REQUIRE(cache->getStats().misses == 0);
+    }
+}
+
+#endif
@@ -0,0 +1,217 @@
+#include <catch2/catch_test_macros.hpp>
+#include "stub_rpc_server.hpp"
+#include "neocpp/protocol/rpc_response_reader.hpp"
+#include "neocpp/protocol/response_types_impl.hpp"
+#include "neocpp/protocol/neo_rpc_client.hpp"
+#include "neocpp/protocol/stack_item.hpp"
+#include "neocpp/exceptions.hpp"
+#include <string>
+
+using namespace neocpp;
+
+namespace {
+
+const char* const BLOCK_HASH = "0x1f4d1defa46faa5e7b9b8d3f79a06bec777d7c26c4aa5f6f5899a291daa87c15";
+const char* const TX_HASH = "0x8b1b1cd5b8b9e6e2a1f5c2fd5ab4b1a4d6ffb5ce24fd4fa1b1f1c2e5d6a7b8c9";
+
+nlohmann::json blockResult() {
+    nlohmann::json witness = {{"invocation", "DEDN8o6cmOUt/pfRIexVzO2shhX2vTYFd+cU8vZDQ2Dvn3pe/vHcYOSlY3lPRKecb5zBuLCqaKSvZsC1FAbT00dWDEDoPojm4aw9JEHsyvxsfb0Dz7HNZm8ZaeZkwJsf2TJq1bDc5JLj1mNvZ1MzKNXl2NuANDcXxSd2pNQJRHS20eHa"}, {"verification", "EQwhAkhv0VcCxEkKJnAxEqXMHQkj/Wl6M0Br1aHADgATsJpwEUGe0Nw6"}};
+    nlohmann::json tx = {{"hash", TX_HASH}, {"size", 252}, {"version", 0}, {"nonce", 1234}, {"sender", "NaZjSxmRZ4ErG2QEXCQMjjJfYAxcbN9b1e"}, {"sysfee", "9977780"}, {"netfee", "1248450"}, {"validuntilblock", 2105487}, {"signers", {{{"account", "0x69ecca587293047be4c59159bf8bc399985c160d"}, {"scopes", "CalledByEntry"}}}}, {"attributes", nlohmann::json::array()}, {"script", "CwMA6HZIFwAAAAwUDRZcmJnDi78Z"}, {"witnesses", {witness}}};
+    return {
+        {"hash", BLOCK_HASH},
+        {"size", 1528},
+        {"version", 0},
+        {"previousblockhash", "0x0a2ea7a7e4cbc3e57c5bdc7c55eb7e1fbb3bc3ce6b4d5d2d7b4fd5a7e1f1c2e5"},
+        {"merkleroot", "0x5a0fbca3f3f4a8b1c0f5ad0fb9d9b8d7a1e2f3c4b5a6978877665544332211ff"},
+        {"time", 1627896461306ULL},
+        {"nonce", "7FC63D71C7C5B4D7"},
+        {"index", 2105482},
+        {"primary", 3},
+        {"nextconsensus", "NgPkjjLTNcQad99iRYeXRUuowE4gxLAnDL"},
+        {"witnesses", {witness}},
+        {"tx", {tx, tx}},
+        {"confirmations", 7},
+        {"nextblockhash", "0x3d0e7f4a8f4e5b1b4f2ff3d3c9e6a2b6c4d7e8f9a0b1c2d3e4f5a6b7c8d9e0f1"}
+    };
+}
+
+nlohmann::json applicationLogResult() {
+    nlohmann::json notification = {{"contract", "0xd2a4cff31913016155e38e474a2c06d08be276cf"}, {"eventname", "Transfer"}, {"state", {{"type", "Array"}, {"value", {{{"type", "Any"}}, {{"type", "ByteString"}, {"value", "z6LDQN4w2H5wA8tsyKy9kwAwhS8="}}, {{"type", "Integer"}, {"value", "50000000"}}}}}}};
+    return {
+        {"txid", TX_HASH},
+        {"executions", {{{"trigger", "Application"}, {"vmstate", "HALT"}, {"exception", nullptr}, {"gasconsumed", "9977780"}, {"stack", {{{"type", "Boolean"}, {"value", true}}}}, {"notifications", {notification, notification}}}}}
+    };
+}
+
+nlohmann::json invokeResult() {
+    return {
+        {"script", "EMAfDARuYW1lDBT1Y+pAvCg9TQ4FxI6jBbPyoHNA70FifVtS"},
+        {"state", "HALT"},
+        {"gasconsumed", "2007570"},
+        {"exception", nullptr},
+        {"notifications", nlohmann::json::array()},
+        {"stack", {{{"type", "Integer"}, {"value", "42"}}, {{"type", "Array"}, {"value", {{{"type", "ByteString"}, {"value", "616263"}}}}}}}
+    };
+}
+
+std::string envelope(const nlohmann::json& result) {
+    return nlohmann::json{{"jsonrpc", "2.0"}, {"id", 1}, {"result", result}}.dump();
+}
+
+} // namespace
+
+TEST_CASE("rpc_response_reader tests", "[rpc_response_reader]") {
+
+    SECTION("Block decoded from text matches the tree parser") {
+        NeoGetBlockResponse fromTree;
+        fromTree.parseJson(blockResult());
+        NeoGetBlockResponse fromText;
+        fromText.parseResponse(envelope(blockResult()));
+
+        REQUIRE(fromText.getHash() == fromTree.getHash());
+        REQUIRE(fromText.getHash() == Hash256::fromHexString(BLOCK_HASH));
+        REQUIRE(fromText.getSize() == 1528);
+        REQUIRE(fromText.getPreviousBlockHash() == fromTree.getPreviousBlockHash());
+        REQUIRE(fromText.getMerkleRoot() == fromTree.getMerkleRoot());
+        REQUIRE(fromText.getTime() == 1627896461306ULL);
+        REQUIRE(fromText.getIndex() == 2105482);
+        REQUIRE(fromText.getNextConsensus() == fromTree.getNextConsensus());
+        REQUIRE(fromText.getWitnesses() == fromTree.getWitnesses());
+        REQUIRE(fromText.getTransactions() == fromTree.getTransactions());
+        REQUIRE(fromText.getTransactions().size() == 2);
+        REQUIRE(fromText.getConfirmations() == 7);
+        REQUIRE(fromText.hasNextBlockHash());
+        REQUIRE(fromText.getNextBlockHash() == fromTree.getNextBlockHash());
+        REQUIRE(fromText.getRawJson() == blockResult());
+    }
+
+    SECTION("Transaction, application log and invocation results") {
+        nlohmann::json tx = blockResult()["tx"][0];
+        tx["blockhash"] = BLOCK_HASH;
+        tx["blocktime"] = 1627896461306ULL;
+        NeoGetRawTransactionResponse txResponse;
+        txResponse.parseResponse(envelope(tx));
+        REQUIRE(txResponse.getNonce() == 1234);
+        REQUIRE(txResponse.getSysfee() == "9977780");
+        REQUIRE(txResponse.getSigners() == tx["signers"]);
+        REQUIRE(txResponse.getAttributes() == nlohmann::json::array());
+        REQUIRE(txResponse.getBlockHash() == Hash256::fromHexString(BLOCK_HASH));
+        REQUIRE(txResponse.getBlockTime() == 1627896461306ULL);
+
+        NeoGetApplicationLogResponse logResponse;
+        logResponse.parseResponse(envelope(applicationLogResult()));
+        REQUIRE(logResponse.getTxId() == TX_HASH);
+        REQUIRE(logResponse.getExecutions() == applicationLogResult()["executions"]);
+
+        NeoInvokeResultResponse invokeResponse;
+        invokeResponse.parseResponse(envelope(invokeResult()));
+        REQUIRE(invokeResponse.getState() == "HALT");
+        REQUIRE_FALSE(invokeResponse.hasException());
+        REQUIRE(invokeResponse.getStack().size() == 2);
+        REQUIRE(invokeResponse.getStack()[0]->getInteger() == 42);
+        REQUIRE(invokeResponse.getStack()[1]->getArray()[0]->getString() == "abc");
+        REQUIRE(invokeResponse.getRawJson() == invokeResult());
+    }
+
+    SECTION("Envelope members in any order; unknown members are skipped") {
+        std::string body = "{\"result\":{\"unknown\":{\"deep\":[1,[2,{\"txid\":\"wrong\"}]]},\"txid\":\"abc\","
+                           "\"extra\":[{\"executions\":1}],\"executions\":[{\"n\":-1.5,\"ok\":false,\"x\":null}]},"
+                           "\"id\":3,\"jsonrpc\":\"2.0\"}";
+        NeoGetApplicationLogResponse response;
+        response.parseResponse(body);
+        REQUIRE(response.getTxId() == "abc");
+        REQUIRE(response.getExecutions() == nlohmann::json::parse("[{\"n\":-1.5,\"ok\":false,\"x\":null}]"));
+    }
+
+    SECTION("Error responses and malformed bodies") {
+        NeoGetBlockResponse response;
+        try {
+            response.parseResponse("{\"jsonrpc\":\"2.0\",\"id\":1,\"error\":{\"code\":-100,\"message\":\"Unknown block\"}}");
+            FAIL("expected an RpcException");
+        } catch (const RpcException& e) {
+            REQUIRE(std::string(e.what()).find("Unknown block") != std::string::npos);
+        }
+        REQUIRE_THROWS_AS(response.parseResponse("{\"jsonrpc\":\"2.0\",\"id\":1}"), RpcException);
+        REQUIRE_THROWS_AS(response.parseResponse("{\"jsonrpc\":\"2.0\",\"id\":1,\"result\":null}"), RpcException);
+        REQUIRE_THROWS_AS(response.parseResponse("{\"result\":{\"size\":1"), RpcException);
+        REQUIRE_THROWS_AS(response.parseResponse("[]"), RpcException);
+        REQUIRE_THROWS_AS(response.parseResponse(""), RpcException);
+    }
+
+    SECTION("Non-verbose results are scalars") {
+        NeoGetBlockResponse block;
+        block.parseResponse("{\"jsonrpc\":\"2.0\",\"id\":1,\"result\":\"AAAAAA==\"}");
+        REQUIRE(block.getIndex() == 0);
+        REQUIRE(block.getRawJson() == "AAAAAA==");
+
+        NeoGetRawTransactionResponse transaction;
+        transaction.parseResponse("{\"result\":\"AQID\",\"jsonrpc\":\"2.0\",\"id\":1}");
+        REQUIRE(transaction.getRawJson() == "AQID");
+    }
+
+    SECTION("Visiting an already parsed result") {
+        struct Collector : RpcResultVisitor {
+            void onValue(const std::string& key, nlohmann::json&& value) override {
+                values[key] = std::move(value);
+            }
+            nlohmann::json* onStructure(const std::string& key) override {
+                return key == "keep" ? &kept : nullptr;
+            }
+            nlohmann::json values = nlohmann::json::object();
+            nlohmann::json kept;
+        };
+        nlohmann::json result = {{"a", 1}, {"b", "two"}, {"keep", {1, 2}}, {"skip", {{"c", 3}}}};
+
+        Collector fromTree;
+        RpcResponseReader::visit(result, fromTree);
+        Collector fromText;
+        RpcResponseReader::read(envelope(result), fromText);
+        REQUIRE(fromTree.values == nlohmann::json{{"a", 1}, {"b", "two"}});
+        REQUIRE(fromText.values == fromTree.values);
+        REQUIRE(fromText.kept == nlohmann::json{1, 2});
+        REQUIRE(fromText.kept == fromTree.kept);
+    }
+}
+
+#ifdef HAVE_CURL
+
+TEST_CASE("rpc_response_reader client tests", "[rpc_response_reader]") {
+    test::StubRpcServer server([](const std::string& method, const nlohmann::json& params) -> nlohmann::json {
+        if (method == "getblock") {
+            if (params[0] == 404) {
+                throw std::runtime_error("Unknown block");
+            }
+            return params[1] == false ? nlohmann::json("AAAAAA==") : blockResult();
+        }
+        if (method == "getrawtransaction") {
+            return "AQID";
+        }
+        if (method == "getapplicationlog") {
+            return applicationLogResult();
+        }
+        if (method == "invokefunction") {
+            return invokeResult();
+        }
+        throw std::runtime_error("Method not stubbed: " + method);
+    });
+    NeoRpcClient client(server.getUrl());
+
+    auto block = client.getBlock(2105482u, true);
+    REQUIRE(block->getIndex() == 2105482);
+    REQUIRE(block->getTransactions() == blockResult()["tx"]);
+
+    auto log = client.getApplicationLog(Hash256::fromHexString(TX_HASH));
+    REQUIRE(log->getExecutions() == applicationLogResult()["executions"]);
+
+    auto invocation = client.invokeFunction(Hash160("d2a4cff31913016155e38e474a2c06d08be276cf"), "symbol");
+    REQUIRE(invocation->getStack()[0]->getInteger() == 42);
+    REQUIRE(invocation->getRawJson()["gasconsumed"] == "2007570");
+
+    REQUIRE_THROWS_AS(client.getBlock(404u, true), RpcException);
+
+    // Non-verbose calls return the base64 payload as the result
+    REQUIRE(client.getBlock(2105482u, false)->getRawJson() == "AAAAAA==");
+    REQUIRE(client.getRawTransaction(Hash256::fromHexString(TX_HASH), false)->getRawJson() == "AQID");
+}
+
+#endif
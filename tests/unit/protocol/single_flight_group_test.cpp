@@ -0,0 +1,209 @@
+#include <catch2/catch_test_macros.hpp>
+#include "stub_rpc_server.hpp"
+#include "neocpp/protocol/single_flight_group.hpp"
+#include "neocpp/protocol/response_types_impl.hpp"
+#include "neocpp/protocol/neo_rpc_client.hpp"
+#include "neocpp/types/hash160.hpp"
+#include "neocpp/types/hash256.hpp"
+#include "neocpp/exceptions.hpp"
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace neocpp;
+
+namespace {
+
+const char* const BLOCK_HASH = "0x1f4d1defa46faa5e7b9b8d3f79a06bec777d7c26c4aa5f6f5899a291daa87c15";
+const char* const GAS_HASH = "0xd2a4cff31913016155e38e474a2c06d08be276cf";
+const char* const ACCOUNT = "0x23ba2703c53263e8d6e522dc32203339dcd8eee9";
+
+constexpr int CALLERS = 16;
+
+/// Run call on CALLERS threads released at the same moment and collect the results
+template <typename Call>
+auto runConcurrently(Call call) {
+    using Result = decltype(call());
+    std::promise<void> start;
+    std::shared_future<void> started = start.get_future().share();
+    std::vector<std::future<Result>> futures;
+    for (int i = 0; i < CALLERS; ++i) {
+        futures.push_back(std::async(std::launch::async, [&call, started]() {
+            started.wait();
+            return call();
+        }));
+    }
+    start.set_value();
+    std::vector<Result> results;
+    for (auto& future : futures) {
+        results.push_back(future.get());
+    }
+    return results;
+}
+
+} // namespace
+
+TEST_CASE("single_flight_group tests", "[single_flight_group]") {
+
+    SECTION("Waiting callers share the running call") {
+        SingleFlightGroup group;
+        std::promise<void> release;
+        std::shared_future<void> released = release.get_future().share();
+        std::atomic<int> runs{0};
+
+        auto leader = std::async(std::launch::async, [&]() {
+            return group.run<int>("key", [&]() {
+                ++runs;
+                released.wait();
+                return std::make_shared<int>(42);
+            });
+        });
+        while (group.getInFlightCount() == 0) {
+            std::this_thread::yield();
+        }
+
+        bool shared = false;
+        auto follower = std::async(std::launch::async, [&]() {
+            return group.run<int>("key", [&]() { ++runs; return std::make_shared<int>(0); }, &shared);
+        });
+        while (group.getStats().shared == 0) {
+            std::this_thread::yield();
+        }
+        release.set_value();
+
+        auto first = leader.get();
+        auto second = follower.get();
+        REQUIRE(*first == 42);
+        REQUIRE(first == second);
+        REQUIRE(shared);
+        REQUIRE(runs == 1);
+        REQUIRE(group.getInFlightCount() == 0);
+
+        // Finished calls are not reused
+        REQUIRE(*group.run<int>("key", []() { return std::make_shared<int>(7); }) == 7);
+        REQUIRE(group.getStats().executions == 2);
+        REQUIRE(group.getStats().shared == 1);
+        group.resetStats();
+        REQUIRE(group.getStats().executions == 0);
+    }
+
+    SECTION("Exceptions reach every waiting caller") {
+        SingleFlightGroup group;
+        std::promise<void> release;
+        std::shared_future<void> released = release.get_future().share();
+
+        auto leader = std::async(std::launch::async, [&]() {
+            return group.run<int>("key", [&]() -> SharedPtr<int> {
+                released.wait();
+                throw RpcException("RPC error: unknown block");
+            });
+        });
+        while (group.getInFlightCount() == 0) {
+            std::this_thread::yield();
+        }
+        auto follower = std::async(std::launch::async, [&]() {
+            return group.run<int>("key", []() { return std::make_shared<int>(0); });
+        });
+        while (group.getStats().shared == 0) {
+            std::this_thread::yield();
+        }
+        release.set_value();
+
+        REQUIRE_THROWS_AS(leader.get(), RpcException);
+        REQUIRE_THROWS_AS(follower.get(), RpcException);
+        REQUIRE(group.getInFlightCount() == 0);
+    }
+}
+
+#ifdef HAVE_CURL
+
+TEST_CASE("single_flight_group client tests", "[single_flight_group]") {
+
+    std::atomic<bool> withSession{false};
+    test::StubRpcServer server([&](const std::string& method, const nlohmann::json& params) -> nlohmann::json {
+        if (method == "getblock") {
+            return {{"hash", BLOCK_HASH}, {"index", params[0]}};
+        }
+        if (method == "getblockcount") {
+            return 1000;
+        }
+        if (method == "invokefunction") {
+            nlohmann::json result = {{"state", "HALT"}, {"stack", {{{"type", "Integer"}, {"value", "123456789"}}}}};
+            if (withSession) {
+                result["session"] = "5c9f8bd1-25a6-4b8a-a5b4-1a8f6c3a2b1d";
+            }
+            return result;
+        }
+        if (method == "getapplicationlog") {
+            throw std::runtime_error("Unknown transaction");
+        }
+        throw std::runtime_error("Method not stubbed: " + method);
+    }, std::chrono::milliseconds(300));
+
+    auto client = std::make_shared<NeoRpcClient>(server.getUrl());
+    auto group = std::make_shared<SingleFlightGroup>();
+    client->setSingleFlight(group);
+
+    SECTION("Identical concurrent calls make one upstream request") {
+        auto blocks = runConcurrently([&]() { return client->getBlock(7); });
+        REQUIRE(server.getCallCount() == 1);
+        for (const auto& block : blocks) {
+            REQUIRE(block == blocks[0]);
+        }
+        REQUIRE(blocks[0]->getIndex() == 7);
+        REQUIRE(group->getStats().executions == 1);
+        REQUIRE(group->getStats().shared == CALLERS - 1);
+
+        nlohmann::json params = nlohmann::json::array({{{"type", "Hash160"}, {"value", ACCOUNT}}});
+        auto balances = runConcurrently([&]() {
+            return client->invokeFunction(Hash160(GAS_HASH), "balanceOf", params)->getStack()[0]->getInteger();
+        });
+        REQUIRE(server.getCallCount() == 2);
+        for (int64_t balance : balances) {
+            REQUIRE(balance == 123456789);
+        }
+
+        auto counts = runConcurrently([&]() { return client->getBlockCount(); });
+        REQUIRE(server.getCallCount() == 3);
+        REQUIRE(counts[CALLERS - 1] == 1000);
+
+        // Calls that are not in flight together are all sent
+        REQUIRE(client->getBlock(7)->getIndex() == 7);
+        REQUIRE(server.getCallCount() == 4);
+    }
+
+    SECTION("Different parameters are different calls") {
+        std::atomic<uint32_t> next{0};
+        auto blocks = runConcurrently([&]() { return client->getBlock(next++ % 2); });
+        REQUIRE(server.getCallCount() == 2);
+        REQUIRE(group->getStats().executions == 2);
+    }
+
+    SECTION("Errors are shared") {
+        std::atomic<int> failures{0};
+        runConcurrently([&]() {
+            try {
+                (void)client->getApplicationLog(Hash256(BLOCK_HASH));
+            } catch (const RpcException&) {
+                ++failures;
+            }
+            return 0;
+        });
+        REQUIRE(failures == CALLERS);
+        REQUIRE(server.getCallCount() == 1);
+    }
+
+    SECTION("Invocations with an iterator session are not shared") {
+        withSession = true;
+        auto sessions = runConcurrently([&]() {
+            return client->invokeFunction(Hash160(GAS_HASH), "tokensOf")->getSessionId();
+        });
+        REQUIRE(server.getCallCount() == CALLERS);
+        REQUIRE(sessions[0] == "5c9f8bd1-25a6-4b8a-a5b4-1a8f6c3a2b1d");
+    }
+}
+
+#endif
@@ -0,0 +1,208 @@
+#include <catch2/catch_test_macros.hpp>
+#include "neocpp/protocol/stack_item_arena.hpp"
+#include "neocpp/protocol/response_types_impl.hpp"
+#include "neocpp/protocol/rpc_response_reader.hpp"
+#include "neocpp/exceptions.hpp"
+#include <string>
+
+using namespace neocpp;
+
+namespace {
+
+nlohmann::json nestedItem() {
+    return nlohmann::json::parse(R"({
+        "type": "Array",
+        "value": [
+            {"type": "Integer", "value": "-42"},
+            {"type": "Boolean", "value": true},
+            {"type": "ByteString", "value": "6e656f"},
+            {"type": "Struct", "value": [{"type": "Pointer", "value": 7}]},
+            {"type": "Map", "value": [
+                {"key": {"type": "ByteString", "value": "6b6579"}, "value": {"type": "Integer", "value": "9000000000"}},
+                {"key": {"type": "Integer", "value": "1"}, "value": {"type": "InteropInterface", "interface": "IIterator"}}
+            ]},
+            {"type": "Array", "value": []}
+        ]
+    })");
+}
+
+} // namespace
+
+TEST_CASE("stack_item_arena tests", "[stack_item_arena]") {
+
+    SECTION("Views read nested items without copying") {
+        StackItemArena arena;
+        StackItemView root = arena.add(nestedItem());
+
+        REQUIRE(root.getType() == StackItemType::ARRAY);
+        REQUIRE(root.isArray());
+        REQUIRE(root.size() == 6);
+        REQUIRE(root.getBoolean());
+        REQUIRE(root.at(0).getInteger() == -42);
+        REQUIRE(root.at(1).getBoolean());
+        REQUIRE(root.at(1).getInteger() == 1);
+        REQUIRE(root.at(2).getString() == "neo");
+        REQUIRE(root.at(2).getBytes() == ByteView(Bytes{'n', 'e', 'o'}));
+        REQUIRE(root.at(3).getType() == StackItemType::STRUCT);
+        REQUIRE(root.at(3).at(0).getInteger() == 7);
+
+        StackItemView map = root.at(4);
+        REQUIRE(map.isMap());
+        REQUIRE(map.size() == 2);
+        REQUIRE(map.keyAt(0).getString() == "key");
+        REQUIRE(map.valueAt(0).getInteger() == 9000000000LL);
+        REQUIRE(map.valueAt(1).getString() == "IIterator");
+        REQUIRE_FALSE(root.at(5).getBoolean());
+
+        REQUIRE(arena.itemCount() == 12);
+        REQUIRE(arena.byteCount() == 3 + 3 + 9);
+
+        // Views stay valid while the arena grows
+        StackItemView first = root.at(2);
+        for (int i = 0; i < 1000; ++i) {
+            arena.add(nlohmann::json{{"type", "ByteString"}, {"value", "00ff"}});
+        }
+        REQUIRE(first.getString() == "neo");
+    }
+
+    SECTION("Conversion to and from StackItem and JSON") {
+        StackItemArena arena;
+        StackItemView root = arena.add(nestedItem());
+        REQUIRE(root.toJson() == nestedItem());
+
+        StackItemPtr item = root.toStackItem();
+        REQUIRE(item->getType() == StackItemType::ARRAY);
+        auto elements = item->getArray();
+        REQUIRE(elements.size() == 6);
+        REQUIRE(elements[0]->getInteger() == -42);
+        REQUIRE(elements[2]->getByteArray() == Bytes{'n', 'e', 'o'});
+        REQUIRE(elements[3]->getType() == StackItemType::STRUCT);
+        REQUIRE(elements[4]->getMap().size() == 2);
+
+        StackItemView copy = arena.add(*item);
+        REQUIRE(copy.at(0).getInteger() == -42);
+        REQUIRE(copy.at(2).getString() == "neo");
+        REQUIRE(copy.at(4).size() == 2);
+        REQUIRE(copy.at(3).toJson() == root.at(3).toJson());
+    }
+
+    SECTION("Type and bounds errors") {
+        StackItemArena arena;
+        StackItemView root = arena.add(nestedItem());
+        REQUIRE_THROWS_AS(root.at(6), IllegalArgumentException);
+        REQUIRE_THROWS_AS(root.getInteger(), IllegalStateException);
+        REQUIRE_THROWS_AS(root.at(0).size(), IllegalStateException);
+        REQUIRE_THROWS_AS(root.at(0).getBytes(), IllegalStateException);
+        REQUIRE_THROWS_AS(root.at(4).at(0), IllegalStateException);
+        REQUIRE_THROWS_AS(root.keyAt(0), IllegalStateException);
+        REQUIRE_THROWS_AS(root.at(3).at(0).getBoolean(), IllegalStateException);
+
+        REQUIRE_THROWS_AS(arena.add(nlohmann::json{{"value", 1}}), DeserializationException);
+        REQUIRE_THROWS_AS(arena.add(nlohmann::json{{"type", "Unknown"}}), DeserializationException);
+        REQUIRE_THROWS_AS(arena.add(nlohmann::json{{"type", "Integer"}, {"value", "12x"}}), DeserializationException);
+
+        // Invalid hex gives an empty byte string, as StackItem::fromJson does
+        REQUIRE(arena.add(nlohmann::json{{"type", "ByteString"}, {"value", "zz"}}).getBytes().empty());
+
+        arena.clear();
+        REQUIRE(arena.itemCount() == 0);
+        REQUIRE(arena.byteCount() == 0);
+    }
+
+    SECTION("Invocation results keep their stack in an arena") {
+        nlohmann::json page = {{"type", "Array"}, {"value", nlohmann::json::array()}};
+        for (int i = 0; i < 500; ++i) {
+            page["value"].push_back({{"type", "ByteString"}, {"value", "0a0b0c"}});
+        }
+        nlohmann::json result = {{"state", "HALT"}, {"stack", {page, {{"type", "Integer"}, {"value", "5"}}}}};
+
+        NeoInvokeResultResponse response;
+        response.parseJson(result);
+        REQUIRE(response.getStackViews().size() == 2);
+        REQUIRE(response.getStackViews()[0].size() == 500);
+        REQUIRE(response.getStackViews()[0].at(499).getBytes() == ByteView(Bytes{0x0a, 0x0b, 0x0c}));
+        REQUIRE(response.getStackViews()[1].getInteger() == 5);
+
+        const auto& stack = response.getStack();
+        REQUIRE(stack.size() == 2);
+        REQUIRE(stack[0]->getArray().size() == 500);
+        REQUIRE(stack[1]->getInteger() == 5);
+        REQUIRE(&response.getStack() == &stack);
+
+        NeoInvokeResultResponse copy = response;
+        REQUIRE(copy.getStackViews()[0].at(0).getBytes().size() == 3);
+    }
+
+    SECTION("Stacks are read from parser events without a JSON value") {
+        nlohmann::json stack = {nestedItem(), {{"type", "Integer"}, {"value", "5"}}};
+        StackItemArena added;
+        for (const auto& item : stack) {
+            added.add(item);
+        }
+
+        std::string body = nlohmann::json{{"jsonrpc", "2.0"}, {"id", 1},
+                                          {"result", {{"state", "HALT"}, {"stack", stack}}}}.dump();
+        NeoInvokeResultResponse response;
+        response.parseResponse(body);
+        const auto& views = response.getStackViews();
+        REQUIRE(views.size() == 2);
+        REQUIRE(views[0].toJson() == nestedItem());
+        REQUIRE(views[0].at(4).keyAt(0).getString() == "key");
+        REQUIRE(views[1].getInteger() == 5);
+        REQUIRE(response.getStack()[0]->getArray().size() == 6);
+
+        struct StackVisitor : RpcResultVisitor {
+            explicit StackVisitor(StackItemArena& arena) : reader(arena) {}
+            RpcEventSink* onEvents(const std::string& key) override {
+                return key == "stack" ? &reader : nullptr;
+            }
+            StackItemArena::StackReader reader;
+        };
+        StackItemArena streamed;
+        StackVisitor visitor(streamed);
+        RpcResponseReader::read(body, visitor);
+        REQUIRE(visitor.reader.getViews().size() == 2);
+        REQUIRE(streamed.itemCount() == added.itemCount());
+        REQUIRE(streamed.byteCount() == added.byteCount());
+    }
+
+    SECTION("Members of stream-read items in any order") {
+        std::string body = R"({"result":{"stack":[
+            {"value":[{"value":"01","type":"ByteString"},{"type":"Integer","value":"2"}],"type":"Struct"},
+            {"value":"7","extra":{"a":[1]},"type":"Integer"},
+            {"type":"Map","value":[{"value":{"type":"Boolean","value":true},"key":{"type":"Integer","value":"3"}},{"key":{"type":"Integer","value":"4"}},5]},
+            {"interface":"IIterator","type":"InteropInterface"}
+        ]}})";
+        NeoInvokeResultResponse response;
+        response.parseResponse(body);
+        const auto& views = response.getStackViews();
+        REQUIRE(views.size() == 4);
+        REQUIRE(views[0].getType() == StackItemType::STRUCT);
+        REQUIRE(views[0].at(0).getBytes() == ByteView(Bytes{0x01}));
+        REQUIRE(views[0].at(1).getInteger() == 2);
+        REQUIRE(views[1].getInteger() == 7);
+        REQUIRE(views[2].size() == 1);
+        REQUIRE(views[2].keyAt(0).getInteger() == 3);
+        REQUIRE(views[2].valueAt(0).getBoolean());
+        REQUIRE(views[3].getString() == "IIterator");
+    }
+
+    SECTION("Invalid stream-read items") {
+        auto parse = [](const std::string& stack) {
+            NeoInvokeResultResponse response;
+            response.parseResponse("{\"result\":{\"stack\":" + stack + "}}");
+        };
+        REQUIRE_THROWS_AS(parse(R"([{"value":"1"}])"), DeserializationException);
+        REQUIRE_THROWS_AS(parse(R"([{"type":"Unknown"}])"), DeserializationException);
+        REQUIRE_THROWS_AS(parse(R"([{"type":"Integer","value":"12x"}])"), DeserializationException);
+        REQUIRE_THROWS_AS(parse(R"([{"type":"Boolean","value":[true]}])"), DeserializationException);
+        REQUIRE_THROWS_AS(parse(R"([{"type":"Array","value":[1]}])"), DeserializationException);
+        REQUIRE_THROWS_AS(parse(R"([{"type":"Array","value":{}}])"), DeserializationException);
+        REQUIRE_THROWS_AS(parse(R"({"type":"Integer","value":"1"})"), DeserializationException);
+
+        // A stack the node could not serialize is a message, not an array
+        NeoInvokeResultResponse response;
+        response.parseResponse(R"({"result":{"stack":"error: recursive reference"}})");
+        REQUIRE(response.getStackViews().empty());
+    }
+}
@@ -51,4 +51,29 @@ TEST_CASE("binary_reader tests", "[binary_reader]") {
         
         REQUIRE(reader.readVarString() == testStr);
     }
+
+    SECTION("Borrowed reader returns views into the source") {
+        Bytes data = {0x03, 0xAA, 0xBB, 0xCC, 0x02, 'n', 'e', 0x11, 0x22};
+
+        auto reader = BinaryReader::borrow(data);
+        REQUIRE(reader.isBorrowed());
+        ByteView bytes = reader.readVarBytesView();
+        REQUIRE(bytes.data() == data.data() + 1);
+        REQUIRE(bytes.toBytes() == Bytes{0xAA, 0xBB, 0xCC});
+        REQUIRE(reader.readVarString() == "ne");
+        ByteView rest = reader.readBytesView(2);
+        REQUIRE(rest.data() == data.data() + 7);
+        REQUIRE_FALSE(reader.hasMore());
+        REQUIRE_THROWS(reader.readBytesView(1));
+
+        BinaryReader owned(data);
+        REQUIRE_FALSE(owned.isBorrowed());
+        REQUIRE(owned.readVarBytesView().data() != data.data() + 1);
+    }
+
+    SECTION("Oversized length prefixes are rejected") {
+        Bytes data = {0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01};
+        auto reader = BinaryReader::borrow(data);
+        REQUIRE_THROWS(reader.readVarBytesView());
+    }
 }
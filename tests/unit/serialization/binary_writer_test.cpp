@@ -1,6 +1,7 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
 #include "neocpp/serialization/binary_writer.hpp"
+#include "neocpp/serialization/binary_reader.hpp"
 #include "neocpp/utils/hex.hpp"
 #include <sstream>
 #include <array>
@@ -230,4 +231,44 @@ TEST_CASE("binary_writer tests", "[binary_writer]") {
         std::string decoded(bytes.begin() + 3, bytes.begin() + 3 + 300);
         REQUIRE(decoded == longString);
     }
+
+    SECTION("Buffer and stream writers agree and round-trip") {
+        std::ostringstream stream;
+        BinaryWriter streamWriter(stream);
+        BinaryWriter bufferWriter;
+
+        const uint64_t varInts[] = {0, 0xFC, 0xFD, 0xFFFF, 0x10000, 0xFFFFFFFF, 0x100000000ULL, UINT64_MAX};
+        for (BinaryWriter* writer : {&streamWriter, &bufferWriter}) {
+            writer->writeInt16(-2);
+            writer->writeUInt16(0xBEEF);
+            writer->writeInt32(INT32_MIN);
+            writer->writeUInt32(0xDEADBEEF);
+            writer->writeInt64(-1234567890123LL);
+            writer->writeUInt64(UINT64_MAX);
+            writer->write(static_cast<int32_t>(-7));
+            for (uint64_t value : varInts) {
+                writer->writeVarInt(value);
+            }
+            writer->writeFixedString("neo", 6);
+        }
+
+        std::string streamed = stream.str();
+        REQUIRE(Bytes(streamed.begin(), streamed.end()) == bufferWriter.toArray());
+        REQUIRE(Hex::encode(Bytes(bufferWriter.toArray().begin(), bufferWriter.toArray().begin() + 4)) == "feffefbe");
+
+        BinaryReader reader(bufferWriter.toArray());
+        REQUIRE(reader.readInt16() == -2);
+        REQUIRE(reader.readUInt16() == 0xBEEF);
+        REQUIRE(reader.readInt32() == INT32_MIN);
+        REQUIRE(reader.readUInt32() == 0xDEADBEEF);
+        REQUIRE(reader.readInt64() == -1234567890123LL);
+        REQUIRE(reader.readUInt64() == UINT64_MAX);
+        REQUIRE(reader.read<int32_t>() == -7);
+        for (uint64_t value : varInts) {
+            REQUIRE(reader.readVarInt() == value);
+        }
+        REQUIRE(reader.readFixedString(6) == "neo");
+        REQUIRE_FALSE(reader.hasMore());
+        REQUIRE_THROWS(reader.readUInt32());
+    }
 }
@@ -4,6 +4,7 @@
 #include "neocpp/crypto/ec_key_pair.hpp"
 #include "neocpp/crypto/hash.hpp"
 #include "neocpp/script/script_builder.hpp"
+#include "neocpp/exceptions.hpp"
 #include <string>
 #include <vector>
 
@@ -149,4 +150,31 @@ TEST_CASE("AddressUtils Tests", "[utils]") {
         // Neo N3 mainnet version
         REQUIRE(version == 0x35); // Neo N3 uses 0x35 (53 decimal)
     }
-}
\ No newline at end of file
+
+    SECTION("Single-pass and batch conversion") {
+        std::vector<Bytes> scriptHashes;
+        for (int i = 0; i < 50; ++i) {
+            Bytes scriptHash(20);
+            for (size_t j = 0; j < scriptHash.size(); ++j) {
+                scriptHash[j] = static_cast<uint8_t>(i * 31 + j * 7);
+            }
+            scriptHashes.push_back(scriptHash);
+        }
+
+        auto addresses = AddressUtils::scriptHashesToAddresses(scriptHashes, 4);
+        REQUIRE(addresses.size() == scriptHashes.size());
+        for (size_t i = 0; i < addresses.size(); ++i) {
+            REQUIRE(addresses[i] == AddressUtils::scriptHashToAddress(scriptHashes[i]));
+            uint8_t scriptHash[20];
+            REQUIRE(AddressUtils::tryAddressToScriptHash(addresses[i], scriptHash));
+            REQUIRE(Bytes(scriptHash, scriptHash + 20) == scriptHashes[i]);
+        }
+        REQUIRE(AddressUtils::addressesToScriptHashes(addresses, 4) == scriptHashes);
+
+        uint8_t scriptHash[20];
+        REQUIRE_FALSE(AddressUtils::tryAddressToScriptHash("NZNos2WqTbu5oCgyfss9kUJgBXJqhuYAa", scriptHash));
+        addresses[17][10] = addresses[17][10] == 'x' ? 'y' : 'x';
+        REQUIRE_FALSE(AddressUtils::tryAddressToScriptHash(addresses[17], scriptHash));
+        REQUIRE_THROWS_AS(AddressUtils::addressesToScriptHashes(addresses, 4), IllegalArgumentException);
+    }
+}
@@ -138,4 +138,51 @@ TEST_CASE("Hex Tests", "[utils]") {
         REQUIRE(longHex.length() == 512);
         REQUIRE(Hex::decode(longHex) == longData);
     }
-}
\ No newline at end of file
+
+    SECTION("Vectorized lengths and invalid characters") {
+        // Lengths around the 16- and 32-byte blocks, checked against a per-byte reference
+        const char digits[] = "0123456789abcdef";
+        for (size_t length = 0; length <= 100; ++length) {
+            Bytes data(length);
+            std::string expected;
+            for (size_t i = 0; i < length; ++i) {
+                data[i] = static_cast<uint8_t>(i * 37 + length);
+                expected += digits[data[i] >> 4];
+                expected += digits[data[i] & 0x0F];
+            }
+            REQUIRE(Hex::encode(data) == expected);
+            REQUIRE(Hex::decode(expected) == data);
+        }
+
+        Bytes all(256);
+        for (size_t i = 0; i < all.size(); ++i) {
+            all[i] = static_cast<uint8_t>(i);
+        }
+        REQUIRE(Hex::decode(Hex::encode(all, true)) == all);
+
+        // A bad character anywhere in a long string is rejected
+        std::string hex = Hex::encode(all);
+        for (size_t i = 0; i < hex.size(); i += 7) {
+            for (char bad : {'g', 'G', '/', ':', '@', '`', ' ', '\x80'}) {
+                std::string corrupted = hex;
+                corrupted[i] = bad;
+                REQUIRE(Hex::decode(corrupted).empty());
+            }
+        }
+    }
+
+    SECTION("Decode into caller buffers") {
+        uint8_t out[4] = {};
+        REQUIRE(Hex::decode("0xdeadBEEF", out, sizeof(out)));
+        REQUIRE(out[0] == 0xDE);
+        REQUIRE(out[3] == 0xEF);
+        REQUIRE_FALSE(Hex::decode("deadbe", out, sizeof(out)));
+        REQUIRE_FALSE(Hex::decode("deadbeefef", out, sizeof(out)));
+        REQUIRE_FALSE(Hex::decode("deadbeeg", out, sizeof(out)));
+
+        char chars[8];
+        const uint8_t data[] = {0x01, 0xAB, 0xCD, 0xEF};
+        Hex::encode(data, sizeof(data), chars, true);
+        REQUIRE(std::string(chars, sizeof(chars)) == "01ABCDEF");
+    }
+}